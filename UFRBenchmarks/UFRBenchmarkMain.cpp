@@ -0,0 +1,71 @@
+/*
+File:		UFRBenchmarkMain.cpp
+Project:	Unhappy Flying Reptiles
+Author(s):	Jorge Ramirez
+Description:
+	This file contains the entry point of the benchmark runner, which times the cases of the game that need
+	neither MFC nor GDI+ on their own, without the window of the game.
+	The cases that draw stay in the game, behind its /bench option.
+*/
+
+#include "UFRBenchmark.h"
+#include "UFRBenchmarks.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+#define BENCHMARK_MAX_PATH 1024
+
+
+/*
+Name:	main()
+Params:
+	int argc - The number of arguments.
+	char* argv[] - The JSON file to save the results to, the seed of the stress levels and how long each case
+		is timed for at least, in microseconds. Each is optional, and "-" leaves the results unsaved.
+Return: int - 0, or 1 if the arguments are wrong or the results could not be saved.
+Description:
+	This runs every case and prints the time of each, then saves the results in the format of Google Benchmark.
+	A release build should be timed, with nothing else running.
+*/
+int main(int argc, char* argv[])
+{
+	const char* path = argc > 1 ? argv[1] : "-";
+	unsigned int seed = argc > 2 ? (unsigned int)strtoul(argv[2], NULL, 10) : 0;
+	long long minTime = argc > 3 ? strtoll(argv[3], NULL, 10) : BENCHMARK_MIN_TIME;
+	wchar_t widePath[BENCHMARK_MAX_PATH];
+	size_t converted;
+
+	if (argc > 4 || minTime <= 0)
+	{
+		fprintf(stderr, "Usage: %s [results.json|-] [seed] [minimum time of each case in microseconds]\n", argv[0]);
+		return 1;
+	}
+
+	UFRBenchmark benchmark(minTime);
+	{
+		UFRBenchmarks benchmarks(seed);
+		benchmarks.Run(&benchmark);
+	}
+
+	for (int result = 0; result < benchmark.GetResultCount(); result++)
+	{
+		const UFRBenchmarkResult& timing = benchmark.GetResult(result);
+		printf("%-36s %14.0f ns %14.0f ns cpu %12lld iterations %8.1f allocations\n", timing.name.c_str(),
+			timing.realTime, timing.cpuTime, timing.iterations, timing.allocations);
+	}
+
+	if (path[0] == '-' && path[1] == '\0')
+	{
+		return 0;
+	}
+
+	converted = mbstowcs(widePath, path, BENCHMARK_MAX_PATH);
+	if (converted == (size_t)-1 || converted >= BENCHMARK_MAX_PATH || !benchmark.Write(widePath))
+	{
+		fprintf(stderr, "Could not write %s\n", path);
+		return 1;
+	}
+
+	printf("%d results written to %s\n", benchmark.GetResultCount(), path);
+	return 0;
+}
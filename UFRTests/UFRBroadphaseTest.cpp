@@ -0,0 +1,257 @@
+/*
+File:		UFRBroadphaseTest.cpp
+Project:	Unhappy Flying Reptiles
+Author(s):	Jorge Ramirez
+Description:
+	This file contains the tests of the UFRBroadphase class, which compare it with testing every body against every other.
+*/
+
+#include "UFRTest.h"
+#include "UFRBroadphase.h"
+#include "UFRLevel.h"
+#include "UFRLevelGenerator.h"
+#include <stdlib.h>
+#include <vector>
+
+#define TEST_SEED 1234
+#define TEST_CRATES 2000
+#define TEST_CRATE_SPRITE_SIZE 131 // As the benchmarks size the crates
+#define TEST_NEGATIVE_SHIFT -3000 // Every other crate is moved this far left and down, past the origin
+#define TEST_LARGE_BODIES 40 // Bodies several cells across, dropped over the crates
+#define TEST_LARGE_SIZE 400
+#define TEST_HIT_POINTS 20000
+#define TEST_AREA 6000 // Hit points are spread this far either side of the origin
+
+
+/*
+Name: UFRTestBox
+Description:
+	A body as it was added to the broadphase.
+*/
+struct UFRTestBox
+{
+	int left;
+	int bottom;
+	int width;
+	int height;
+};
+
+
+/*
+Name:	MakeBoxes()
+Params: std::vector<UFRTestBox>& boxes - Set to the bodies of a generated level, some moved past the origin, and some large ones.
+Return: void
+Description:
+	This makes the bodies the tests add, from a seeded level so every run tests the same ones.
+*/
+static void MakeBoxes(std::vector<UFRTestBox>& boxes)
+{
+	UFRLevel level;
+	UFRLevelGenerator generator(TEST_SEED);
+	UFRTestBox box;
+
+	generator.Generate(&level, TEST_CRATES);
+	boxes.clear();
+	for (int crate = 0; crate < level.GetCrateCount(); crate++)
+	{
+		box.width = (int)(TEST_CRATE_SPRITE_SIZE * level.GetScales()[crate]);
+		box.height = box.width;
+		box.left = level.GetLefts()[crate] + (crate % 2 == 0 ? TEST_NEGATIVE_SHIFT : 0);
+		box.bottom = level.GetBottoms()[crate] + (crate % 4 == 0 ? TEST_NEGATIVE_SHIFT : 0);
+		boxes.push_back(box);
+	}
+
+	srand(TEST_SEED);
+	for (int large = 0; large < TEST_LARGE_BODIES; large++)
+	{
+		box.left = boxes[rand() % boxes.size()].left - TEST_LARGE_SIZE / 2;
+		box.bottom = boxes[rand() % boxes.size()].bottom - TEST_LARGE_SIZE / 2;
+		box.width = TEST_LARGE_SIZE / (1 + large % 3);
+		box.height = TEST_LARGE_SIZE;
+		boxes.push_back(box);
+	}
+}
+
+
+
+/*
+Name:	Overlap()
+Params:
+	const UFRTestBox& box - One body.
+	const UFRTestBox& otherBox - The other body.
+Return: bool - Whether the boxes overlap once widened by BROADPHASE_MARGIN.
+Description:
+	This is the overlap the broadphase pairs bodies by, written out for the brute force.
+*/
+static bool Overlap(const UFRTestBox& box, const UFRTestBox& otherBox)
+{
+	return box.left - BROADPHASE_MARGIN <= otherBox.left + otherBox.width + BROADPHASE_MARGIN &&
+		otherBox.left - BROADPHASE_MARGIN <= box.left + box.width + BROADPHASE_MARGIN &&
+		box.bottom - BROADPHASE_MARGIN <= otherBox.bottom + otherBox.height + BROADPHASE_MARGIN &&
+		otherBox.bottom - BROADPHASE_MARGIN <= box.bottom + box.height + BROADPHASE_MARGIN;
+}
+
+
+
+/*
+Name:	HitTest()
+Params:
+	const std::vector<UFRTestBox>& boxes - The bodies in the order they were added.
+	int x - The point.
+	int y - The point.
+	int below - Only bodies before this one are hit.
+Return: int - The last body added that has the point strictly inside it, or -1.
+Description:
+	This is the hit test of the broadphase done by looking at every body.
+*/
+static int HitTest(const std::vector<UFRTestBox>& boxes, int x, int y, int below)
+{
+	for (int body = below - 1; body >= 0; body--)
+	{
+		const UFRTestBox& box = boxes[body];
+
+		if (x > box.left && x < box.left + box.width && y > box.bottom && y < box.bottom + box.height)
+		{
+			return body;
+		}
+	}
+
+	return -1;
+}
+
+
+
+/*
+Name:	TestFindPairs()
+Params: void
+Return: void
+Description:
+	FindPairs finds exactly the pairs testing every pair finds, each once and in the same order.
+	The grid is built twice, so memory kept from the first build does not change the second.
+*/
+static void TestFindPairs()
+{
+	std::vector<UFRTestBox> boxes;
+	std::vector<UFRBodyPair> expected;
+	std::vector<UFRBodyPair> pairs;
+	UFRBroadphase broadphase;
+	UFRBodyPair pair;
+	bool same;
+
+	MakeBoxes(boxes);
+	for (pair.first = 0; pair.first < boxes.size(); pair.first++)
+	{
+		for (pair.second = pair.first + 1; pair.second < boxes.size(); pair.second++)
+		{
+			if (Overlap(boxes[pair.first], boxes[pair.second]))
+			{
+				expected.push_back(pair);
+			}
+		}
+	}
+
+	for (int build = 0; build < 2; build++)
+	{
+		broadphase.Clear();
+		for (int body = 0; body < boxes.size(); body++)
+		{
+			broadphase.Add(boxes[body].left, boxes[body].bottom, boxes[body].width, boxes[body].height);
+		}
+		broadphase.FindPairs(pairs);
+
+		same = pairs.size() == expected.size();
+		for (int found = 0; found < pairs.size() && same; found++)
+		{
+			same = pairs[found].first == expected[found].first && pairs[found].second == expected[found].second;
+		}
+
+		CHECK(broadphase.GetBodyCount() == (int)boxes.size());
+		CHECK(!expected.empty());
+		CHECK(same);
+	}
+}
+
+
+
+/*
+Name:	TestHitTest()
+Params: void
+Return: void
+Description:
+	HitTest finds the last body added under a point, and passing that body as below finds the one under it.
+	Half the points are at the centers of bodies, so most of them hit something.
+*/
+static void TestHitTest()
+{
+	std::vector<UFRTestBox> boxes;
+	UFRBroadphase broadphase;
+	int x;
+	int y;
+	int hit;
+	int hits = 0;
+	int mismatches = 0;
+
+	MakeBoxes(boxes);
+	for (int body = 0; body < boxes.size(); body++)
+	{
+		broadphase.Add(boxes[body].left, boxes[body].bottom, boxes[body].width, boxes[body].height);
+	}
+
+	srand(TEST_SEED + 1);
+	for (int point = 0; point < TEST_HIT_POINTS; point++)
+	{
+		if (point % 2 == 0)
+		{
+			const UFRTestBox& box = boxes[rand() % boxes.size()];
+			x = box.left + box.width / 2;
+			y = box.bottom + box.height / 2;
+		}
+		else
+		{
+			x = rand() % (2 * TEST_AREA) - TEST_AREA;
+			y = rand() % (2 * TEST_AREA) - TEST_AREA;
+		}
+
+		hit = broadphase.HitTest(x, y, broadphase.GetBodyCount());
+		if (hit != HitTest(boxes, x, y, (int)boxes.size()))
+		{
+			mismatches++;
+		}
+		if (hit >= 0)
+		{
+			hits++;
+			if (broadphase.HitTest(x, y, hit) != HitTest(boxes, x, y, hit))
+			{
+				mismatches++;
+			}
+		}
+	}
+
+	CHECK(hits > 0);
+	CHECK(mismatches == 0);
+
+	// A point on the edge of a body does not hit it
+	broadphase.Clear();
+	broadphase.Add(0, 0, 10, 10);
+	CHECK(broadphase.HitTest(5, 5, 1) == 0);
+	CHECK(broadphase.HitTest(0, 5, 1) == -1);
+	CHECK(broadphase.HitTest(5, 10, 1) == -1);
+	CHECK(broadphase.HitTest(5, 5, 0) == -1);
+}
+
+
+
+/*
+Name:	main()
+Params: void
+Return: int - 0 if every test passed, or 1.
+Description:
+	This runs every test of the broadphase.
+*/
+int main()
+{
+	TestFindPairs();
+	TestHitTest();
+
+	return UFRTest::Finish("UFRBroadphaseTest");
+}
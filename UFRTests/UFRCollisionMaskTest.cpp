@@ -0,0 +1,238 @@
+/*
+File:		UFRCollisionMaskTest.cpp
+Project:	Unhappy Flying Reptiles
+Author(s):	Jorge Ramirez
+Description:
+	This file contains the tests of the UFRCollisionMask class, which compare it with testing every pixel.
+*/
+
+#include "UFRTest.h"
+#include "UFRCollisionMask.h"
+#include <stdlib.h>
+#include <vector>
+
+#define TEST_SEED 42
+#define TEST_BYTES_PER_PIXEL 4
+#define TEST_ALPHA_BYTE 3
+#define TEST_STRIDE_PADDING 12 // Bytes past the end of each row, so the stride is not the width
+#define TEST_MAX_HEIGHT 24
+#define TEST_SOLID_PERCENT 4 // Few solid pixels, so most offsets find no overlap and scan every word they share
+#define TEST_MAX_OFFSET 70
+#define TEST_MASK_WIDTHS 9
+
+static const int maskWidths[TEST_MASK_WIDTHS] = { 1, 7, 63, 64, 65, 100, 127, 129, 150 };
+
+
+/*
+Name: UFRTestSprite
+Description:
+	The pixels of a random sprite and the masks built from them, as drawn and mirrored.
+*/
+struct UFRTestSprite
+{
+	int width;
+	int height;
+	int stride;
+	std::vector<unsigned char> pixels;
+	UFRCollisionMask mask;
+	UFRCollisionMask mirroredMask;
+};
+
+
+
+/*
+Name:	MakeSprite()
+Params:
+	UFRTestSprite* sprite - Set to a random sprite and its masks.
+	int width - The width of the sprite.
+Return: void
+Description:
+	This fills a sprite with random alpha, with a few pixels on the threshold either way, and builds both masks.
+*/
+static void MakeSprite(UFRTestSprite* sprite, int width)
+{
+	int roll;
+	unsigned char alpha;
+
+	sprite->width = width;
+	sprite->height = rand() % TEST_MAX_HEIGHT + 1;
+	sprite->stride = width * TEST_BYTES_PER_PIXEL + TEST_STRIDE_PADDING;
+	sprite->pixels.assign(sprite->stride * sprite->height, 0);
+
+	for (int row = 0; row < sprite->height; row++)
+	{
+		for (int column = 0; column < width; column++)
+		{
+			roll = rand() % 100;
+			if (roll < TEST_SOLID_PERCENT)
+			{
+				alpha = roll % 2 == 0 ? MASK_ALPHA_THRESHOLD : 255;
+			}
+			else
+			{
+				alpha = roll % 2 == 0 ? MASK_ALPHA_THRESHOLD - 1 : 0;
+			}
+			sprite->pixels[row * sprite->stride + column * TEST_BYTES_PER_PIXEL + TEST_ALPHA_BYTE] = alpha;
+		}
+	}
+
+	sprite->mask.Build(&sprite->pixels[0], sprite->stride, width, sprite->height, false);
+	sprite->mirroredMask.Build(&sprite->pixels[0], sprite->stride, width, sprite->height, true);
+}
+
+
+
+/*
+Name:	IsSolid()
+Params:
+	const UFRTestSprite& sprite - The sprite.
+	int x - The column in the mask, from the left.
+	int y - The row, from the top.
+	bool mirrored - Whether the mask is of the sprite flipped left to right.
+Return: bool - Whether the pixel of the mask is solid, read straight from the sprite. Pixels outside it are not.
+Description:
+	This is what the masks should hold.
+*/
+static bool IsSolid(const UFRTestSprite& sprite, int x, int y, bool mirrored)
+{
+	if (x < 0 || x >= sprite.width || y < 0 || y >= sprite.height)
+	{
+		return false;
+	}
+
+	if (mirrored)
+	{
+		x = sprite.width - 1 - x;
+	}
+
+	return sprite.pixels[y * sprite.stride + x * TEST_BYTES_PER_PIXEL + TEST_ALPHA_BYTE] >= MASK_ALPHA_THRESHOLD;
+}
+
+
+
+/*
+Name:	Overlaps()
+Params:
+	const UFRTestSprite& sprite - The sprite Overlaps is called on.
+	bool mirrored - Whether its mirrored mask is used.
+	const UFRTestSprite& other - The other sprite.
+	bool otherMirrored - Whether its mirrored mask is used.
+	int offsetX - How far right of the left of the first mask the left of the other one is.
+	int offsetY - How far below the top of the first mask the top of the other one is.
+Return: bool - Whether any solid pixel of one lands on a solid pixel of the other.
+Description:
+	This is the overlap test done one pixel at a time.
+*/
+static bool Overlaps(const UFRTestSprite& sprite, bool mirrored, const UFRTestSprite& other, bool otherMirrored, int offsetX, int offsetY)
+{
+	for (int y = 0; y < sprite.height; y++)
+	{
+		for (int x = 0; x < sprite.width; x++)
+		{
+			if (IsSolid(sprite, x, y, mirrored) && IsSolid(other, x - offsetX, y - offsetY, otherMirrored))
+			{
+				return true;
+			}
+		}
+	}
+
+	return false;
+}
+
+
+
+/*
+Name:	TestBuild()
+Params: const std::vector<UFRTestSprite>& sprites - The sprites.
+Return: void
+Description:
+	Every bit of both masks of every sprite matches its pixel, and pixels outside the sprite are clear.
+*/
+static void TestBuild(const std::vector<UFRTestSprite>& sprites)
+{
+	int mismatches = 0;
+
+	for (int sprite = 0; sprite < sprites.size(); sprite++)
+	{
+		const UFRTestSprite& testSprite = sprites[sprite];
+
+		for (int y = -1; y <= testSprite.height; y++)
+		{
+			for (int x = -1; x <= testSprite.width; x++)
+			{
+				mismatches += testSprite.mask.Test(x, y) != IsSolid(testSprite, x, y, false);
+				mismatches += testSprite.mirroredMask.Test(x, y) != IsSolid(testSprite, x, y, true);
+			}
+		}
+	}
+
+	CHECK(mismatches == 0);
+}
+
+
+
+/*
+Name:	TestOverlaps()
+Params: const std::vector<UFRTestSprite>& sprites - The sprites.
+Return: void
+Description:
+	Overlaps agrees with the pixel by pixel test for every pair of sprites, mirrored or not,
+	at every offset up to TEST_MAX_OFFSET either way in both directions.
+*/
+static void TestOverlaps(const std::vector<UFRTestSprite>& sprites)
+{
+	int mismatches = 0;
+	int overlaps = 0;
+	int tests = 0;
+	bool expected;
+
+	for (int sprite = 0; sprite < sprites.size(); sprite++)
+	{
+		const UFRTestSprite& first = sprites[sprite];
+		const UFRTestSprite& second = sprites[(sprite * 5 + 3) % sprites.size()];
+		bool mirrored = sprite % 2 == 1;
+		bool otherMirrored = sprite % 3 == 1;
+		const UFRCollisionMask& firstMask = mirrored ? first.mirroredMask : first.mask;
+		const UFRCollisionMask& secondMask = otherMirrored ? second.mirroredMask : second.mask;
+
+		for (int offsetY = -TEST_MAX_OFFSET; offsetY <= TEST_MAX_OFFSET; offsetY++)
+		{
+			for (int offsetX = -TEST_MAX_OFFSET; offsetX <= TEST_MAX_OFFSET; offsetX++)
+			{
+				expected = Overlaps(first, mirrored, second, otherMirrored, offsetX, offsetY);
+				mismatches += firstMask.Overlaps(secondMask, offsetX, offsetY) != expected;
+				overlaps += expected;
+				tests++;
+			}
+		}
+	}
+
+	CHECK(overlaps > 0);
+	CHECK(overlaps < tests);
+	CHECK(mismatches == 0);
+}
+
+
+
+/*
+Name:	main()
+Params: void
+Return: int - 0 if every test passed, or 1.
+Description:
+	This makes two sprites of each width and runs every test of the masks on them.
+*/
+int main()
+{
+	std::vector<UFRTestSprite> sprites(TEST_MASK_WIDTHS * 2);
+
+	srand(TEST_SEED);
+	for (int sprite = 0; sprite < sprites.size(); sprite++)
+	{
+		MakeSprite(&sprites[sprite], maskWidths[sprite % TEST_MASK_WIDTHS]);
+	}
+
+	TestBuild(sprites);
+	TestOverlaps(sprites);
+
+	return UFRTest::Finish("UFRCollisionMaskTest");
+}
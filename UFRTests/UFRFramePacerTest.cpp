@@ -0,0 +1,169 @@
+/*
+File:		UFRFramePacerTest.cpp
+Project:	Unhappy Flying Reptiles
+Author(s):	Jorge Ramirez
+Description:
+	This file contains the tests of the UFRFramePacer class, run on a simulated clock so they take no real time
+	and give the same result on every machine.
+*/
+
+#include "UFRTest.h"
+#include "UFRFramePacer.h"
+
+#define TEST_INTERVAL 16667 // 60 frames a second, in microseconds
+#define TEST_SPIN_MARGIN 2000 // As the game paces its loops
+#define TEST_SLEEP_GRANULARITY 1000
+#define TEST_WAKE_UP_DELAY 100
+#define TEST_SPIN_COST 1
+#define TEST_WORK 5000 // The time each frame works for before it waits
+#define TEST_FRAMES 120
+#define TEST_LATE_WAKE_UP 12000 // How late the one late sleep wakes up, as when the thread is preempted
+#define TEST_MAX_OVERSHOOT (TEST_INTERVAL / 4)
+
+
+/*
+Name: UFRLateWakeUpClock
+Inherit: public UFRSimulatedClock
+Description:
+	This class is a simulated clock where one chosen sleep wakes up far later than the others.
+	It adds up the time spent spinning, so a test can see how long the pacer spun for.
+*/
+class UFRLateWakeUpClock : public UFRSimulatedClock
+{
+private:
+	int sleepsUntilLate;
+	long long lateness;
+
+public:
+	long long spinTime;
+
+	UFRLateWakeUpClock(int lateSleep, long long lateBy) : UFRSimulatedClock(TEST_SLEEP_GRANULARITY, TEST_WAKE_UP_DELAY, TEST_SPIN_COST)
+	{
+		sleepsUntilLate = lateSleep;
+		lateness = lateBy;
+		spinTime = 0;
+	}
+
+	void Sleep(long long microseconds)
+	{
+		UFRSimulatedClock::Sleep(microseconds);
+		if (sleepsUntilLate-- == 0)
+		{
+			Advance(lateness);
+		}
+	}
+
+	void Spin()
+	{
+		UFRSimulatedClock::Spin();
+		spinTime += TEST_SPIN_COST;
+	}
+};
+
+
+
+/*
+Name:	TestSteadyPacing()
+Params: void
+Return: void
+Description:
+	Frames that finish their work in time wake up on their deadlines, which stay on the grid from the start.
+*/
+static void TestSteadyPacing()
+{
+	UFRSimulatedClock clock(TEST_SLEEP_GRANULARITY, TEST_WAKE_UP_DELAY, TEST_SPIN_COST);
+	UFRFramePacer pacer(&clock, TEST_INTERVAL, TEST_SPIN_MARGIN);
+	bool onGrid = true;
+
+	pacer.Start();
+	for (int frame = 1; frame <= TEST_FRAMES; frame++)
+	{
+		clock.Advance(TEST_WORK);
+		onGrid = onGrid && pacer.WaitForNextFrame() == (long long)frame * TEST_INTERVAL;
+	}
+
+	CHECK(onGrid);
+	CHECK(pacer.GetFrameCount() == TEST_FRAMES);
+	CHECK(pacer.GetMissedCount() == 0);
+	CHECK(pacer.GetSkippedCount() == 0);
+	CHECK(pacer.GetMaxWakeUpError() < TEST_SPIN_COST);
+}
+
+
+
+/*
+Name:	TestMissedFrames()
+Params: void
+Return: void
+Description:
+	A frame that works past its deadline is missed, and the deadlines it ran past are skipped instead of run back to back.
+*/
+static void TestMissedFrames()
+{
+	UFRSimulatedClock clock(TEST_SLEEP_GRANULARITY, TEST_WAKE_UP_DELAY, TEST_SPIN_COST);
+	UFRFramePacer pacer(&clock, TEST_INTERVAL, TEST_SPIN_MARGIN);
+
+	pacer.Start();
+	clock.Advance(2 * TEST_INTERVAL + TEST_WORK);
+	CHECK(pacer.WaitForNextFrame() == 2 * TEST_INTERVAL);
+	CHECK(pacer.GetMissedCount() == 1);
+	CHECK(pacer.GetSkippedCount() == 1);
+	CHECK(pacer.GetMaxLateness() == TEST_INTERVAL + TEST_WORK);
+
+	clock.Advance(TEST_WORK);
+	CHECK(pacer.WaitForNextFrame() == 3 * TEST_INTERVAL);
+	CHECK(clock.Now() == 3 * TEST_INTERVAL);
+	CHECK(pacer.GetMissedCount() == 1);
+}
+
+
+
+/*
+Name:	TestLateWakeUp()
+Params: void
+Return: void
+Description:
+	One sleep that wakes up very late must not make the frames after it spin for most of their wait.
+	Without a cap on the overshoot estimate, the frames after it would spin for the whole late wake up
+	until the estimate decays, which takes dozens of frames.
+*/
+static void TestLateWakeUp()
+{
+	UFRLateWakeUpClock clock(TEST_FRAMES / 2, TEST_LATE_WAKE_UP);
+	UFRFramePacer pacer(&clock, TEST_INTERVAL, TEST_SPIN_MARGIN);
+	long long spinStart;
+	long long maxSpin = 0;
+
+	pacer.Start();
+	for (int frame = 1; frame <= TEST_FRAMES; frame++)
+	{
+		clock.Advance(TEST_WORK);
+		spinStart = clock.spinTime;
+		pacer.WaitForNextFrame();
+		if (frame > TEST_FRAMES / 2 + 1 && clock.spinTime - spinStart > maxSpin)
+		{
+			maxSpin = clock.spinTime - spinStart;
+		}
+	}
+
+	CHECK(pacer.GetMissedCount() == 0);
+	CHECK(maxSpin <= TEST_SPIN_MARGIN + TEST_MAX_OVERSHOOT);
+}
+
+
+
+/*
+Name:	main()
+Params: void
+Return: int - 0 if every test passed, or 1.
+Description:
+	This runs every test of the pacer.
+*/
+int main()
+{
+	TestSteadyPacing();
+	TestMissedFrames();
+	TestLateWakeUp();
+
+	return UFRTest::Finish("UFRFramePacerTest");
+}
@@ -0,0 +1,113 @@
+/*
+File:		UFRImageScalerTest.cpp
+Project:	Unhappy Flying Reptiles
+Author(s):	Jorge Ramirez
+Description:
+	This file contains the tests of the UFRImageScaler class, which compare it with sampling every pixel on its own.
+*/
+
+#include "UFRTest.h"
+#include "UFRImageScaler.h"
+#include "UFRJobSystem.h"
+#include <stdlib.h>
+#include <vector>
+
+#define TEST_SEED 7
+#define TEST_IMAGE_WIDTH 37
+#define TEST_IMAGE_HEIGHT 29
+#define TEST_STRIDE_PADDING 3 // Pixels past the end of each row, so the stride is not the width
+#define TEST_THREADS 4
+#define TEST_SIZES 6
+
+// The scaled sizes and the integer scale of each, 1 to stretch
+static const int scaledSizes[TEST_SIZES][3] =
+{
+	{ TEST_IMAGE_WIDTH * 2, TEST_IMAGE_HEIGHT * 2, 2 },
+	{ TEST_IMAGE_WIDTH * 4, TEST_IMAGE_HEIGHT * 4, 4 },
+	{ 100, 75, 1 },
+	{ 641, 403, 1 },
+	{ TEST_IMAGE_WIDTH * 3, TEST_IMAGE_HEIGHT * 3, 3 },
+	{ 50, 300, 1 }
+};
+
+
+/*
+Name:	MatchesSampling()
+Params:
+	UFRImageScaler* scaler - The scaler, which has just scaled the image.
+	const std::vector<unsigned int>& image - The image, TEST_STRIDE_PADDING pixels wider than it is.
+Return: bool - Whether every scaled pixel is the image pixel under it.
+Description:
+	This is nearest neighbour scaling done one pixel at a time. At an integer scale it repeats each pixel that many times.
+*/
+static bool MatchesSampling(UFRImageScaler* scaler, const std::vector<unsigned int>& image)
+{
+	int width = scaler->GetScaledWidth();
+	int height = scaler->GetScaledHeight();
+	int column;
+	int row;
+
+	for (int y = 0; y < height; y++)
+	{
+		for (int x = 0; x < width; x++)
+		{
+			column = (int)((long long)x * TEST_IMAGE_WIDTH / width);
+			row = (int)((long long)y * TEST_IMAGE_HEIGHT / height);
+			if (scaler->GetPixels()[y * width + x] != image[row * (TEST_IMAGE_WIDTH + TEST_STRIDE_PADDING) + column])
+			{
+				return false;
+			}
+		}
+	}
+
+	return true;
+}
+
+
+
+/*
+Name:	TestScale()
+Params: UFRJobSystem* jobs - The job system the tiles are scaled on, or NULL to scale them on this thread.
+Return: void
+Description:
+	Every size, at an integer scale and stretched, matches sampling every pixel, as the size changes from one to the next.
+*/
+static void TestScale(UFRJobSystem* jobs)
+{
+	UFRImageScaler scaler(TEST_IMAGE_WIDTH, TEST_IMAGE_HEIGHT, jobs);
+	std::vector<unsigned int> image((TEST_IMAGE_WIDTH + TEST_STRIDE_PADDING) * TEST_IMAGE_HEIGHT);
+
+	CHECK(scaler.GetPixels() == NULL);
+
+	for (int pixel = 0; pixel < image.size(); pixel++)
+	{
+		image[pixel] = (unsigned int)rand() * 65599u + pixel;
+	}
+
+	for (int size = 0; size < TEST_SIZES; size++)
+	{
+		scaler.SetSize(scaledSizes[size][0], scaledSizes[size][1], scaledSizes[size][2]);
+		scaler.Scale(&image[0], (TEST_IMAGE_WIDTH + TEST_STRIDE_PADDING) * sizeof(unsigned int));
+		CHECK(MatchesSampling(&scaler, image));
+	}
+}
+
+
+
+/*
+Name:	main()
+Params: void
+Return: int - 0 if every test passed, or 1.
+Description:
+	This runs the test of the scaler on the calling thread and on a job system.
+*/
+int main()
+{
+	UFRJobSystem jobs(TEST_THREADS);
+
+	srand(TEST_SEED);
+	TestScale(NULL);
+	TestScale(&jobs);
+
+	return UFRTest::Finish("UFRImageScalerTest");
+}
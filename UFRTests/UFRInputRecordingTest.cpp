@@ -0,0 +1,137 @@
+/*
+File:		UFRInputRecordingTest.cpp
+Project:	Unhappy Flying Reptiles
+Author(s):	Jorge Ramirez
+Description:
+	This file contains the tests of the UFRInputRecording class, for the files a capture replays.
+	The files are written next to the test and removed afterwards.
+*/
+
+#include "UFRTest.h"
+#include "UFRInputRecording.h"
+#include <stdio.h>
+
+#define TEST_RECORDING_PATH "UFRInputRecordingTest.txt"
+#define TEST_SEED 123456789
+#define TEST_EVENTS 1000
+
+static const wchar_t* recordingPath = L"UFRInputRecordingTest.txt";
+
+
+/*
+Name:	LoadsText()
+Params:
+	const char* text - The contents of the recording.
+	int errorLine - The line Load should stop at, or 0 if it should read the file.
+Return: bool - Whether Load read the file or turned it down at the line expected.
+Description:
+	This writes a recording by hand and reads it.
+*/
+static bool LoadsText(const char* text, int errorLine)
+{
+	UFRInputRecording recording;
+	FILE* file = fopen(TEST_RECORDING_PATH, "w");
+
+	if (file == NULL)
+	{
+		return false;
+	}
+	fputs(text, file);
+	fclose(file);
+
+	return recording.Load(recordingPath) == (errorLine == 0) && recording.GetErrorLine() == errorLine;
+}
+
+
+
+/*
+Name:	TestRoundTrip()
+Params: void
+Return: void
+Description:
+	Every event recorded is read back as it was, in the order it was recorded, with the seed.
+*/
+static void TestRoundTrip()
+{
+	UFRInputRecording recording;
+	UFRInputRecording replay;
+	bool same = true;
+
+	CHECK(!recording.IsRecording());
+	recording.Record(0, INPUT_CLICK, 1, 2);
+	CHECK(recording.Close());
+
+	CHECK(recording.Create(recordingPath, TEST_SEED));
+	CHECK(recording.IsRecording());
+	for (int event = 0; event < TEST_EVENTS; event++)
+	{
+		recording.Record(event / 3, event % 5 == 0 ? INPUT_CLICK : INPUT_MOUSE_MOVE, event * 7 - 500, -event);
+	}
+	CHECK(recording.Close());
+	CHECK(!recording.IsRecording());
+
+	CHECK(replay.Load(recordingPath));
+	CHECK(replay.GetSeed() == TEST_SEED);
+	CHECK(replay.GetCount() == TEST_EVENTS);
+	for (int event = 0; event < replay.GetCount(); event++)
+	{
+		const UFRRecordedInput& input = replay.GetInput(event);
+		same = same && input.tick == event / 3 && input.type == (event % 5 == 0 ? INPUT_CLICK : INPUT_MOUSE_MOVE) &&
+			input.x == event * 7 - 500 && input.y == -event;
+	}
+	CHECK(same);
+}
+
+
+
+/*
+Name:	TestBadFiles()
+Params: void
+Return: void
+Description:
+	Load takes comments and blank lines, and turns down a file without a seed first, an unknown event,
+	an event in an earlier tick than the one above it, or a line with anything else on it.
+*/
+static void TestBadFiles()
+{
+	UFRInputRecording recording;
+
+	CHECK(!recording.Load(L"UFRInputRecordingTest.missing"));
+
+	CHECK(LoadsText("# A recording\n\nseed 5 # the seed\n0 1 10 20\n0 0 -3 4 # a move\n7 1 0 0\n", 0));
+	CHECK(LoadsText("seed 5\n", 0));
+	// With no seed at all there is no line to blame
+	CHECK(!LoadsText("", 0));
+	CHECK(LoadsText("0 1 10 20\n", 1));
+	CHECK(LoadsText("seed\n", 1));
+	CHECK(LoadsText("seed 5 6\n", 1));
+	CHECK(LoadsText("seed 5\n3 1 10 20\n2 1 10 20\n", 3));
+	CHECK(LoadsText("seed 5\n-1 1 10 20\n", 2));
+	CHECK(LoadsText("seed 5\n0 2 10 20\n", 2));
+	CHECK(LoadsText("seed 5\n0 1 10\n", 2));
+	CHECK(LoadsText("seed 5\n0 1 10 20 30\n", 2));
+	CHECK(LoadsText("seed 5\n0 1 10 20x\n", 2));
+
+	// A file turned down has no events left from it
+	CHECK(recording.Load(recordingPath) == false);
+	CHECK(recording.GetCount() == 0);
+}
+
+
+
+/*
+Name:	main()
+Params: void
+Return: int - 0 if every test passed, or 1.
+Description:
+	This runs every test of the input recording and removes the file they wrote.
+*/
+int main()
+{
+	TestRoundTrip();
+	TestBadFiles();
+
+	remove(TEST_RECORDING_PATH);
+
+	return UFRTest::Finish("UFRInputRecordingTest");
+}
@@ -0,0 +1,283 @@
+/*
+File:		UFRLevelTest.cpp
+Project:	Unhappy Flying Reptiles
+Author(s):	Jorge Ramirez
+Description:
+	This file contains the tests of the UFRLevel class, for the checks that keep a damaged or hostile level file
+	from reaching the game. The files are written next to the test and removed afterwards.
+*/
+
+#include "UFRTest.h"
+#include "UFRLevel.h"
+#include <stdio.h>
+#include <string.h>
+#include <limits>
+#include <vector>
+
+#define TEST_LEVEL_PATH "UFRLevelTest.ufrl"
+#define TEST_TEXT_PATH "UFRLevelTest.txt"
+#define TEST_CRATES 5
+
+static const wchar_t* levelPath = L"UFRLevelTest.ufrl";
+static const wchar_t* textPath = L"UFRLevelTest.txt";
+
+
+/*
+Name:	WriteBytes()
+Params:
+	const char* path - The file to write.
+	const std::vector<unsigned char>& bytes - What to write to it.
+	size_t size - How many of the bytes to write.
+Return: void
+Description:
+	This replaces a file with some or all of the bytes of a level.
+*/
+static void WriteBytes(const char* path, const std::vector<unsigned char>& bytes, size_t size)
+{
+	FILE* file = fopen(path, "wb");
+
+	if (file != NULL)
+	{
+		fwrite(bytes.data(), 1, size, file);
+		fclose(file);
+	}
+}
+
+
+
+/*
+Name:	WriteGoodLevel()
+Params: std::vector<unsigned char>& bytes - Set to the contents of the level that was written.
+Return: bool - Whether the level was written and read back.
+Description:
+	This writes a valid level of TEST_CRATES crates and reads the file back, for the tests to damage.
+*/
+static bool WriteGoodLevel(std::vector<unsigned char>& bytes)
+{
+	UFRLevel level;
+	FILE* file;
+	long size;
+
+	for (int crate = 0; crate < TEST_CRATES; crate++)
+	{
+		level.AddCrate(crate * 100 - 150, crate * 7, crate + 1, 0.25f * crate, 0.3f + 0.1f * crate);
+	}
+	if (!level.Write(levelPath))
+	{
+		return false;
+	}
+
+	file = fopen(TEST_LEVEL_PATH, "rb");
+	if (file == NULL)
+	{
+		return false;
+	}
+	fseek(file, 0, SEEK_END);
+	size = ftell(file);
+	fseek(file, 0, SEEK_SET);
+	bytes.resize(size);
+	size = (long)fread(bytes.data(), 1, bytes.size(), file);
+	fclose(file);
+
+	return size == (long)bytes.size();
+}
+
+
+
+/*
+Name:	OpensAfter()
+Params:
+	const std::vector<unsigned char>& bytes - A valid level.
+	size_t size - How many of its bytes to keep.
+	void (*damage)(UFRLevelHeader* header, unsigned char* bytes) - Changes the copy before it is written, or NULL.
+Return: bool - Whether Open accepts the changed level.
+Description:
+	This writes a changed copy of a level and tries to open it.
+*/
+static bool OpensAfter(const std::vector<unsigned char>& bytes, size_t size, void (*damage)(UFRLevelHeader* header, unsigned char* bytes))
+{
+	std::vector<unsigned char> damaged(bytes);
+	UFRLevel level;
+
+	if (damage != NULL)
+	{
+		damage((UFRLevelHeader*)damaged.data(), damaged.data());
+	}
+	WriteBytes(TEST_LEVEL_PATH, damaged, size);
+
+	return level.Open(levelPath);
+}
+
+
+
+/*
+Name:	OpensWithScale()
+Params:
+	const std::vector<unsigned char>& bytes - A valid level.
+	float scale - The scale to give the last crate.
+Return: bool - Whether Open accepts the level with that scale.
+Description:
+	This writes a level whose last crate has the given scale and tries to open it.
+*/
+static bool OpensWithScale(const std::vector<unsigned char>& bytes, float scale)
+{
+	std::vector<unsigned char> changed(bytes);
+	const UFRLevelHeader* header = (const UFRLevelHeader*)changed.data();
+	UFRLevel level;
+
+	memcpy(&changed[header->arrayOffsets[LEVEL_ARRAY_SCALES] + (TEST_CRATES - 1) * sizeof(float)], &scale, sizeof(float));
+	WriteBytes(TEST_LEVEL_PATH, changed, changed.size());
+
+	return level.Open(levelPath);
+}
+
+
+
+/*
+Name:	TestRoundTrip()
+Params: const std::vector<unsigned char>& bytes - The level WriteGoodLevel wrote.
+Return: void
+Description:
+	A written level opens with every crate as it was added.
+*/
+static void TestRoundTrip(const std::vector<unsigned char>& bytes)
+{
+	UFRLevel level;
+	bool same = true;
+
+	WriteBytes(TEST_LEVEL_PATH, bytes, bytes.size());
+	CHECK(level.Open(levelPath));
+	CHECK(level.GetCrateCount() == TEST_CRATES);
+
+	for (int crate = 0; crate < level.GetCrateCount(); crate++)
+	{
+		same = same && level.GetLefts()[crate] == crate * 100 - 150 && level.GetBottoms()[crate] == crate * 7 &&
+			level.GetWeights()[crate] == crate + 1 && level.GetForcesGiven()[crate] == 0.25f * crate &&
+			level.GetScales()[crate] == 0.3f + 0.1f * crate;
+	}
+	CHECK(same);
+}
+
+
+
+/*
+Name:	TestDamagedFiles()
+Params: const std::vector<unsigned char>& bytes - The level WriteGoodLevel wrote.
+Return: void
+Description:
+	Open turns down a level that is cut short, has a bad header, or has an array that is misaligned or outside the file.
+*/
+static void TestDamagedFiles(const std::vector<unsigned char>& bytes)
+{
+	CHECK(OpensAfter(bytes, bytes.size(), NULL));
+
+	// Cut short, in the header and in the last array
+	CHECK(!OpensAfter(bytes, sizeof(UFRLevelHeader) - 1, NULL));
+	CHECK(!OpensAfter(bytes, bytes.size() - 1, NULL));
+	CHECK(!OpensAfter(bytes, 0, NULL));
+
+	CHECK(!OpensAfter(bytes, bytes.size(), [](UFRLevelHeader* header, unsigned char*) { header->magic[0] = 'X'; }));
+	CHECK(!OpensAfter(bytes, bytes.size(), [](UFRLevelHeader* header, unsigned char*) { header->version++; }));
+	CHECK(!OpensAfter(bytes, bytes.size(), [](UFRLevelHeader* header, unsigned char*) { header->crateCount = -1; }));
+	CHECK(!OpensAfter(bytes, bytes.size(), [](UFRLevelHeader* header, unsigned char*) { header->crateCount = 0x7FFFFFFF; }));
+
+	// Arrays that are misaligned, start past the end, run past the end or would wrap the offset
+	CHECK(!OpensAfter(bytes, bytes.size(), [](UFRLevelHeader* header, unsigned char*) { header->arrayOffsets[LEVEL_ARRAY_LEFTS] += 1; }));
+	CHECK(!OpensAfter(bytes, bytes.size(), [](UFRLevelHeader* header, unsigned char*) { header->arrayOffsets[LEVEL_ARRAY_BOTTOMS] = 1ULL << 40; }));
+	CHECK(!OpensAfter(bytes, bytes.size(), [](UFRLevelHeader* header, unsigned char*)
+	{
+		header->arrayOffsets[LEVEL_ARRAY_FORCES_GIVEN] = header->arrayOffsets[LEVEL_ARRAY_SCALES] + sizeof(float);
+	}));
+	CHECK(!OpensAfter(bytes, bytes.size(), [](UFRLevelHeader* header, unsigned char*) { header->arrayOffsets[LEVEL_ARRAY_SCALES] = 0xFFFFFFFFFFFFFFFCULL; }));
+
+	// An array may overlap another as long as it is inside the file
+	CHECK(OpensAfter(bytes, bytes.size(), [](UFRLevelHeader* header, unsigned char*)
+	{
+		header->arrayOffsets[LEVEL_ARRAY_BOTTOMS] = header->arrayOffsets[LEVEL_ARRAY_LEFTS];
+	}));
+}
+
+
+
+/*
+Name:	TestCrates()
+Params: const std::vector<unsigned char>& bytes - The level WriteGoodLevel wrote.
+Return: void
+Description:
+	Open turns down a crate with no weight or with a scale that is not a positive number up to LEVEL_MAX_SCALE.
+*/
+static void TestCrates(const std::vector<unsigned char>& bytes)
+{
+	CHECK(!OpensAfter(bytes, bytes.size(), [](UFRLevelHeader* header, unsigned char* data)
+	{
+		memset(data + header->arrayOffsets[LEVEL_ARRAY_WEIGHTS], 0, sizeof(unsigned int));
+	}));
+
+	CHECK(OpensWithScale(bytes, LEVEL_MAX_SCALE));
+	CHECK(!OpensWithScale(bytes, 0));
+	CHECK(!OpensWithScale(bytes, -1));
+	CHECK(!OpensWithScale(bytes, LEVEL_MAX_SCALE * 1.01f));
+	CHECK(!OpensWithScale(bytes, 1e30f));
+	CHECK(!OpensWithScale(bytes, std::numeric_limits<float>::infinity()));
+	CHECK(!OpensWithScale(bytes, std::numeric_limits<float>::quiet_NaN()));
+}
+
+
+
+/*
+Name:	TestParse()
+Params: void
+Return: void
+Description:
+	A text level takes comments and blank lines, and stops at the first line that is not a valid crate.
+*/
+static void TestParse()
+{
+	const char* badLines[] = { "10 20 0 0.5 0.4", "10 20 5 0.5 0", "10 20 5 0.5 inf", "10 20 5 0.5 nan", "10 20 5 0.5 1e30", "10 20 5 0.5", "10 20 5 0.5 0.4 7" };
+	UFRLevel level;
+	FILE* file;
+
+	file = fopen(TEST_TEXT_PATH, "w");
+	fprintf(file, "# A level\n\n10 20 5 0.5 0.4 # crate\n-30 0 1 0 8\n");
+	fclose(file);
+	CHECK(level.Parse(textPath));
+	CHECK(level.GetCrateCount() == 2);
+	CHECK(level.GetLefts()[1] == -30 && level.GetScales()[1] == 8);
+
+	for (int bad = 0; bad < sizeof(badLines) / sizeof(badLines[0]); bad++)
+	{
+		file = fopen(TEST_TEXT_PATH, "w");
+		fprintf(file, "10 20 5 0.5 0.4\n%s\n", badLines[bad]);
+		fclose(file);
+		CHECK(!level.Parse(textPath));
+		CHECK(level.GetErrorLine() == 2);
+	}
+}
+
+
+
+/*
+Name:	main()
+Params: void
+Return: int - 0 if every test passed, or 1.
+Description:
+	This runs every test of the level and removes the files they wrote.
+*/
+int main()
+{
+	std::vector<unsigned char> bytes;
+
+	CHECK(WriteGoodLevel(bytes));
+	if (!bytes.empty())
+	{
+		TestRoundTrip(bytes);
+		TestDamagedFiles(bytes);
+		TestCrates(bytes);
+	}
+	TestParse();
+
+	remove(TEST_LEVEL_PATH);
+	remove(TEST_TEXT_PATH);
+
+	return UFRTest::Finish("UFRLevelTest");
+}
@@ -0,0 +1,281 @@
+/*
+File:		UFRMixerTest.cpp
+Project:	Unhappy Flying Reptiles
+Author(s):	Jorge Ramirez
+Description:
+	This file contains the tests of how the UFRMixer class gives out its voices, run headless through Render.
+	The sounds hold one value each, chosen so every sum the mixer makes is exact in floats.
+*/
+
+#include "UFRTest.h"
+#include "UFRMixer.h"
+#include <vector>
+
+#define TEST_SOUND_FRAMES (MIXER_BLOCK_FRAMES * 4)
+#define TEST_SHORT_FRAMES (MIXER_BLOCK_FRAMES + 10) // Ends ten frames into the second block
+#define TEST_LONG_FRAMES (MIXER_MERGE_FRAMES + MIXER_BLOCK_FRAMES * 4)
+#define TEST_QUIET_VALUE (1.0f / 64) // Sixteen voices of it add up without clipping
+
+
+/*
+Name: UFRBlockOutput
+Inherit: public UFRAudioOutput
+Description:
+	This class is an output that is not real time and keeps the last block it was given, so a test can look at it.
+*/
+class UFRBlockOutput : public UFRAudioOutput
+{
+public:
+	std::vector<float> block;
+	unsigned long long framesWritten;
+	int writes;
+
+	UFRBlockOutput() { framesWritten = 0; writes = 0; }
+
+	bool Open(int, int) { return true; }
+	bool Write(const float* samples, int frameCount)
+	{
+		block.assign(samples, samples + frameCount * MIXER_CHANNELS);
+		framesWritten += frameCount;
+		writes++;
+		return true;
+	}
+	void Close() {}
+	bool IsRealTime() { return false; }
+};
+
+
+/*
+Name: UFRTestSounds
+Description:
+	Sounds that hold one value for every sample, kept for as long as the mixer that plays them.
+*/
+class UFRTestSounds
+{
+private:
+	std::vector<std::vector<float> > samples;
+
+public:
+	// Returns the number the mixer gives the sound
+	int Add(UFRMixer* mixer, int frameCount, int channels, float left, float right, int priority)
+	{
+		samples.push_back(std::vector<float>(frameCount * channels, left));
+		if (channels == MIXER_CHANNELS)
+		{
+			for (int frame = 0; frame < frameCount; frame++)
+			{
+				samples.back()[frame * MIXER_CHANNELS + 1] = right;
+			}
+		}
+
+		return mixer->AddSound(&samples.back()[0], frameCount, channels, priority);
+	}
+};
+
+
+
+/*
+Name:	BlockHolds()
+Params:
+	const UFRBlockOutput& output - The output.
+	int firstFrame - The first frame to look at.
+	int lastFrame - One past the last frame to look at.
+	float left - The value every left sample should have.
+	float right - The value every right sample should have.
+Return: bool - Whether the frames of the last block hold the values.
+Description:
+	This looks at part of the last block the mixer wrote.
+*/
+static bool BlockHolds(const UFRBlockOutput& output, int firstFrame, int lastFrame, float left, float right)
+{
+	if (output.block.size() != MIXER_BLOCK_FRAMES * MIXER_CHANNELS)
+	{
+		return false;
+	}
+
+	for (int frame = firstFrame; frame < lastFrame; frame++)
+	{
+		if (output.block[frame * MIXER_CHANNELS] != left || output.block[frame * MIXER_CHANNELS + 1] != right)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+
+
+/*
+Name:	TestMix()
+Params: void
+Return: void
+Description:
+	A mono voice goes to both channels and a stereo one keeps its channels, each at its volume.
+	A voice that ends part way through a block leaves the rest of it silent and is freed.
+	Render only mixes whole blocks and carries the rest over.
+*/
+static void TestMix()
+{
+	UFRBlockOutput output;
+	UFRMixer mixer(&output, NULL);
+	UFRTestSounds sounds;
+	UFRSoundQueue* queue = mixer.CreateQueue();
+	int mono = sounds.Add(&mixer, TEST_SHORT_FRAMES, 1, 0.25f, 0, 0);
+	int stereo = sounds.Add(&mixer, TEST_SHORT_FRAMES, MIXER_CHANNELS, 0.125f, -0.0625f, 0);
+
+	queue->Play(mono, 1);
+	queue->Play(stereo, 0.5f);
+	mixer.Render(MIXER_BLOCK_FRAMES / 2);
+	CHECK(output.writes == 0);
+
+	mixer.Render(MIXER_BLOCK_FRAMES / 2);
+	CHECK(output.writes == 1);
+	CHECK(BlockHolds(output, 0, MIXER_BLOCK_FRAMES, 0.3125f, 0.21875f));
+
+	mixer.Render(MIXER_BLOCK_FRAMES);
+	CHECK(BlockHolds(output, 0, TEST_SHORT_FRAMES - MIXER_BLOCK_FRAMES, 0.3125f, 0.21875f));
+	CHECK(BlockHolds(output, TEST_SHORT_FRAMES - MIXER_BLOCK_FRAMES, MIXER_BLOCK_FRAMES, 0, 0));
+	CHECK(mixer.GetVoiceBlocksMixed() == 4);
+
+	// Both voices were freed, so the next block mixes none
+	mixer.Render(MIXER_BLOCK_FRAMES);
+	CHECK(BlockHolds(output, 0, MIXER_BLOCK_FRAMES, 0, 0));
+	CHECK(mixer.GetVoiceBlocksMixed() == 4);
+	CHECK(output.framesWritten == 3 * MIXER_BLOCK_FRAMES);
+	CHECK(mixer.GetMergedVoices() == 0 && mixer.GetStolenVoices() == 0 && mixer.GetDroppedVoices() == 0);
+}
+
+
+
+/*
+Name:	TestMerge()
+Params: void
+Return: void
+Description:
+	A sound triggered again within MIXER_MERGE_FRAMES of starting makes its voice louder, up to MIXER_MAX_VOLUME,
+	and one triggered later gets a voice of its own. A block that adds up past full scale is clipped.
+*/
+static void TestMerge()
+{
+	UFRBlockOutput output;
+	UFRMixer mixer(&output, NULL);
+	UFRTestSounds sounds;
+	UFRSoundQueue* queue = mixer.CreateQueue();
+	int sound = sounds.Add(&mixer, TEST_LONG_FRAMES, 1, 0.25f, 0, 0);
+	int loud = sounds.Add(&mixer, TEST_SOUND_FRAMES, 1, 0.75f, 0, 0);
+
+	queue->Play(sound, 0.5f);
+	queue->Play(sound, 0.25f);
+	mixer.Render(MIXER_BLOCK_FRAMES);
+	CHECK(mixer.GetMergedVoices() == 1);
+	CHECK(BlockHolds(output, 0, MIXER_BLOCK_FRAMES, 0.1875f, 0.1875f));
+
+	// Still within the merge window, and capped
+	queue->Play(sound, 1.5f);
+	mixer.Render(MIXER_BLOCK_FRAMES);
+	CHECK(mixer.GetMergedVoices() == 2);
+	CHECK(BlockHolds(output, 0, MIXER_BLOCK_FRAMES, 0.25f * MIXER_MAX_VOLUME, 0.25f * MIXER_MAX_VOLUME));
+
+	// Past the merge window the trigger starts a second voice
+	mixer.Render(MIXER_MERGE_FRAMES);
+	queue->Play(sound, 1);
+	mixer.Render(MIXER_BLOCK_FRAMES);
+	CHECK(mixer.GetMergedVoices() == 2);
+	CHECK(BlockHolds(output, 0, MIXER_BLOCK_FRAMES, 0.25f * MIXER_MAX_VOLUME + 0.25f, 0.25f * MIXER_MAX_VOLUME + 0.25f));
+
+	queue->Play(loud, 1);
+	mixer.Render(MIXER_BLOCK_FRAMES);
+	CHECK(BlockHolds(output, 0, MIXER_BLOCK_FRAMES, 1, 1));
+	CHECK(mixer.GetStolenVoices() == 0 && mixer.GetDroppedVoices() == 0);
+}
+
+
+
+/*
+Name:	TestSteal()
+Params: void
+Return: void
+Description:
+	With every voice busy, a sound takes the voice of the lowest priority sound, then the quietest,
+	even from a sound of its own priority, and is dropped when every playing sound matters more.
+*/
+static void TestSteal()
+{
+	UFRBlockOutput output;
+	UFRMixer mixer(&output, NULL);
+	UFRTestSounds sounds;
+	UFRSoundQueue* queue = mixer.CreateQueue();
+	int voiceSounds[MIXER_VOICE_COUNT];
+	int same;
+	int lower;
+	int higher;
+	float expected;
+
+	for (int voice = 0; voice < MIXER_VOICE_COUNT; voice++)
+	{
+		voiceSounds[voice] = sounds.Add(&mixer, TEST_LONG_FRAMES, 1, TEST_QUIET_VALUE, 0, voice == 3 ? 0 : 1);
+	}
+	same = sounds.Add(&mixer, TEST_LONG_FRAMES, 1, 0.0625f, 0, 1);
+	lower = sounds.Add(&mixer, TEST_LONG_FRAMES, 1, 0.125f, 0, 0);
+	higher = sounds.Add(&mixer, TEST_LONG_FRAMES, 1, 0.25f, 0, 2);
+
+	// Every voice busy, the one of priority 0 the loudest and voice 5 the quietest
+	for (int voice = 0; voice < MIXER_VOICE_COUNT; voice++)
+	{
+		queue->Play(voiceSounds[voice], voice == 3 ? 2.0f : voice == 5 ? 0.5f : 1.0f);
+	}
+	mixer.Render(MIXER_BLOCK_FRAMES);
+	expected = (MIXER_VOICE_COUNT - 2) * TEST_QUIET_VALUE + 2 * TEST_QUIET_VALUE + 0.5f * TEST_QUIET_VALUE;
+	CHECK(BlockHolds(output, 0, MIXER_BLOCK_FRAMES, expected, expected));
+
+	// The lowest priority goes first, however loud
+	queue->Play(higher, 1);
+	mixer.Render(MIXER_BLOCK_FRAMES);
+	expected += 0.25f - 2 * TEST_QUIET_VALUE;
+	CHECK(mixer.GetStolenVoices() == 1);
+	CHECK(BlockHolds(output, 0, MIXER_BLOCK_FRAMES, expected, expected));
+
+	// Then the quietest of equal priority
+	queue->Play(same, 1);
+	mixer.Render(MIXER_BLOCK_FRAMES);
+	expected += 0.0625f - 0.5f * TEST_QUIET_VALUE;
+	CHECK(mixer.GetStolenVoices() == 2);
+	CHECK(BlockHolds(output, 0, MIXER_BLOCK_FRAMES, expected, expected));
+
+	// Nothing playing matters less than a priority 0 sound
+	queue->Play(lower, 1);
+	mixer.Render(MIXER_BLOCK_FRAMES);
+	CHECK(mixer.GetStolenVoices() == 2);
+	CHECK(mixer.GetDroppedVoices() == 1);
+	CHECK(BlockHolds(output, 0, MIXER_BLOCK_FRAMES, expected, expected));
+
+	// Stopping a sound frees its voice for the one that was dropped
+	queue->Stop(same);
+	queue->Play(lower, 1);
+	mixer.Render(MIXER_BLOCK_FRAMES);
+	expected += 0.125f - 0.0625f;
+	CHECK(mixer.GetStolenVoices() == 2);
+	CHECK(mixer.GetDroppedVoices() == 1);
+	CHECK(BlockHolds(output, 0, MIXER_BLOCK_FRAMES, expected, expected));
+	CHECK(mixer.GetMergedVoices() == 0);
+	CHECK(mixer.GetDroppedCommands() == 0);
+}
+
+
+
+/*
+Name:	main()
+Params: void
+Return: int - 0 if every test passed, or 1.
+Description:
+	This runs every test of the mixer.
+*/
+int main()
+{
+	TestMix();
+	TestMerge();
+	TestSteal();
+
+	return UFRTest::Finish("UFRMixerTest");
+}
@@ -0,0 +1,51 @@
+/*
+File:		UFRTest.h
+Project:	Unhappy Flying Reptiles
+Author(s):	Jorge Ramirez
+Description:
+	This file contains the class definition for the UFRTest class, the checks the tests are written with.
+*/
+
+#pragma once
+#include <stdio.h>
+
+#define CHECK(condition) UFRTest::Check(condition, #condition, __FILE__, __LINE__)
+
+
+/*
+Name: UFRTest
+Description:
+	This class is designed to count the checks of one test program that fail, printing each as it fails,
+	so every check runs even after one has failed. Each test is its own program, run by ctest.
+*/
+class UFRTest
+{
+public:
+	static int& GetFailures()
+	{
+		static int failures = 0;
+		return failures;
+	}
+
+	static void Check(bool condition, const char* text, const char* file, int line)
+	{
+		if (!condition)
+		{
+			printf("FAILED %s:%d: %s\n", file, line, text);
+			GetFailures()++;
+		}
+	}
+
+	// The exit code of the test program
+	static int Finish(const char* name)
+	{
+		if (GetFailures() > 0)
+		{
+			printf("%s: %d checks failed\n", name, GetFailures());
+			return 1;
+		}
+
+		printf("%s: all tests passed\n", name);
+		return 0;
+	}
+};
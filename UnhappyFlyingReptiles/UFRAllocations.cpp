@@ -0,0 +1,345 @@
+/*
+File:		UFRAllocations.cpp
+Project:	Unhappy Flying Reptiles
+Author(s):	Jorge Ramirez
+Description:
+	This file contains the replacements for the global operator new and delete
+	and the method definitions for the UFRAllocations, UFRAllocationStats and UFRAllocationScope classes.
+*/
+
+#include "UFRAllocations.h"
+#include <stdlib.h>
+#include <assert.h>
+#include <new>
+#include <atomic>
+
+#ifdef _WIN32
+#define ALLOCATIONS_THREAD_LOCAL __declspec(thread)
+#else
+#define ALLOCATIONS_THREAD_LOCAL __thread
+#endif
+
+// Plain values, so they are ready before any constructor runs
+static ALLOCATIONS_THREAD_LOCAL unsigned long long threadAllocations = 0;
+static ALLOCATIONS_THREAD_LOCAL unsigned long long threadBytes = 0;
+static ALLOCATIONS_THREAD_LOCAL bool threadForbidden = false;
+static std::atomic<unsigned int> forbiddenCount(0);
+
+
+/*
+Name:	operator new()
+Params: size_t size - The number of bytes to allocate.
+Return: void* - The memory.
+Description:
+	The global operator new, counting the allocation. It throws std::bad_alloc when there is no memory left.
+*/
+void* operator new(size_t size)
+{
+	void* memory;
+
+	UFRAllocations::Count(size);
+	memory = malloc(size > 0 ? size : 1);
+	if (memory == NULL)
+	{
+		throw std::bad_alloc();
+	}
+
+	return memory;
+}
+
+
+
+/*
+Name:	operator new[]()
+Params: size_t size - The number of bytes to allocate.
+Return: void* - The memory.
+Description:
+	The global operator new for arrays, counted like single objects.
+*/
+void* operator new[](size_t size)
+{
+	return operator new(size);
+}
+
+
+
+/*
+Name:	operator new()
+Params:
+	size_t size - The number of bytes to allocate.
+	const std::nothrow_t& - Marks the version that does not throw.
+Return: void* - The memory, or NULL when there is no memory left.
+Description:
+	The global operator new that does not throw, counting the allocation.
+*/
+void* operator new(size_t size, const std::nothrow_t&) throw()
+{
+	UFRAllocations::Count(size);
+	return malloc(size > 0 ? size : 1);
+}
+
+
+
+/*
+Name:	operator new[]()
+Params:
+	size_t size - The number of bytes to allocate.
+	const std::nothrow_t& - Marks the version that does not throw.
+Return: void* - The memory, or NULL when there is no memory left.
+Description:
+	The global operator new for arrays that does not throw.
+*/
+void* operator new[](size_t size, const std::nothrow_t& nothrow) throw()
+{
+	return operator new(size, nothrow);
+}
+
+
+
+/*
+Name:	operator delete()
+Params: void* memory - Memory from operator new, or NULL.
+Return: void
+Description:
+	The global operator delete. Freeing is not counted.
+*/
+void operator delete(void* memory) throw()
+{
+	free(memory);
+}
+
+
+
+/*
+Name:	operator delete[]()
+Params: void* memory - Memory from operator new[], or NULL.
+Return: void
+Description:
+	The global operator delete for arrays.
+*/
+void operator delete[](void* memory) throw()
+{
+	free(memory);
+}
+
+
+
+/*
+Name:	operator delete()
+Params:
+	void* memory - Memory from the operator new that does not throw, or NULL.
+	const std::nothrow_t& - Marks the version that does not throw.
+Return: void
+Description:
+	The global operator delete called when a constructor throws after the operator new that does not throw.
+*/
+void operator delete(void* memory, const std::nothrow_t&) throw()
+{
+	free(memory);
+}
+
+
+
+/*
+Name:	operator delete[]()
+Params:
+	void* memory - Memory from the operator new[] that does not throw, or NULL.
+	const std::nothrow_t& - Marks the version that does not throw.
+Return: void
+Description:
+	The global operator delete for arrays called when a constructor throws after the operator new[] that does not throw.
+*/
+void operator delete[](void* memory, const std::nothrow_t&) throw()
+{
+	free(memory);
+}
+
+
+
+/*
+Name:	Count()
+Params: size_t size - The number of bytes being allocated.
+Return: void
+Description:
+	This method counts an allocation on the calling thread.
+	An allocation on a thread that forbade them only fails the assertion once, and is allowed again afterwards,
+	so the assertion itself and the rest of the scope can still allocate.
+*/
+void UFRAllocations::Count(size_t size)
+{
+	threadAllocations++;
+	threadBytes += size;
+
+	if (threadForbidden)
+	{
+		threadForbidden = false;
+		forbiddenCount++;
+		assert(!"Allocation while allocations are forbidden on this thread");
+	}
+}
+
+
+
+/*
+Name:	GetThreadCounts()
+Params: void
+Return: UFRAllocationCounts - Every allocation the calling thread has made so far.
+Description:
+	This method reads the counts of the calling thread. The difference between two readings is what was allocated in between.
+*/
+UFRAllocationCounts UFRAllocations::GetThreadCounts()
+{
+	UFRAllocationCounts counts;
+
+	counts.allocations = threadAllocations;
+	counts.bytes = threadBytes;
+
+	return counts;
+}
+
+
+
+/*
+Name:	Add()
+Params: const UFRAllocationCounts& counts - Allocations other threads made on behalf of the calling thread.
+Return: void
+Description:
+	This method counts allocations on the calling thread that were made for it elsewhere, such as by the batches of a parallel for.
+	They were already checked against forbidding where they were made.
+*/
+void UFRAllocations::Add(const UFRAllocationCounts& counts)
+{
+	threadAllocations += counts.allocations;
+	threadBytes += counts.bytes;
+}
+
+
+
+/*
+Name:	Forbid()
+Params: bool forbidden - Whether the calling thread may not allocate from now on.
+Return: void
+Description:
+	This method forbids or allows allocations on the calling thread. Other threads are not affected.
+*/
+void UFRAllocations::Forbid(bool forbidden)
+{
+	threadForbidden = forbidden;
+}
+
+
+
+/*
+Name:	IsForbidden()
+Params: void
+Return: bool - Whether the calling thread may not allocate.
+Description:
+	This method returns what the calling thread last passed to Forbid, unless a forbidden allocation has since cleared it.
+*/
+bool UFRAllocations::IsForbidden()
+{
+	return threadForbidden;
+}
+
+
+
+/*
+Name:	GetForbiddenCount()
+Params: void
+Return: unsigned int - The number of allocations made on any thread while they were forbidden.
+Description:
+	This method counts the assertions that failed, or would have in a debug build.
+*/
+unsigned int UFRAllocations::GetForbiddenCount()
+{
+	return forbiddenCount;
+}
+
+
+
+/*
+Name:	UFRAllocationStats()
+Params: void
+Description:
+	Constructor for the UFRAllocationStats class. Nothing is recorded yet.
+*/
+UFRAllocationStats::UFRAllocationStats()
+{
+	count = 0;
+	allocatingCount = 0;
+	totalAllocations = 0;
+	totalBytes = 0;
+	maxAllocations = 0;
+	maxBytes = 0;
+}
+
+
+
+/*
+Name:	Record()
+Params: const UFRAllocationCounts& counts - What one run of the work allocated.
+Return: void
+Description:
+	This method adds one run of the work.
+*/
+void UFRAllocationStats::Record(const UFRAllocationCounts& counts)
+{
+	count++;
+	if (counts.allocations > 0)
+	{
+		allocatingCount++;
+	}
+	totalAllocations += counts.allocations;
+	totalBytes += counts.bytes;
+	if (counts.allocations > maxAllocations)
+	{
+		maxAllocations = counts.allocations;
+	}
+	if (counts.bytes > maxBytes)
+	{
+		maxBytes = counts.bytes;
+	}
+}
+
+
+
+/*
+Name:	UFRAllocationScope()
+Params:
+	UFRAllocationStats* scopeStats - Where the allocations of the scope are recorded, or NULL to not record them.
+	bool forbid - Whether the calling thread may not allocate until the end of the scope.
+Description:
+	Constructor for the UFRAllocationScope class.
+*/
+UFRAllocationScope::UFRAllocationScope(UFRAllocationStats* scopeStats, bool forbid)
+{
+	stats = scopeStats;
+	start = UFRAllocations::GetThreadCounts();
+	wasForbidden = UFRAllocations::IsForbidden();
+	if (forbid)
+	{
+		UFRAllocations::Forbid(true);
+	}
+}
+
+
+
+/*
+Name:	~UFRAllocationScope()
+Params: void
+Description:
+	Destructor for the UFRAllocationScope class.
+	The allocations since the scope started are recorded and the thread is allowed to allocate as it was before.
+*/
+UFRAllocationScope::~UFRAllocationScope()
+{
+	UFRAllocationCounts end = UFRAllocations::GetThreadCounts();
+
+	UFRAllocations::Forbid(wasForbidden);
+	if (stats != NULL)
+	{
+		end.allocations -= start.allocations;
+		end.bytes -= start.bytes;
+		stats->Record(end);
+	}
+}
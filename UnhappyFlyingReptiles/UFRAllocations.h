@@ -0,0 +1,101 @@
+/*
+File:		UFRAllocations.h
+Project:	Unhappy Flying Reptiles
+Author(s):	Jorge Ramirez
+Description:
+	This file contains the class definitions for the UFRAllocations, UFRAllocationStats and UFRAllocationScope classes.
+*/
+
+#pragma once
+#include <stddef.h>
+
+
+/*
+Name: UFRAllocationCounts
+Description:
+	How many times memory was allocated and how many bytes were asked for.
+*/
+struct UFRAllocationCounts
+{
+	unsigned long long allocations;
+	unsigned long long bytes;
+};
+
+
+/*
+Name: UFRAllocations
+Description:
+	This class is designed to count every allocation the game makes through new, so the ticks and frames
+	that allocate can be found. The global operator new and delete are replaced to count on the thread that allocates,
+	which takes no lock. Memory GDI+ and the system allocate on their own heaps is not seen.
+	A thread can forbid itself to allocate. An allocation it makes anyway is counted as forbidden and fails
+	an assertion in debug builds, stopping in the debugger where it was made.
+	Work a thread hands to UFRJobSystem::ParallelFor is counted and forbidden as its own, other jobs are not.
+	Nothing here depends on MFC.
+*/
+class UFRAllocations
+{
+public:
+	static void Count(size_t size);
+	static UFRAllocationCounts GetThreadCounts();
+	static void Add(const UFRAllocationCounts& counts);
+	static void Forbid(bool forbidden);
+	static bool IsForbidden();
+	static unsigned int GetForbiddenCount();
+};
+
+
+/*
+Name: UFRAllocationStats
+Description:
+	This class is designed to sum up the allocations of a repeating piece of work, such as a tick or a frame.
+	Only one thread may record at a time.
+*/
+class UFRAllocationStats
+{
+private:
+	unsigned int count;
+	unsigned int allocatingCount; // How many of them allocated at all
+	unsigned long long totalAllocations;
+	unsigned long long totalBytes;
+	unsigned long long maxAllocations;
+	unsigned long long maxBytes;
+
+	UFRAllocationStats(const UFRAllocationStats&);
+	UFRAllocationStats& operator=(const UFRAllocationStats&);
+
+public:
+	UFRAllocationStats();
+
+	void Record(const UFRAllocationCounts& counts);
+
+	unsigned int GetCount() { return count; }
+	unsigned int GetAllocatingCount() { return allocatingCount; }
+	double GetAverageAllocations() { return count > 0 ? (double)totalAllocations / count : 0; }
+	double GetAverageBytes() { return count > 0 ? (double)totalBytes / count : 0; }
+	unsigned long long GetMaxAllocations() { return maxAllocations; }
+	unsigned long long GetMaxBytes() { return maxBytes; }
+};
+
+
+/*
+Name: UFRAllocationScope
+Description:
+	This class is designed to record the allocations a thread makes from where it is made to the end of its scope,
+	optionally forbidding them. That includes parallel for batches other threads ran for it,
+	but not jobs it submitted and waited for on its own.
+*/
+class UFRAllocationScope
+{
+private:
+	UFRAllocationStats* stats;
+	UFRAllocationCounts start;
+	bool wasForbidden;
+
+	UFRAllocationScope(const UFRAllocationScope&);
+	UFRAllocationScope& operator=(const UFRAllocationScope&);
+
+public:
+	UFRAllocationScope(UFRAllocationStats* scopeStats, bool forbid);
+	~UFRAllocationScope();
+};
@@ -8,9 +8,20 @@ Description:
 
 #include <afxwin.h>
 #include "UFRMainWindow.h"
+#include "UFRCommandLineInfo.h"
+#include "UFRFrameCapture.h"
+#include "UFRPackCooker.h"
+#include "UFRWaveFileOutput.h"
+#include "UFRLevelGenerator.h"
+#include "UFRBenchmark.h"
+#include "UFRBenchmarks.h"
+#include <time.h>
 
 #define DEFAULT_WINDOW_WIDTH 640
 #define DEFAULT_WINDOW_HEIGHT 400
+#define MILLISECONDS_PER_SECOND 1000
+#define MICROSECONDS_PER_MILLISECOND 1000
+#define STRESS_LEVEL_FILE TEXT(".\\Stress.ufrl")
 
 using namespace Gdiplus;
 
@@ -20,26 +31,360 @@ Name: UFRApp
 Inherit: public CWinApp
 Description:
 	This class is designed to handle the creation of the Unhappy Flying Reptiles main app.
-	The window for the game is created here.
+	The window for the game is created here, unless the command line asks for a headless capture.
 */
 class UFRApp :public CWinApp
 {
 private:
 	UFRMainWindow *gameWindow;
 
+
+
+	/*
+	Name:	RunCapture()
+	Params: UFRCommandLineInfo& options - The capture options from the command line.
+	Return: void
+	Description:
+		This runs the game without a window as fast as it can, one frame per game tick,
+		and writes every frame to the capture output.
+		The game is seeded from the command line and plays no sound, so the same options always give the same frames.
+		The sound can be mixed to a WAV file instead, one tick of sound per frame, so it lines up with the frames.
+		With a trace file, the trace of the run is saved once the capture is closed.
+		With /noalloc, a tick or frame that allocates once the game has warmed up fails an assertion.
+		With /replay, the input saved by /record is applied in the ticks it was recorded in, and the game gets the recorded seed,
+		so the capture shows the game that was played on the same level.
+	*/
+	void RunCapture(UFRCommandLineInfo& options)
+	{
+		GdiplusStartupInput gdiplusStartupInput;
+		ULONG_PTR gdiplusToken;
+		UFRFrameCapture capture;
+		UFRInputRecording replay;
+		int nextInput = 0;
+		long long tickTime;
+		int format = options.captureFormat;
+		LARGE_INTEGER startTime, endTime, frequency;
+
+		if (options.IsReplaying())
+		{
+			if (!replay.Load(options.replayPath))
+			{
+				TRACE(TEXT("Replay: could not read %s, line %d\n"), (const TCHAR*)options.replayPath, replay.GetErrorLine());
+				return;
+			}
+			options.seed = replay.GetSeed();
+		}
+
+		GdiplusStartup(&gdiplusToken, &gdiplusStartupInput, NULL);
+		UFRTrace::NameThread("Capture");
+
+		UFRWaveFileOutput* audio = options.audioPath.GetLength() > 0 ? new UFRWaveFileOutput(options.audioPath) : NULL;
+		UFRGame* game = new UFRGame(options.seed, audio, NULL);
+		if (options.levelPath.GetLength() > 0)
+		{
+			game->SetLevel(options.levelPath);
+		}
+		if (options.forbidAllocations)
+		{
+			game->ForbidSteadyAllocations();
+		}
+		game->FinishLoading();
+		Rect imageRect(0, 0, game->GetImageWidth(), game->GetImageHeight());
+		BitmapData imageData;
+
+		if (format == CAPTURE_FORMAT_FROM_PATH)
+		{
+			format = UFRFrameCapture::FormatFromPath(options.capturePath);
+		}
+
+		if (capture.Open(options.capturePath, format, imageRect.Width, imageRect.Height, MILLISECONDS_PER_SECOND / GAME_LOOP_INTERVAL))
+		{
+			QueryPerformanceFrequency(&frequency);
+			QueryPerformanceCounter(&startTime);
+
+			for (int frame = 0; frame < options.captureFrames; frame++)
+			{
+				// Each tick ends one game loop interval after the last, and takes the input recorded in it
+				tickTime = (long long)(frame + 1) * GAME_LOOP_INTERVAL * MICROSECONDS_PER_MILLISECOND;
+				while (nextInput < replay.GetCount() && replay.GetInput(nextInput).tick <= game->GetTickIndex())
+				{
+					const UFRRecordedInput& input = replay.GetInput(nextInput);
+					game->ReplayInput(input.type, input.x, input.y, tickTime);
+					nextInput++;
+				}
+				game->CalcGameState(tickTime);
+				game->DrawLatestTick();
+
+				game->GetImage()->LockBits(&imageRect, ImageLockModeRead, PixelFormat32bppARGB, &imageData);
+				bool written = capture.WriteFrame((const unsigned int*)imageData.Scan0, imageData.Stride);
+				game->GetImage()->UnlockBits(&imageData);
+
+				if (!written)
+				{
+					break;
+				}
+			}
+
+			if (!capture.Close())
+			{
+				TRACE(TEXT("Capture: writing to %s failed\n"), (const TCHAR*)options.capturePath);
+			}
+
+			QueryPerformanceCounter(&endTime);
+			TRACE(TEXT("Capture: %u frames in %.2f s\n"), capture.GetFramesWritten(),
+				(double)(endTime.QuadPart - startTime.QuadPart) / frequency.QuadPart);
+
+			if (options.IsTracing() && !UFRTrace::Write(options.tracePath))
+			{
+				TRACE(TEXT("Trace: could not save %s\n"), (const TCHAR*)options.tracePath);
+			}
+		}
+		else
+		{
+			TRACE(TEXT("Capture: could not open %s\n"), (const TCHAR*)options.capturePath);
+		}
+
+		delete game;
+		GdiplusShutdown(gdiplusToken);
+	}
+
+
+
+
+	/*
+	Name:	BakeAtlas()
+	Params: const TCHAR* path - The file to save the atlas to.
+	Return: void
+	Description:
+		This is the build step for the sprite atlas. Any baked atlas or asset pack the game would load is removed first,
+		so every sprite is decoded and scaled from its source file, and the result is saved for later runs.
+	*/
+	void BakeAtlas(const TCHAR* path)
+	{
+		GdiplusStartupInput gdiplusStartupInput;
+		ULONG_PTR gdiplusToken;
+
+		GdiplusStartup(&gdiplusToken, &gdiplusStartupInput, NULL);
+		DeleteFile(PACK_FILE);
+		DeleteFile(ATLAS_FILE);
+
+		UFRGame* game = new UFRGame(0, NULL, NULL);
+		game->FinishLoading();
+		if (game->GetAtlas()->Save(path))
+		{
+			TRACE(TEXT("Atlas: %d sprites in a %dx%d image saved to %s\n"), game->GetAtlas()->GetSpriteCount(),
+				game->GetAtlas()->GetImage()->GetWidth(), game->GetAtlas()->GetImage()->GetHeight(), path);
+		}
+		else
+		{
+			TRACE(TEXT("Atlas: could not save %s\n"), path);
+		}
+
+		delete game;
+		GdiplusShutdown(gdiplusToken);
+	}
+
+
+
+	/*
+	Name:	CookPack()
+	Params: const TCHAR* path - The file to write the asset pack to.
+	Return: void
+	Description:
+		This is the build step for the asset pack. Like BakeAtlas, anything already cooked is removed first
+		so the game loads every asset from its source file, and then the loaded assets are written to the pack.
+	*/
+	void CookPack(const TCHAR* path)
+	{
+		GdiplusStartupInput gdiplusStartupInput;
+		ULONG_PTR gdiplusToken;
+		UFRPackCooker cooker;
+
+		GdiplusStartup(&gdiplusToken, &gdiplusStartupInput, NULL);
+		DeleteFile(PACK_FILE);
+		DeleteFile(ATLAS_FILE);
+
+		UFRGame* game = new UFRGame(0, NULL, NULL);
+		game->FinishLoading();
+		if (cooker.Cook(path, game))
+		{
+			TRACE(TEXT("Cook: %d assets written to %s\n"), cooker.GetEntryCount(), path);
+		}
+		else
+		{
+			TRACE(TEXT("Cook: could not write %s\n"), path);
+		}
+
+		delete game;
+		GdiplusShutdown(gdiplusToken);
+	}
+
+
+
+	/*
+	Name:	ConvertLevel()
+	Params:
+		const TCHAR* sourcePath - The text level to convert.
+		const TCHAR* path - The file to write the binary level to.
+	Return: void
+	Description:
+		This is the build step for levels. A level is authored as text and converted to the binary level the game maps.
+	*/
+	void ConvertLevel(const TCHAR* sourcePath, const TCHAR* path)
+	{
+		UFRLevel level;
+
+		if (!level.Parse(sourcePath))
+		{
+			if (level.GetErrorLine() > 0)
+			{
+				TRACE(TEXT("Level: %s line %d is not a crate\n"), sourcePath, level.GetErrorLine());
+			}
+			else
+			{
+				TRACE(TEXT("Level: could not read %s\n"), sourcePath);
+			}
+		}
+		else if (level.Write(path))
+		{
+			TRACE(TEXT("Level: %d crates written to %s\n"), level.GetCrateCount(), path);
+		}
+		else
+		{
+			TRACE(TEXT("Level: could not write %s\n"), path);
+		}
+	}
+
+
+
+	/*
+	Name:	GenerateLevel()
+	Params:
+		int crateCount - The number of crates in the level.
+		unsigned int seed - The seed of the layout.
+		const TCHAR* path - The file to write the binary level to.
+	Return: void
+	Description:
+		This writes a stress level, the standard workload for timing the game at scale.
+		A capture of it with /level is a repeatable performance run.
+	*/
+	void GenerateLevel(int crateCount, unsigned int seed, const TCHAR* path)
+	{
+		UFRLevel level;
+		UFRLevelGenerator generator(seed);
+
+		generator.Generate(&level, crateCount);
+		if (level.Write(path))
+		{
+			TRACE(TEXT("Level: %d crates generated from seed %u into %s\n"), level.GetCrateCount(), seed, path);
+		}
+		else
+		{
+			TRACE(TEXT("Level: could not write %s\n"), path);
+		}
+	}
+
+
+
+	/*
+	Name:	RunBenchmarks()
+	Params:
+		unsigned int seed - The seed of the stress levels and the flight AI.
+		const TCHAR* path - The JSON file to save the results to.
+	Return: void
+	Description:
+		This times every benchmark case and saves the results in the format of Google Benchmark,
+		so the results of two builds can be compared with its tools. Each result is traced as well.
+		A release build should be timed, with nothing else running.
+	*/
+	void RunBenchmarks(unsigned int seed, const TCHAR* path)
+	{
+		GdiplusStartupInput gdiplusStartupInput;
+		ULONG_PTR gdiplusToken;
+		UFRBenchmark benchmark(BENCHMARK_MIN_TIME);
+
+		GdiplusStartup(&gdiplusToken, &gdiplusStartupInput, NULL);
+
+		{
+			UFRBenchmarks benchmarks(seed);
+			benchmarks.Run(&benchmark);
+		}
+
+		for (int result = 0; result < benchmark.GetResultCount(); result++)
+		{
+			const UFRBenchmarkResult& timing = benchmark.GetResult(result);
+			TRACE(TEXT("Benchmark: %S %.0f ns, %.0f ns cpu, %lld iterations\n"), timing.name.c_str(), timing.realTime, timing.cpuTime, timing.iterations);
+		}
+
+		if (benchmark.Write(path))
+		{
+			TRACE(TEXT("Benchmark: %d results written to %s\n"), benchmark.GetResultCount(), path);
+		}
+		else
+		{
+			TRACE(TEXT("Benchmark: could not write %s\n"), path);
+		}
+
+		GdiplusShutdown(gdiplusToken);
+	}
+
 public:
 
 	/*
 	Name:	InitInstance()
 	Params: void
-	Return: BOOL - TRUE
+	Return: BOOL - TRUE, or FALSE after a headless capture, atlas bake, cook, level build or benchmark run so the app exits
 	Description:
 		This is executes during intialization of the CWinApp.
 		The main game window is created here and displayed.
 	*/
 	BOOL InitInstance()
 	{
-		gameWindow = new UFRMainWindow();
+		UFRCommandLineInfo options;
+		ParseCommandLine(options);
+
+		if (options.IsCooking())
+		{
+			CookPack(options.cookPath);
+			return FALSE;
+		}
+
+		if (options.IsConvertingLevel())
+		{
+			ConvertLevel(options.convertLevelPath, options.levelPath.GetLength() > 0 ? (const TCHAR*)options.levelPath : LEVEL_FILE);
+			return FALSE;
+		}
+
+		if (options.IsGeneratingLevel())
+		{
+			GenerateLevel(options.generateCrates, options.seed, options.levelPath.GetLength() > 0 ? (const TCHAR*)options.levelPath : STRESS_LEVEL_FILE);
+			return FALSE;
+		}
+
+		if (options.IsBenchmarking())
+		{
+			RunBenchmarks(options.seed, options.benchPath);
+			return FALSE;
+		}
+
+		if (options.IsBakingAtlas())
+		{
+			BakeAtlas(options.bakeAtlasPath);
+			return FALSE;
+		}
+
+		if (options.IsCapturing())
+		{
+			if (!options.seedGiven)
+			{
+				options.seed = (unsigned int)time(NULL);
+			}
+			RunCapture(options);
+			return FALSE;
+		}
+
+		gameWindow = new UFRMainWindow(options.IsTracing() ? (const TCHAR*)options.tracePath : NULL, options.forbidAllocations,
+			options.IsRecording() ? (const TCHAR*)options.recordPath : NULL);
 		m_pMainWnd = gameWindow;
 		m_pMainWnd->SetWindowPos(&CWnd::wndTop, 0, 0, DEFAULT_WINDOW_WIDTH, DEFAULT_WINDOW_HEIGHT, SWP_NOMOVE);
 		m_pMainWnd->ShowWindow(SW_SHOW);
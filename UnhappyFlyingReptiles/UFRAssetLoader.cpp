@@ -0,0 +1,108 @@
+/*
+File:		UFRAssetLoader.cpp
+Project:	Unhappy Flying Reptiles
+Author(s):	Jorge Ramirez
+Description:
+	This file contains the method definitions for the UFRAssetLoader class.
+*/
+
+#include "UFRAssetLoader.h"
+#include "UFRTrace.h"
+
+
+/*
+Name:	UFRAssetLoader()
+Params: UFRJobSystem* jobs - The job system that decodes the images. It must outlive the loader.
+Description:
+	Constructor for the UFRAssetLoader class.
+*/
+UFRAssetLoader::UFRAssetLoader(UFRJobSystem* jobs)
+{
+	jobSystem = jobs;
+	cancelled = std::make_shared<std::atomic<bool> >(false);
+}
+
+
+
+/*
+Name:	~UFRAssetLoader()
+Params: void
+Description:
+	Destructor for the UFRAssetLoader class.
+	Files that are being decoded finish, the jobs for the rest find the loader cancelled and drop their requests.
+*/
+UFRAssetLoader::~UFRAssetLoader()
+{
+	*cancelled = true;
+}
+
+
+
+/*
+Name:	DecodeImage()
+Params: const wchar_t* path - The image file to decode.
+Return: UFRImageFuture - Becomes ready with the decoded image.
+Description:
+	This method queues an image file to be decoded by the next free worker.
+*/
+UFRImageFuture UFRAssetLoader::DecodeImage(const wchar_t* path)
+{
+	std::wstring file(path);
+	std::shared_ptr<std::packaged_task<std::shared_ptr<Bitmap>()> > decode(
+		new std::packaged_task<std::shared_ptr<Bitmap>()>([file]()
+	{
+		UFRTraceZone decodeZone("DecodeImage");
+		return UFRSpriteManager::GetInstance()->Acquire(file.c_str());
+	}));
+	UFRImageFuture image = decode->get_future().share();
+
+	Queue(decode);
+	return image;
+}
+
+
+
+/*
+Name:	DecodeSprite()
+Params: const UFRSpriteRequest& sprite - The sprite file and the scale it is drawn at.
+Return: UFRImageFuture - Becomes ready with the sprite reduced to its scale.
+Description:
+	This method queues a sprite file to be decoded and reduced by the next free worker.
+*/
+UFRImageFuture UFRAssetLoader::DecodeSprite(const UFRSpriteRequest& sprite)
+{
+	UFRSpriteRequest request(sprite);
+	std::shared_ptr<std::packaged_task<std::shared_ptr<Bitmap>()> > decode(
+		new std::packaged_task<std::shared_ptr<Bitmap>()>([request]()
+	{
+		UFRTraceZone decodeZone("DecodeSprite");
+		return UFRSpriteManager::GetInstance()->AcquireScaled(request.path.c_str(), request.scale);
+	}));
+	UFRImageFuture image = decode->get_future().share();
+
+	Queue(decode);
+	return image;
+}
+
+
+
+/*
+Name:	Queue()
+Params: const std::shared_ptr<std::packaged_task<std::shared_ptr<Bitmap>()> >& decode - The decode to run.
+Return: void
+Description:
+	This method submits a decode as a job. If the loader is gone by the time the job runs the decode is dropped,
+	and releasing it breaks the promise of its future.
+*/
+void UFRAssetLoader::Queue(const std::shared_ptr<std::packaged_task<std::shared_ptr<Bitmap>()> >& decode)
+{
+	std::shared_ptr<std::atomic<bool> > loaderCancelled = cancelled;
+
+	jobSystem->Submit(jobSystem->Create([decode, loaderCancelled]()
+	{
+		if (!*loaderCancelled)
+		{
+			(*decode)();
+		}
+	}));
+}
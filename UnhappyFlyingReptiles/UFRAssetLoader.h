@@ -0,0 +1,50 @@
+/*
+File:		UFRAssetLoader.h
+Project:	Unhappy Flying Reptiles
+Author(s):	Jorge Ramirez
+Description:
+	This file contains the class definition for the UFRAssetLoader class.
+*/
+
+#pragma once
+#include "afxwin.h"
+#include <gdiplus.h>
+#include <string>
+#include <memory>
+#include <atomic>
+#include <future>
+#include "UFRSpriteManager.h"
+#include "UFRJobSystem.h"
+
+using namespace Gdiplus;
+
+typedef std::shared_future<std::shared_ptr<Bitmap> > UFRImageFuture;
+
+
+/*
+Name: UFRAssetLoader
+Description:
+	This class is designed to decode image files in the background as jobs on the job system.
+	Each request returns a future straight away, and the files are decoded in parallel in the order they were asked for.
+	Images are decoded through the sprite manager, so a file that is already loaded is only shared.
+	Sprites are reduced to the scale they are drawn at by the same job, so only the reduced copies wait to be used.
+	Requests that have not started when the loader is destroyed are dropped, and their futures report a broken promise.
+*/
+class UFRAssetLoader
+{
+private:
+	UFRJobSystem* jobSystem;
+	std::shared_ptr<std::atomic<bool> > cancelled; // Shared with the queued jobs, which outlive the loader
+
+	void Queue(const std::shared_ptr<std::packaged_task<std::shared_ptr<Bitmap>()> >& decode);
+
+	UFRAssetLoader(const UFRAssetLoader&);
+	UFRAssetLoader& operator=(const UFRAssetLoader&);
+
+public:
+	UFRAssetLoader(UFRJobSystem* jobs);
+	~UFRAssetLoader();
+
+	UFRImageFuture DecodeImage(const wchar_t* path);
+	UFRImageFuture DecodeSprite(const UFRSpriteRequest& sprite);
+};
@@ -0,0 +1,186 @@
+/*
+File:		UFRAssetPack.cpp
+Project:	Unhappy Flying Reptiles
+Author(s):	Jorge Ramirez
+Description:
+	This file contains the method definitions for the UFRAssetPack class.
+*/
+
+#include "UFRAssetPack.h"
+#include <string.h>
+#include <limits.h>
+
+#define BYTES_PER_PIXEL 4
+
+
+/*
+Name:	UFRAssetPack()
+Params: void
+Description:
+	Constructor for the UFRAssetPack class. Nothing is mapped until Open is called.
+*/
+UFRAssetPack::UFRAssetPack()
+{
+	file = INVALID_HANDLE_VALUE;
+	mapping = NULL;
+	base = NULL;
+	fileSize = 0;
+	index = NULL;
+	entryCount = 0;
+}
+
+
+
+/*
+Name:	~UFRAssetPack()
+Params: void
+Description:
+	Destructor for the UFRAssetPack class. The pack is unmapped.
+*/
+UFRAssetPack::~UFRAssetPack()
+{
+	Close();
+}
+
+
+
+/*
+Name:	Open()
+Params: const wchar_t* path - The pack file.
+Return: bool - Whether the file is a valid pack.
+Description:
+	This method maps a pack file and checks that its header and index fit inside it.
+*/
+bool UFRAssetPack::Open(const wchar_t* path)
+{
+	LARGE_INTEGER size;
+	const UFRPackHeader* header;
+
+	Close();
+
+	file = CreateFile(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+	if (file == INVALID_HANDLE_VALUE)
+	{
+		return false;
+	}
+
+	if (!GetFileSizeEx(file, &size) || size.QuadPart < sizeof(UFRPackHeader))
+	{
+		Close();
+		return false;
+	}
+	fileSize = size.QuadPart;
+
+	mapping = CreateFileMapping(file, NULL, PAGE_WRITECOPY, 0, 0, NULL);
+	if (mapping != NULL)
+	{
+		base = (BYTE*)MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, 0);
+	}
+	if (base == NULL)
+	{
+		Close();
+		return false;
+	}
+
+	header = (const UFRPackHeader*)base;
+	if (memcmp(header->magic, PACK_MAGIC, sizeof(header->magic)) != 0 || header->version != PACK_VERSION ||
+		header->entryCount < 0 || header->indexOffset > fileSize ||
+		(fileSize - header->indexOffset) / sizeof(UFRPackEntry) < (unsigned long long)header->entryCount)
+	{
+		Close();
+		return false;
+	}
+
+	index = (const UFRPackEntry*)(base + header->indexOffset);
+	entryCount = header->entryCount;
+
+	for (int entry = 0; entry < entryCount; entry++)
+	{
+		if (index[entry].offset > fileSize || index[entry].size > fileSize - index[entry].offset)
+		{
+			Close();
+			return false;
+		}
+	}
+
+	return true;
+}
+
+
+
+/*
+Name:	Close()
+Params: void
+Return: void
+Description:
+	This method unmaps the pack. Any views of it must no longer be used.
+*/
+void UFRAssetPack::Close()
+{
+	if (base != NULL)
+	{
+		UnmapViewOfFile(base);
+		base = NULL;
+	}
+	if (mapping != NULL)
+	{
+		CloseHandle(mapping);
+		mapping = NULL;
+	}
+	if (file != INVALID_HANDLE_VALUE)
+	{
+		CloseHandle(file);
+		file = INVALID_HANDLE_VALUE;
+	}
+
+	index = NULL;
+	entryCount = 0;
+	fileSize = 0;
+}
+
+
+
+/*
+Name:	Find()
+Params: const char* name - The name the asset was cooked under.
+Return: const UFRPackEntry* - The index entry of the asset, or NULL if it is not in the pack.
+Description:
+	This method looks up an asset in the index.
+*/
+const UFRPackEntry* UFRAssetPack::Find(const char* name)
+{
+	for (int entry = 0; entry < entryCount; entry++)
+	{
+		if (strncmp(index[entry].name, name, PACK_NAME_LENGTH) == 0)
+		{
+			return &index[entry];
+		}
+	}
+
+	return NULL;
+}
+
+
+
+/*
+Name:	CreateImageView()
+Params: const char* name - The name the image was cooked under.
+Return: Bitmap* - A bitmap whose pixels are the pack itself, or NULL if there is no such image.
+Description:
+	This method wraps a cooked image in a bitmap without copying or decoding it.
+	The image must have a positive size whose row stride fits an int, with all its pixels inside the entry.
+	The bitmap must be deleted before the pack is closed.
+*/
+Bitmap* UFRAssetPack::CreateImageView(const char* name)
+{
+	const UFRPackEntry* entry = Find(name);
+
+	// A negative size would wrap in the product and pass the size check
+	if (entry == NULL || entry->type != PACK_ENTRY_IMAGE || entry->width <= 0 || entry->height <= 0 ||
+		entry->width > INT_MAX / BYTES_PER_PIXEL || entry->size < (unsigned long long)entry->width * entry->height * BYTES_PER_PIXEL)
+	{
+		return NULL;
+	}
+
+	return new Bitmap(entry->width, entry->height, entry->width * BYTES_PER_PIXEL, PixelFormat32bppPARGB, GetData(entry));
+}
@@ -0,0 +1,98 @@
+/*
+File:		UFRAssetPack.h
+Project:	Unhappy Flying Reptiles
+Author(s):	Jorge Ramirez
+Description:
+	This file contains the class definition for the UFRAssetPack class and the layout of a pack file.
+*/
+
+#pragma once
+#include "afxwin.h"
+#include <gdiplus.h>
+#include "UFRMixer.h"
+
+using namespace Gdiplus;
+
+#define PACK_FILE TEXT(".\\Assets.pack")
+#define PACK_MAGIC "UFRP"
+#define PACK_VERSION 1
+#define PACK_ALIGNMENT 4096 // Every entry starts on its own page
+#define PACK_NAME_LENGTH 64
+#define PACK_SAMPLE_RATE MIXER_SAMPLE_RATE // Sounds are cooked at the rate of the mixer
+
+#define PACK_ENTRY_IMAGE 0 // 32bpp PARGB pixels, width * 4 bytes per row
+#define PACK_ENTRY_ATLAS 1 // A sprite atlas as written by UFRSpriteAtlas::Write
+#define PACK_ENTRY_SOUND 2 // Interleaved 32 bit float samples at PACK_SAMPLE_RATE
+
+#define PACK_BACKDROP "backdrop"
+#define PACK_ATLAS "atlas"
+
+
+/*
+Name: UFRPackHeader
+Description:
+	The start of a pack file. The index of entries is at the end of the file, at indexOffset.
+*/
+struct UFRPackHeader
+{
+	char magic[4];
+	int version;
+	int entryCount;
+	int reserved;
+	unsigned long long indexOffset;
+};
+
+
+/*
+Name: UFRPackEntry
+Description:
+	One asset in the index of a pack file.
+	Images use width and height, sounds use channels and sampleRate.
+*/
+struct UFRPackEntry
+{
+	char name[PACK_NAME_LENGTH];
+	int type;
+	int width;
+	int height;
+	int channels;
+	int sampleRate;
+	int reserved;
+	unsigned long long offset; // From the start of the file, a multiple of PACK_ALIGNMENT
+	unsigned long long size; // In bytes
+};
+
+
+/*
+Name: UFRAssetPack
+Description:
+	This class is designed to map a cooked asset pack into memory and hand out views of its entries.
+	Nothing is read or decoded up front, pages are only loaded when an asset is first touched.
+	The file is mapped copy on write, so every running game shares the same physical pages
+	and a page is only copied if something writes to it.
+	Views are only valid while the pack is open.
+*/
+class UFRAssetPack
+{
+private:
+	HANDLE file;
+	HANDLE mapping;
+	BYTE* base;
+	unsigned long long fileSize;
+	const UFRPackEntry* index;
+	int entryCount;
+
+	UFRAssetPack(const UFRAssetPack&);
+	UFRAssetPack& operator=(const UFRAssetPack&);
+
+public:
+	UFRAssetPack();
+	~UFRAssetPack();
+
+	bool Open(const wchar_t* path);
+	void Close();
+
+	const UFRPackEntry* Find(const char* name);
+	BYTE* GetData(const UFRPackEntry* entry) { return base + entry->offset; }
+	Bitmap* CreateImageView(const char* name);
+};
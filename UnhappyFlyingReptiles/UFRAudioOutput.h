@@ -0,0 +1,53 @@
+/*
+File:		UFRAudioOutput.h
+Project:	Unhappy Flying Reptiles
+Author(s):	Jorge Ramirez
+Description:
+	This file contains the definitions of the UFRAudioOutput interface and the UFRNullOutput class.
+*/
+
+#pragma once
+
+
+/*
+Name: UFRAudioOutput
+Description:
+	This interface is where the mixer sends its blocks of interleaved float samples.
+	A real time output blocks in Write until the device has room, which paces the mixer thread.
+	Any other output takes blocks as fast as they come, and the game mixes one tick of sound per tick.
+	Nothing here depends on MFC.
+*/
+class UFRAudioOutput
+{
+public:
+	virtual ~UFRAudioOutput() {}
+
+	virtual bool Open(int sampleRate, int channels) = 0;
+	virtual bool Write(const float* samples, int frameCount) = 0;
+	virtual void Close() = 0;
+	virtual bool IsRealTime() = 0;
+};
+
+
+/*
+Name: UFRNullOutput
+Inherit: public UFRAudioOutput
+Description:
+	This class is designed to throw the mixed sound away, for headless runs and for timing the mixer.
+	It only counts the frames it was given.
+*/
+class UFRNullOutput : public UFRAudioOutput
+{
+private:
+	unsigned long long framesWritten;
+
+public:
+	UFRNullOutput() { framesWritten = 0; }
+
+	bool Open(int sampleRate, int channels) { return true; }
+	bool Write(const float* samples, int frameCount) { framesWritten += frameCount; return true; }
+	void Close() {}
+	bool IsRealTime() { return false; }
+
+	unsigned long long GetFramesWritten() { return framesWritten; }
+};
@@ -0,0 +1,271 @@
+/*
+File:		UFRBenchmark.cpp
+Project:	Unhappy Flying Reptiles
+Author(s):	Jorge Ramirez
+Description:
+	This file contains the method definitions for the UFRBenchmark class.
+*/
+
+#include "UFRBenchmark.h"
+#include "UFRAllocations.h"
+#include "UFRWaveFile.h"
+#include <stdio.h>
+#include <time.h>
+#include <thread>
+
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+#define NANOSECONDS_PER_MICROSECOND 1000
+#define MICROSECONDS_PER_SECOND 1000000
+#define FILETIME_UNITS_PER_MICROSECOND 10 // Thread times on Windows count in 100 ns
+
+
+/*
+Name:	UFRBenchmark()
+Params: long long caseTime - How long each case is timed for at least, in microseconds.
+Description:
+	Constructor for the UFRBenchmark class. No case has run yet.
+*/
+UFRBenchmark::UFRBenchmark(long long caseTime)
+{
+	minTime = caseTime;
+}
+
+
+
+/*
+Name:	Run()
+Params:
+	const char* name - The group and case, such as "Physics/Move".
+	int argument - The size the case runs at, such as the number of bodies. It ends the name of the result.
+	long long items - How many items one iteration works through, for the items per second.
+	const std::function<void()>& iteration - One iteration of the case.
+Return: void
+Description:
+	This method times a case that needs nothing done between its iterations.
+*/
+void UFRBenchmark::Run(const char* name, int argument, long long items, const std::function<void()>& iteration)
+{
+	Run(name, argument, items, std::function<void()>(), iteration);
+}
+
+
+
+/*
+Name:	Run()
+Params:
+	const char* name - The group and case, such as "Physics/Move".
+	int argument - The size the case runs at, such as the number of bodies. It ends the name of the result.
+	long long items - How many items one iteration works through, for the items per second.
+	const std::function<void()>& setup - Run untimed before each iteration, or empty for none.
+	const std::function<void()>& iteration - One iteration of the case.
+Return: void
+Description:
+	This method times a case and keeps its result.
+	The iteration count is raised from what the last timing took until a timing lasts the minimum time.
+	The allocations of the last timing are counted too, so a case that starts to allocate shows up.
+	A case that changes what it works on, such as resolving collisions, puts it back in the setup,
+	so every iteration times the same work instead of what the iterations before it left behind.
+*/
+void UFRBenchmark::Run(const char* name, int argument, long long items, const std::function<void()>& setup, const std::function<void()>& iteration)
+{
+	UFRBenchmarkResult result;
+	long long iterations = 1;
+	long long nextIterations;
+	long long elapsed;
+	long long threadElapsed;
+	long long allocations;
+	double multiplier;
+
+	if (setup)
+	{
+		setup();
+	}
+	iteration();
+
+	for (;;)
+	{
+		elapsed = Time(iterations, setup, iteration, &threadElapsed, &allocations);
+
+		if (elapsed >= minTime || iterations >= BENCHMARK_MAX_ITERATIONS)
+		{
+			break;
+		}
+
+		// A timing much shorter than the minimum says little about how long the next one will take
+		if (elapsed * BENCHMARK_MAX_GROWTH <= minTime)
+		{
+			multiplier = BENCHMARK_MAX_GROWTH;
+		}
+		else
+		{
+			multiplier = minTime * BENCHMARK_GROWTH_MARGIN / elapsed;
+		}
+		nextIterations = (long long)(iterations * multiplier);
+		iterations = nextIterations > iterations ? nextIterations : iterations + 1;
+		if (iterations > BENCHMARK_MAX_ITERATIONS)
+		{
+			iterations = BENCHMARK_MAX_ITERATIONS;
+		}
+	}
+
+	result.name = std::string(name) + "/" + std::to_string(argument);
+	result.iterations = iterations;
+	result.realTime = (double)elapsed * NANOSECONDS_PER_MICROSECOND / iterations;
+	result.cpuTime = (double)threadElapsed * NANOSECONDS_PER_MICROSECOND / iterations;
+	result.itemsPerSecond = elapsed > 0 ? (double)items * iterations * MICROSECONDS_PER_SECOND / elapsed : 0;
+	result.allocations = (double)allocations / iterations;
+	results.push_back(result);
+}
+
+
+
+/*
+Name:	Time()
+Params:
+	long long iterations - How many times to run the iteration.
+	const std::function<void()>& setup - Run untimed before each iteration, or empty for none.
+	const std::function<void()>& iteration - One iteration of the case.
+	long long* threadElapsed - Set to the processor time the iterations took, in microseconds.
+	long long* allocations - Set to the allocations the iterations made.
+Return: long long - The time the iterations took, in microseconds.
+Description:
+	This method runs the iteration a number of times and times only the iterations.
+	Without a setup the iterations run in a row under one timing.
+	With one each iteration is timed on its own and the times added up, which costs two reads of the clocks per iteration,
+	so the cases that need a setup are the ones whose iterations take far longer than that.
+*/
+long long UFRBenchmark::Time(long long iterations, const std::function<void()>& setup, const std::function<void()>& iteration, long long* threadElapsed, long long* allocations)
+{
+	UFRAllocationCounts startAllocations;
+	UFRAllocationCounts endAllocations;
+	long long startTime;
+	long long startThreadTime;
+	long long elapsed = 0;
+
+	*threadElapsed = 0;
+	*allocations = 0;
+
+	if (!setup)
+	{
+		startAllocations = UFRAllocations::GetThreadCounts();
+		startThreadTime = GetThreadTime();
+		startTime = clock.Now();
+		for (long long run = 0; run < iterations; run++)
+		{
+			iteration();
+		}
+		elapsed = clock.Now() - startTime;
+		*threadElapsed = GetThreadTime() - startThreadTime;
+		endAllocations = UFRAllocations::GetThreadCounts();
+		*allocations = endAllocations.allocations - startAllocations.allocations;
+
+		return elapsed;
+	}
+
+	for (long long run = 0; run < iterations; run++)
+	{
+		setup();
+
+		startAllocations = UFRAllocations::GetThreadCounts();
+		startThreadTime = GetThreadTime();
+		startTime = clock.Now();
+		iteration();
+		elapsed += clock.Now() - startTime;
+		*threadElapsed += GetThreadTime() - startThreadTime;
+		endAllocations = UFRAllocations::GetThreadCounts();
+		*allocations += endAllocations.allocations - startAllocations.allocations;
+	}
+
+	return elapsed;
+}
+
+
+
+/*
+Name:	Write()
+Params: const wchar_t* path - The JSON file to save the results to.
+Return: bool - Whether every result was written.
+Description:
+	This method saves the results as Google Benchmark does with --benchmark_format=json, one run of each case.
+	The allocations of each iteration are saved as a user counter.
+*/
+bool UFRBenchmark::Write(const wchar_t* path)
+{
+	FILE* benchmarkFile;
+	time_t now = time(NULL);
+	char date[32];
+	bool ok;
+
+	benchmarkFile = UFRWaveFile::OpenFile(path, L"wb");
+	if (benchmarkFile == NULL)
+	{
+		return false;
+	}
+
+	strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S", localtime(&now));
+	fprintf(benchmarkFile, "{\n  \"context\": {\n    \"date\": \"%s\",\n    \"num_cpus\": %u,\n", date, std::thread::hardware_concurrency());
+#ifdef NDEBUG
+	fprintf(benchmarkFile, "    \"library_build_type\": \"release\"\n  },\n  \"benchmarks\": [");
+#else
+	fprintf(benchmarkFile, "    \"library_build_type\": \"debug\"\n  },\n  \"benchmarks\": [");
+#endif
+
+	for (int result = 0; result < results.size(); result++)
+	{
+		const UFRBenchmarkResult& benchmark = results[result];
+
+		fprintf(benchmarkFile, "%s\n    {\n      \"name\": \"%s\",\n      \"run_name\": \"%s\",\n      \"run_type\": \"iteration\",\n"
+			"      \"repetitions\": 1,\n      \"repetition_index\": 0,\n      \"threads\": 1,\n      \"iterations\": %lld,\n"
+			"      \"real_time\": %.3f,\n      \"cpu_time\": %.3f,\n      \"time_unit\": \"ns\",\n"
+			"      \"items_per_second\": %.3f,\n      \"allocations\": %.3f\n    }",
+			result == 0 ? "" : ",", benchmark.name.c_str(), benchmark.name.c_str(), benchmark.iterations,
+			benchmark.realTime, benchmark.cpuTime, benchmark.itemsPerSecond, benchmark.allocations);
+	}
+	fprintf(benchmarkFile, "\n  ]\n}\n");
+
+	ok = !ferror(benchmarkFile);
+	if (fclose(benchmarkFile) != 0)
+	{
+		ok = false;
+	}
+
+	return ok;
+}
+
+
+
+/*
+Name:	GetThreadTime()
+Params: void
+Return: long long - The processor time the calling thread has used, in microseconds.
+Description:
+	This method reads the user and kernel time of the calling thread, so time other threads took from it is not counted.
+*/
+long long UFRBenchmark::GetThreadTime()
+{
+#ifdef _WIN32
+	FILETIME creationTime;
+	FILETIME exitTime;
+	FILETIME kernelTime;
+	FILETIME userTime;
+	ULARGE_INTEGER kernel;
+	ULARGE_INTEGER user;
+
+	GetThreadTimes(GetCurrentThread(), &creationTime, &exitTime, &kernelTime, &userTime);
+	kernel.LowPart = kernelTime.dwLowDateTime;
+	kernel.HighPart = kernelTime.dwHighDateTime;
+	user.LowPart = userTime.dwLowDateTime;
+	user.HighPart = userTime.dwHighDateTime;
+
+	return (long long)((kernel.QuadPart + user.QuadPart) / FILETIME_UNITS_PER_MICROSECOND);
+#else
+	timespec now;
+
+	clock_gettime(CLOCK_THREAD_CPUTIME_ID, &now);
+
+	return (long long)now.tv_sec * MICROSECONDS_PER_SECOND + now.tv_nsec / NANOSECONDS_PER_MICROSECOND;
+#endif
+}
@@ -0,0 +1,69 @@
+/*
+File:		UFRBenchmark.h
+Project:	Unhappy Flying Reptiles
+Author(s):	Jorge Ramirez
+Description:
+	This file contains the class definition for the UFRBenchmark class.
+*/
+
+#pragma once
+#include <string>
+#include <vector>
+#include <functional>
+#include "UFRClock.h"
+
+#define BENCHMARK_MIN_TIME 500000 // How long each case is timed for at least, in microseconds
+#define BENCHMARK_MAX_ITERATIONS 1000000000
+#define BENCHMARK_MAX_GROWTH 10 // The most the iteration count grows by between two timings
+#define BENCHMARK_GROWTH_MARGIN 1.4 // Aim past the minimum time, so the next timing is usually the last
+
+
+/*
+Name: UFRBenchmarkResult
+Description:
+	The timing of one benchmark case. Times are for one iteration.
+*/
+struct UFRBenchmarkResult
+{
+	std::string name; // "Group/Case/argument"
+	long long iterations;
+	double realTime; // In nanoseconds
+	double cpuTime; // In nanoseconds, of the thread that ran the case
+	double itemsPerSecond;
+	double allocations; // Allocations through new in each iteration
+};
+
+
+/*
+Name: UFRBenchmark
+Description:
+	This class is designed to time small pieces of the game on their own, so a change that slows one down shows up
+	in the number for that piece instead of in the frame time of the whole game.
+	Each case runs once untimed to warm up, then the number of iterations grows until one timing lasts the minimum time.
+	A case that changes what it works on can give a setup, run untimed before each iteration to put it back.
+	The results are saved in the JSON format of Google Benchmark, so its tools can compare two runs.
+	Nothing here depends on MFC.
+*/
+class UFRBenchmark
+{
+private:
+	std::vector<UFRBenchmarkResult> results;
+	UFRSystemClock clock;
+	long long minTime;
+
+	long long Time(long long iterations, const std::function<void()>& setup, const std::function<void()>& iteration, long long* threadElapsed, long long* allocations);
+	static long long GetThreadTime();
+
+	UFRBenchmark(const UFRBenchmark&);
+	UFRBenchmark& operator=(const UFRBenchmark&);
+
+public:
+	UFRBenchmark(long long caseTime);
+
+	void Run(const char* name, int argument, long long items, const std::function<void()>& iteration);
+	void Run(const char* name, int argument, long long items, const std::function<void()>& setup, const std::function<void()>& iteration);
+	bool Write(const wchar_t* path);
+
+	int GetResultCount() { return (int)results.size(); }
+	const UFRBenchmarkResult& GetResult(int result) { return results[result]; }
+};
@@ -0,0 +1,607 @@
+/*
+File:		UFRBenchmarks.cpp
+Project:	Unhappy Flying Reptiles
+Author(s):	Jorge Ramirez
+Description:
+	This file contains the method definitions for the UFRBenchmarks class.
+*/
+
+#include "UFRBenchmarks.h"
+#include "UFRPhysics.h"
+#include "UFRLevel.h"
+#include "UFRLevelGenerator.h"
+#include "UFRFramePacer.h"
+#include "UFRMixer.h"
+#include "UFRImageScaler.h"
+#include "UFRJobSystem.h"
+#include <stdlib.h>
+#include <algorithm>
+
+#if defined(_WIN32) && !defined(BENCHMARKS_PORTABLE)
+#include "UFRGame.h"
+#include "UFRReptiles.h"
+
+using namespace Gdiplus;
+#endif
+
+#define BENCH_BODY_COUNTS 4
+#define BENCH_PIXEL_SIZES 3
+#define BENCH_PACER_RATES 2
+#define BENCH_VOICE_COUNTS 3
+#define BENCH_SCALE_THREAD_COUNTS 4
+
+// The pacer waits on a clock that sleeps like a 1 ms system timer, and spins as long before each deadline as the game's loops
+#define BENCH_PACER_SPIN_MARGIN 2000
+#define BENCH_SLEEP_GRANULARITY 1000
+#define BENCH_WAKE_UP_DELAY 100
+#define BENCH_SPIN_COST 1
+#define BENCH_PACER_WORK_FRACTION 2 // Each frame works for this fraction of the interval before it waits
+#define MICROSECONDS_PER_SECOND 1000000
+
+// Synthetic sounds, every other one stereo, that last a whole number of mixer blocks
+#define BENCH_SOUND_BLOCKS 64
+#define BENCH_SOUND_FRAMES (BENCH_SOUND_BLOCKS * MIXER_BLOCK_FRAMES)
+#define BENCH_SOUND_PERIOD 109 // Frames in one cycle of the sawtooth the sounds hold
+#define BENCH_SOUND_VOLUME 0.5f
+
+// The presenter scaling the game image to a 3840x2160 window, at 4x and stretched from the size of the backdrop
+#define BENCH_SCALE_WIDTH 3840
+#define BENCH_SCALE_HEIGHT 2160
+#define BENCH_INTEGER_SCALE 4
+#define BENCH_STRETCH_IMAGE_WIDTH 640
+#define BENCH_STRETCH_IMAGE_HEIGHT 400
+
+// What the physics reads of a crate, made as UFRCrates makes them
+#define BENCH_CRATE_COMPONENTS (COMPONENT_TRANSFORM | COMPONENT_VELOCITY | COMPONENT_BODY | COMPONENT_FRICTION)
+#define BENCH_CRATE_SPRITE_SIZE 131
+#define BENCH_CRATE_FRICTION 1
+#define BENCH_CRATE_GRAVITY 1
+
+// Reptiles as UFRReptiles makes them, with a box about the size of its sprites
+#define BENCH_REPTILE_WIDTH 56
+#define BENCH_REPTILE_HEIGHT 44
+#define BENCH_REPTILE_SPACING 80 // Between the reptiles, so they do not start on top of each other
+#define BENCH_REPTILE_WEIGHT 20
+#define BENCH_REPTILE_FORCE_GIVEN 0.6
+#define BENCH_REPTILE_GRAVITY 1
+#define BENCH_MIN_FLIGHT_HEIGHT 120
+#define BENCH_MAX_FLIGHT_HEIGHT 300
+#define BENCH_MIN_SPEED 8
+#define BENCH_MAX_SPEED 16
+#define BENCH_FLAP_TICKS 5
+#define BENCH_SPEED_TICKS 10
+
+#define BENCH_KEY_COLOR_STRIDE 2 // Every other pixel of the synthetic bitmaps has the key color
+
+static const int bodyCounts[BENCH_BODY_COUNTS] = { 100, 1000, 10000, 100000 };
+static const int pixelSizes[BENCH_PIXEL_SIZES] = { 64, 256, 1024 }; // The width and height of the synthetic bitmaps
+static const int pacerRates[BENCH_PACER_RATES] = { 60, 144 }; // Frames a second
+static const int voiceCounts[BENCH_VOICE_COUNTS] = { 1, 4, MIXER_VOICE_COUNT };
+static const int scaleThreadCounts[BENCH_SCALE_THREAD_COUNTS] = { 1, 2, 4, 8 }; // 1 scales on the calling thread with no job system
+
+
+/*
+Name:	UFRBenchmarks()
+Params: unsigned int levelSeed - The seed of the stress levels and the flight AI.
+Description:
+	Constructor for the UFRBenchmarks class.
+*/
+UFRBenchmarks::UFRBenchmarks(unsigned int levelSeed) : islandArena(BENCH_ARENA_SIZE)
+{
+	world = NULL;
+	crateTable = NULL;
+	seed = levelSeed;
+	result = 0;
+}
+
+
+
+/*
+Name:	~UFRBenchmarks()
+Params: void
+Description:
+	Destructor for the UFRBenchmarks class. The world of the last case is deleted here.
+*/
+UFRBenchmarks::~UFRBenchmarks()
+{
+	delete world;
+}
+
+
+
+/*
+Name:	Run()
+Params: UFRBenchmark* benchmark - Where the cases are timed and their results kept.
+Return: void
+Description:
+	This method runs every case at every size. Each body count gets a new world.
+*/
+void UFRBenchmarks::Run(UFRBenchmark* benchmark)
+{
+	for (int count = 0; count < BENCH_BODY_COUNTS; count++)
+	{
+		RunPhysics(benchmark, bodyCounts[count]);
+	}
+
+	for (int rate = 0; rate < BENCH_PACER_RATES; rate++)
+	{
+		RunPacer(benchmark, pacerRates[rate]);
+	}
+
+	for (int voices = 0; voices < BENCH_VOICE_COUNTS; voices++)
+	{
+		RunMixer(benchmark, voiceCounts[voices]);
+	}
+
+	for (int threads = 0; threads < BENCH_SCALE_THREAD_COUNTS; threads++)
+	{
+		RunScale(benchmark, scaleThreadCounts[threads]);
+	}
+
+#if defined(_WIN32) && !defined(BENCHMARKS_PORTABLE)
+	for (int count = 0; count < BENCH_BODY_COUNTS; count++)
+	{
+		RunReptiles(benchmark, bodyCounts[count]);
+	}
+
+	for (int size = 0; size < BENCH_PIXEL_SIZES; size++)
+	{
+		RunPixels(benchmark, pixelSizes[size]);
+	}
+#endif
+}
+
+
+
+/*
+Name:	RunPhysics()
+Params:
+	UFRBenchmark* benchmark - Where the cases are timed.
+	int count - The number of crates in the stress level.
+Return: void
+Description:
+	This method times the parts of a game tick that move the crates and resolve their collisions.
+	The crates are first left to fall and stack, and every case starts from the pairs found then.
+	Resolving collisions moves the crates, so those cases put the settled crates back untimed before each iteration,
+	and every iteration resolves the same overlaps.
+*/
+void UFRBenchmarks::RunPhysics(UFRBenchmark* benchmark, int count)
+{
+	CreateCrates(count);
+	Settle();
+
+	benchmark->Run("Broadphase/FindPairs", count, count, [this]()
+	{
+		BuildBroadphase();
+		broadphase.FindPairs(bodyPairs);
+	});
+
+	benchmark->Run("Physics/DetectCollision", count, (long long)bodyPairs.size(), [this]() { Restore(); }, [this]()
+	{
+		for (int pair = 0; pair < bodyPairs.size(); pair++)
+		{
+			UFRPhysics::DetectCollision(world, bodyEntities[bodyPairs[pair].first], bodyEntities[bodyPairs[pair].second]);
+		}
+	});
+
+	benchmark->Run("Physics/HandleCollision", count, (long long)bodyPairs.size(), [this]() { Restore(); }, [this]()
+	{
+		for (int pair = 0; pair < bodyPairs.size(); pair++)
+		{
+			UFRPhysics::HandleCollision(world, bodyEntities[bodyPairs[pair].first], bodyEntities[bodyPairs[pair].second]);
+		}
+	});
+
+	benchmark->Run("Physics/FindIslands", count, (long long)bodyPairs.size(), [this]()
+	{
+		islandArena.Reset();
+		result = UFRPhysics::FindIslands(bodyPairs, broadphase.GetBodyCount(), islandPairs, islandStarts, &islandArena);
+	});
+
+	benchmark->Run("Physics/Move", count, count, [this]()
+	{
+		UFRPhysics::Move(world, 0, COMPONENT_FLIGHT_AI);
+	});
+}
+
+
+
+/*
+Name:	RunPacer()
+Params:
+	UFRBenchmark* benchmark - Where the cases are timed.
+	int rate - The frames a second the pacer runs at.
+Return: void
+Description:
+	This method times what the frame pacer costs for each frame, on a simulated clock so no real time is waited.
+	Every spin of the simulated clock moves it on by a microsecond, so the time covers the spin loop of each wait
+	as well as the sleep and the bookkeeping around it.
+*/
+void UFRBenchmarks::RunPacer(UFRBenchmark* benchmark, int rate)
+{
+	UFRSimulatedClock clock(BENCH_SLEEP_GRANULARITY, BENCH_WAKE_UP_DELAY, BENCH_SPIN_COST);
+	UFRFramePacer pacer(&clock, MICROSECONDS_PER_SECOND / rate, BENCH_PACER_SPIN_MARGIN);
+	long long work = pacer.GetInterval() / BENCH_PACER_WORK_FRACTION;
+
+	pacer.Start();
+	benchmark->Run("Pacer/WaitForNextFrame", rate, 1, [&clock, &pacer, work]()
+	{
+		clock.Advance(work);
+		pacer.WaitForNextFrame();
+	});
+}
+
+
+
+/*
+Name:	RunMixer()
+Params:
+	UFRBenchmark* benchmark - Where the cases are timed.
+	int voiceCount - The number of voices playing at once.
+Return: void
+Description:
+	This method times the mixing of one block with a number of different sounds playing, into an output that
+	throws the sound away, so only the mixing is timed.
+	The sounds all end on the same block and are triggered again for the next one, so every block mixes every voice.
+	A block takes about as long as the two reads of the clocks a setup costs, so the triggers are timed with
+	the blocks instead, which adds one trip through the sound queue for each sound every BENCH_SOUND_BLOCKS blocks.
+	The items are the frames of every voice mixed.
+*/
+void UFRBenchmarks::RunMixer(UFRBenchmark* benchmark, int voiceCount)
+{
+	UFRNullOutput output;
+	UFRMixer mixer(&output, NULL);
+	UFRSoundQueue* queue = mixer.CreateQueue();
+	std::vector<std::vector<float> > samples(voiceCount);
+	int channels;
+	int blocksLeft = 0;
+
+	for (int sound = 0; sound < voiceCount; sound++)
+	{
+		channels = sound % MIXER_CHANNELS + 1;
+		samples[sound].resize(BENCH_SOUND_FRAMES * channels);
+		for (int sample = 0; sample < samples[sound].size(); sample++)
+		{
+			samples[sound][sample] = (float)((sample / channels + sound) % BENCH_SOUND_PERIOD) / BENCH_SOUND_PERIOD * 2 - 1;
+		}
+		mixer.AddSound(&samples[sound][0], BENCH_SOUND_FRAMES, channels, 0);
+	}
+
+	benchmark->Run("Mixer/Mix", voiceCount, (long long)MIXER_BLOCK_FRAMES * voiceCount, [&mixer, queue, voiceCount, &blocksLeft]()
+	{
+		if (blocksLeft == 0)
+		{
+			for (int sound = 0; sound < voiceCount; sound++)
+			{
+				queue->Play(sound, BENCH_SOUND_VOLUME);
+			}
+			blocksLeft = BENCH_SOUND_BLOCKS;
+		}
+		blocksLeft--;
+
+		mixer.Render(MIXER_BLOCK_FRAMES);
+	});
+}
+
+
+
+/*
+Name:	RunScale()
+Params:
+	UFRBenchmark* benchmark - Where the cases are timed.
+	int threadCount - The number of threads that scale, counting the one that waits for them.
+Return: void
+Description:
+	This method times the scaling the presenter does for a 3840x2160 window, with its integer and stretch scalers,
+	on a job system of the given number of threads, or on the calling thread alone for one thread.
+	The argument is the thread count, so the cases of one scaler side by side show how it scales with threads.
+	The real time is what matters here, as the thread time only covers the calling thread.
+	The items are the pixels of the window.
+*/
+void UFRBenchmarks::RunScale(UFRBenchmark* benchmark, int threadCount)
+{
+	UFRJobSystem* jobs = threadCount > 1 ? new UFRJobSystem(threadCount) : NULL;
+	int integerWidth = BENCH_SCALE_WIDTH / BENCH_INTEGER_SCALE;
+	int integerHeight = BENCH_SCALE_HEIGHT / BENCH_INTEGER_SCALE;
+	std::vector<unsigned int> integerImage(integerWidth * integerHeight);
+	std::vector<unsigned int> stretchImage(BENCH_STRETCH_IMAGE_WIDTH * BENCH_STRETCH_IMAGE_HEIGHT);
+	long long pixels = (long long)BENCH_SCALE_WIDTH * BENCH_SCALE_HEIGHT;
+
+	{
+		UFRImageScaler integerScaler(integerWidth, integerHeight, jobs);
+		UFRImageScaler stretchScaler(BENCH_STRETCH_IMAGE_WIDTH, BENCH_STRETCH_IMAGE_HEIGHT, jobs);
+
+		for (int pixel = 0; pixel < integerImage.size(); pixel++)
+		{
+			integerImage[pixel] = pixel * 2654435761u;
+		}
+		for (int pixel = 0; pixel < stretchImage.size(); pixel++)
+		{
+			stretchImage[pixel] = pixel * 2654435761u;
+		}
+		integerScaler.SetSize(BENCH_SCALE_WIDTH, BENCH_SCALE_HEIGHT, BENCH_INTEGER_SCALE);
+		stretchScaler.SetSize(BENCH_SCALE_WIDTH, BENCH_SCALE_HEIGHT, 1);
+
+		benchmark->Run("Presenter/ScaleInteger", threadCount, pixels, [&integerScaler, &integerImage, integerWidth]()
+		{
+			integerScaler.Scale(&integerImage[0], integerWidth * sizeof(unsigned int));
+		});
+
+		benchmark->Run("Presenter/ScaleStretch", threadCount, pixels, [&stretchScaler, &stretchImage]()
+		{
+			stretchScaler.Scale(&stretchImage[0], BENCH_STRETCH_IMAGE_WIDTH * sizeof(unsigned int));
+		});
+	}
+
+	delete jobs;
+}
+
+
+
+/*
+Name:	CreateCrates()
+Params: int count - The number of crates.
+Return: void
+Description:
+	This method makes a new world holding a generated stress level.
+	Each crate gets the box of its sprite at its scale, so the bodies are the size they are in the game.
+*/
+void UFRBenchmarks::CreateCrates(int count)
+{
+	UFRLevel level;
+	UFRLevelGenerator generator(seed);
+	UFRArchetype* table;
+	int first;
+	int row;
+
+	delete world;
+	world = new UFRWorld();
+	crateTable = NULL;
+
+	generator.Generate(&level, count);
+	first = world->CreateEntities(BENCH_CRATE_COMPONENTS, level.GetCrateCount());
+	if (level.GetCrateCount() == 0)
+	{
+		return;
+	}
+	table = world->GetEntityArchetype(first);
+	row = world->GetRow(first);
+	crateTable = table;
+
+	for (int crate = 0; crate < level.GetCrateCount(); crate++, row++)
+	{
+		UFRTransform& transform = table->transforms[row];
+		UFRVelocity& velocity = table->velocities[row];
+		UFRBody& body = table->bodies[row];
+		UFRFriction& friction = table->frictions[row];
+
+		transform.left = level.GetLefts()[crate];
+		transform.bottom = level.GetBottoms()[crate];
+		transform.rotation = 0;
+		transform.teleported = false;
+		velocity.x = 0;
+		velocity.y = 0;
+
+		body.width = (int)(BENCH_CRATE_SPRITE_SIZE * level.GetScales()[crate]);
+		body.height = body.width;
+		body.weight = level.GetWeights()[crate];
+		body.forceGiven = level.GetForcesGiven()[crate];
+		body.gravity = BENCH_CRATE_GRAVITY;
+		body.lands = false;
+		body.pixelExact = false;
+
+		friction.amount = BENCH_CRATE_FRICTION;
+		friction.inAir = true;
+	}
+}
+
+
+
+/*
+Name:	BuildBroadphase()
+Params: void
+Return: void
+Description:
+	This method adds every body to the broadphase, as the game does each tick.
+*/
+void UFRBenchmarks::BuildBroadphase()
+{
+	broadphase.Clear();
+	bodyEntities.clear();
+
+	for (int entity = 0; entity < world->GetEntityCount(); entity++)
+	{
+		if (world->HasComponents(entity, COMPONENT_TRANSFORM | COMPONENT_BODY))
+		{
+			UFRTransform& transform = world->GetTransform(entity);
+			UFRBody& body = world->GetBody(entity);
+			broadphase.Add(transform.left, transform.bottom, body.width, body.height);
+			bodyEntities.push_back(entity);
+		}
+	}
+}
+
+
+
+/*
+Name:	Settle()
+Params: void
+Return: void
+Description:
+	This method runs the physics of a few game ticks, so the piles fall and the crates rest on each other,
+	and then finds the pairs of the settled crates and keeps the crates as they are.
+*/
+void UFRBenchmarks::Settle()
+{
+	for (int tick = 0; tick < BENCH_SETTLE_TICKS; tick++)
+	{
+		UFRPhysics::Move(world, 0, 0);
+		BuildBroadphase();
+		broadphase.FindPairs(bodyPairs);
+		for (int pair = 0; pair < bodyPairs.size(); pair++)
+		{
+			UFRPhysics::DetectCollision(world, bodyEntities[bodyPairs[pair].first], bodyEntities[bodyPairs[pair].second]);
+		}
+	}
+
+	BuildBroadphase();
+	broadphase.FindPairs(bodyPairs);
+
+	if (crateTable != NULL)
+	{
+		settledTransforms = crateTable->transforms;
+		settledVelocities = crateTable->velocities;
+	}
+}
+
+
+
+/*
+Name:	Restore()
+Params: void
+Return: void
+Description:
+	This method puts the crates back as they were after settling. Only their places and velocities change in a collision.
+	The copies are the size of the table, so nothing is allocated.
+*/
+void UFRBenchmarks::Restore()
+{
+	if (crateTable != NULL)
+	{
+		std::copy(settledTransforms.begin(), settledTransforms.end(), crateTable->transforms.begin());
+		std::copy(settledVelocities.begin(), settledVelocities.end(), crateTable->velocities.begin());
+	}
+}
+
+
+
+#if defined(_WIN32) && !defined(BENCHMARKS_PORTABLE)
+/*
+Name:	RunReptiles()
+Params:
+	UFRBenchmark* benchmark - Where the cases are timed.
+	int count - The number of reptiles.
+Return: void
+Description:
+	This method times the flight AI over a flock of reptiles, flying and then knocked down.
+	A flying tick moves the reptiles and then flies them, and a falling tick spins them and then moves them, as in the game.
+*/
+void UFRBenchmarks::RunReptiles(UFRBenchmark* benchmark, int count)
+{
+	UFRArchetype* table;
+	int first;
+
+	srand(seed);
+	delete world;
+	world = new UFRWorld();
+	crateTable = NULL;
+
+	first = world->CreateEntities(REPTILE_COMPONENTS, count);
+	table = world->GetEntityArchetype(first);
+	for (int row = world->GetRow(first), reptile = 0; reptile < count; row++, reptile++)
+	{
+		UFRTransform& transform = table->transforms[row];
+		UFRVelocity& velocity = table->velocities[row];
+		UFRBody& body = table->bodies[row];
+		UFRSprite& sprite = table->sprites[row];
+		UFRFlightAI& flight = table->flights[row];
+
+		transform.left = reptile * BENCH_REPTILE_SPACING;
+		transform.bottom = rand() % BENCH_MAX_FLIGHT_HEIGHT;
+		transform.rotation = 0;
+		transform.teleported = false;
+
+		flight.minHeight = BENCH_MIN_FLIGHT_HEIGHT;
+		flight.maxHeight = BENCH_MAX_FLIGHT_HEIGHT;
+		flight.minSpeed = BENCH_MIN_SPEED;
+		flight.maxSpeed = BENCH_MAX_SPEED;
+		flight.ticksToNextFlap = rand() % BENCH_FLAP_TICKS;
+		flight.ticksToNextSpeed = rand() % BENCH_SPEED_TICKS;
+		for (int frame = 0; frame < FLIGHT_MAX_FRAMES; frame++)
+		{
+			flight.frames[frame] = frame;
+		}
+		flight.frameCount = FLIGHT_MAX_FRAMES;
+		flight.frame = reptile % FLIGHT_MAX_FRAMES;
+		flight.fallSprite = FLIGHT_MAX_FRAMES;
+
+		velocity.y = 0;
+		UFRReptiles::SetRandomSpeed(&flight, &velocity);
+		sprite.sprite = flight.frames[flight.frame];
+		sprite.mirrored = velocity.x < 0;
+
+		body.width = BENCH_REPTILE_WIDTH;
+		body.height = BENCH_REPTILE_HEIGHT;
+		body.weight = BENCH_REPTILE_WEIGHT;
+		body.forceGiven = BENCH_REPTILE_FORCE_GIVEN;
+		body.gravity = BENCH_REPTILE_GRAVITY;
+		body.lands = true;
+		body.pixelExact = true;
+	}
+
+	benchmark->Run("Reptiles/SetRandomSpeed", count, count, [table, count]()
+	{
+		for (int row = 0; row < count; row++)
+		{
+			UFRReptiles::SetRandomSpeed(&table->flights[row], &table->velocities[row]);
+		}
+	});
+
+	benchmark->Run("Reptiles/FlyTick", count, count, [this]()
+	{
+		UFRPhysics::Move(world, COMPONENT_FLIGHT_AI, 0);
+		UFRReptiles::Fly(world);
+	});
+
+	// Knocking them all down moves every reptile to the falling table
+	world->Reserve(REPTILE_COMPONENTS | COMPONENT_FALL_SPIN | COMPONENT_FRICTION, count);
+	for (int reptile = first; reptile < first + count; reptile++)
+	{
+		UFRReptiles::KnockDown(world, reptile);
+	}
+
+	benchmark->Run("Reptiles/FallTick", count, count, [this]()
+	{
+		UFRReptiles::Spin(world);
+		UFRPhysics::Move(world, COMPONENT_FLIGHT_AI, 0);
+	});
+}
+
+
+
+/*
+Name:	RunPixels()
+Params:
+	UFRBenchmark* benchmark - Where the cases are timed.
+	int size - The width and height of the bitmap.
+Return: void
+Description:
+	This method times the color key pass the backdrop layers go through, on a bitmap where every other pixel has the key color.
+	The untimed first pass clears the key color, so the timed passes measure the scan over every pixel,
+	which is what the pass costs on the layers the game loads.
+*/
+void UFRBenchmarks::RunPixels(UFRBenchmark* benchmark, int size)
+{
+	Bitmap bitmap(size, size, PixelFormat32bppARGB);
+	Rect bitmapRect(0, 0, size, size);
+	BitmapData bitmapData;
+	Color keyColor(0, 255, 0);
+	UINT* pixels;
+
+	bitmap.LockBits(&bitmapRect, ImageLockModeWrite, PixelFormat32bppARGB, &bitmapData);
+	for (int y = 0; y < size; y++)
+	{
+		pixels = (UINT*)((BYTE*)bitmapData.Scan0 + y * bitmapData.Stride);
+		for (int x = 0; x < size; x++)
+		{
+			pixels[x] = (x + y) % BENCH_KEY_COLOR_STRIDE == 0 ? keyColor.GetValue() : Color((BYTE)x, (BYTE)y, (BYTE)(x ^ y)).GetValue();
+		}
+	}
+	bitmap.UnlockBits(&bitmapData);
+
+	benchmark->Run("Pixels/MakeTransparent", size, (long long)size * size, [&bitmap, keyColor]()
+	{
+		UFRGame::MakeTransparent(&bitmap, keyColor);
+	});
+}
+#endif
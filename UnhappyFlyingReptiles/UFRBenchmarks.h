@@ -0,0 +1,68 @@
+/*
+File:		UFRBenchmarks.h
+Project:	Unhappy Flying Reptiles
+Author(s):	Jorge Ramirez
+Description:
+	This file contains the class definition for the UFRBenchmarks class.
+*/
+
+#pragma once
+#include <vector>
+#include "UFRBenchmark.h"
+#include "UFRWorld.h"
+#include "UFRBroadphase.h"
+#include "UFRFrameArena.h"
+
+#define BENCH_SETTLE_TICKS 60 // Ticks the crates fall and stack for before they are timed, so the collisions are the ones of play
+#define BENCH_ARENA_SIZE 65536 // As the tick arena of the game starts
+
+
+/*
+Name: UFRBenchmarks
+Description:
+	This class is designed to hold the benchmark cases of the physics, the frame pacer, the mixer, the presenter's scaling,
+	the flight AI and the pixel work of the game.
+	The physics cases run on stress levels of every body count, built straight into a world with the bodies
+	and velocities of crates, so they need no sprite files and depend on nothing but the world and the physics.
+	The reptile and pixel cases use GDI+ and only run in the game on Windows.
+	The benchmark runner defines BENCHMARKS_PORTABLE to leave them out, so it builds on every platform without the game.
+	The pacer runs on a simulated clock, so it waits no real time, and the mixer mixes synthetic sounds into a null output.
+	The scaling runs on synthetic images with job systems of several sizes, to show how it scales with threads.
+	The levels and the flight AI are seeded, so two runs time the same work.
+*/
+class UFRBenchmarks
+{
+private:
+	UFRWorld* world;
+	UFRArchetype* crateTable; // The table all the crates of the stress level are in
+	std::vector<UFRTransform> settledTransforms; // The crates as they rest after settling, put back before each collision iteration
+	std::vector<UFRVelocity> settledVelocities;
+	UFRBroadphase broadphase;
+	std::vector<int> bodyEntities; // The entity of each body in the broadphase
+	std::vector<UFRBodyPair> bodyPairs;
+	std::vector<int> islandPairs;
+	std::vector<int> islandStarts;
+	UFRFrameArena islandArena; // Takes the place of the tick arena, reset each iteration as the game resets it each tick
+	unsigned int seed;
+	int result; // Kept from cases whose only output is a count, so the work is not optimized away
+
+	void CreateCrates(int count);
+	void BuildBroadphase();
+	void Settle();
+	void Restore();
+	void RunPhysics(UFRBenchmark* benchmark, int count);
+	static void RunPacer(UFRBenchmark* benchmark, int rate);
+	static void RunMixer(UFRBenchmark* benchmark, int voiceCount);
+	static void RunScale(UFRBenchmark* benchmark, int threadCount);
+	void RunReptiles(UFRBenchmark* benchmark, int count);
+	static void RunPixels(UFRBenchmark* benchmark, int size);
+
+	UFRBenchmarks(const UFRBenchmarks&);
+	UFRBenchmarks& operator=(const UFRBenchmarks&);
+
+public:
+	UFRBenchmarks(unsigned int levelSeed);
+	~UFRBenchmarks();
+
+	void Run(UFRBenchmark* benchmark);
+};
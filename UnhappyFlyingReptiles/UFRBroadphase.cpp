@@ -0,0 +1,300 @@
+/*
+File:		UFRBroadphase.cpp
+Project:	Unhappy Flying Reptiles
+Author(s):	Jorge Ramirez
+Description:
+	This file contains the method definitions for the UFRBroadphase class.
+*/
+
+#include "UFRBroadphase.h"
+#include <algorithm>
+
+#define CELL_HASH_Y 19349663 // Neighbouring cells in a row take neighbouring buckets, rows are spread apart
+
+
+/*
+Name:	UFRBroadphase()
+Params: void
+Description:
+	Constructor for the UFRBroadphase class. The grid starts out empty.
+*/
+UFRBroadphase::UFRBroadphase()
+{
+	bucketMask = BROADPHASE_MIN_BUCKETS - 1;
+	bucketStarts.assign(BROADPHASE_MIN_BUCKETS + 1, 0);
+	grouped = true;
+}
+
+
+
+/*
+Name:	Clear()
+Params: void
+Return: void
+Description:
+	This method takes every body out of the grid. The memory of the arrays is kept for the next build.
+*/
+void UFRBroadphase::Clear()
+{
+	bodies.clear();
+	entries.clear();
+	grouped = false;
+}
+
+
+
+/*
+Name:	Add()
+Params:
+	int left - The distance of the body from the left of the game image.
+	int bottom - The distance of the body from the bottom of the game image.
+	int width - The width of the body.
+	int height - The height of the body.
+Return: int - The number of the body, which is how many bodies were added before it.
+Description:
+	This method puts a body into every cell its box covers, widened by BROADPHASE_MARGIN.
+*/
+int UFRBroadphase::Add(int left, int bottom, int width, int height)
+{
+	Body body;
+	Entry entry;
+	int lastCellX;
+	int lastCellY;
+
+	body.left = left;
+	body.bottom = bottom;
+	body.right = left + width;
+	body.top = bottom + height;
+	body.firstCellX = GetCell(left - BROADPHASE_MARGIN);
+	body.firstCellY = GetCell(bottom - BROADPHASE_MARGIN);
+	lastCellX = GetCell(body.right + BROADPHASE_MARGIN);
+	lastCellY = GetCell(body.top + BROADPHASE_MARGIN);
+
+	entry.body = (int)bodies.size();
+	bodies.push_back(body);
+
+	for (entry.cellY = body.firstCellY; entry.cellY <= lastCellY; entry.cellY++)
+	{
+		for (entry.cellX = body.firstCellX; entry.cellX <= lastCellX; entry.cellX++)
+		{
+			entries.push_back(entry);
+		}
+	}
+	grouped = false;
+
+	return entry.body;
+}
+
+
+
+/*
+Name:	FindPairs()
+Params: std::vector<UFRBodyPair>& pairs - Filled with every pair of bodies whose widened boxes overlap.
+Return: void
+Description:
+	This method finds the pairs of bodies that share a cell and overlap.
+	Each body looks in the cells it covers for the bodies added after it.
+	A pair that shares several cells is only taken from the first of them, the one at the lower left
+	of where their cells meet, so each pair comes out once.
+	The pairs come out sorted, body by body, so collisions are handled in the same order as testing every pair would.
+	Only the few pairs of one body are sorted, so the cost stays linear in the number of bodies.
+*/
+void UFRBroadphase::FindPairs(std::vector<UFRBodyPair>& pairs)
+{
+	UFRBodyPair pair;
+	int lastCellX;
+	int lastCellY;
+	int firstPair;
+
+	pairs.clear();
+	if (!grouped)
+	{
+		Group();
+	}
+
+	for (pair.first = 0; pair.first < bodies.size(); pair.first++)
+	{
+		const Body& body = bodies[pair.first];
+
+		firstPair = (int)pairs.size();
+		lastCellX = GetCell(body.right + BROADPHASE_MARGIN);
+		lastCellY = GetCell(body.top + BROADPHASE_MARGIN);
+
+		for (int cellY = body.firstCellY; cellY <= lastCellY; cellY++)
+		{
+			for (int cellX = body.firstCellX; cellX <= lastCellX; cellX++)
+			{
+				int bucket = GetBucket(cellX, cellY);
+
+				for (int entry = bucketStarts[bucket]; entry < bucketStarts[bucket + 1]; entry++)
+				{
+					const Entry& other = bucketEntries[entry];
+					const Body& otherBody = bodies[other.body];
+
+					// Other cells can hash to the same bucket, and the bodies before this one already paired with it
+					if (other.body <= pair.first || other.cellX != cellX || other.cellY != cellY)
+					{
+						continue;
+					}
+
+					if (cellX != (body.firstCellX > otherBody.firstCellX ? body.firstCellX : otherBody.firstCellX) ||
+						cellY != (body.firstCellY > otherBody.firstCellY ? body.firstCellY : otherBody.firstCellY))
+					{
+						continue;
+					}
+
+					if (Overlap(body, otherBody))
+					{
+						pair.second = other.body;
+						pairs.push_back(pair);
+					}
+				}
+			}
+		}
+
+		std::sort(pairs.begin() + firstPair, pairs.end(), [](const UFRBodyPair& pair, const UFRBodyPair& otherPair)
+		{
+			return pair.second < otherPair.second;
+		});
+	}
+}
+
+
+
+/*
+Name:	HitTest()
+Params:
+	int x - The distance of the point from the left of the game image.
+	int y - The distance of the point from the bottom of the game image.
+	int below - Only bodies added before this one are hit. GetBodyCount finds the body on top of all of them.
+Return: int - The number of the body on top at the point, or -1 if there is none.
+Description:
+	This method looks in the one cell under the point. A point on the edge of a body does not hit it.
+	Passing the body that was hit as below finds the one under it, for when its box is hit but its pixels are not.
+*/
+int UFRBroadphase::HitTest(int x, int y, int below)
+{
+	int cellX = GetCell(x);
+	int cellY = GetCell(y);
+	int bucket;
+	int hit = -1;
+
+	if (!grouped)
+	{
+		Group();
+	}
+	bucket = GetBucket(cellX, cellY);
+
+	for (int entry = bucketStarts[bucket]; entry < bucketStarts[bucket + 1]; entry++)
+	{
+		const Entry& cellEntry = bucketEntries[entry];
+		const Body& body = bodies[cellEntry.body];
+
+		if (cellEntry.cellX == cellX && cellEntry.cellY == cellY && cellEntry.body > hit && cellEntry.body < below &&
+			x > body.left && x < body.right && y > body.bottom && y < body.top)
+		{
+			hit = cellEntry.body;
+		}
+	}
+
+	return hit;
+}
+
+
+
+/*
+Name:	GetCell()
+Params: int position - A position along either axis.
+Return: int - The cell of the grid the position is in.
+Description:
+	This method rounds down, so positions left of or below the image get cells of their own.
+*/
+int UFRBroadphase::GetCell(int position)
+{
+	if (position < 0)
+	{
+		return -((-position + BROADPHASE_CELL_SIZE - 1) / BROADPHASE_CELL_SIZE);
+	}
+
+	return position / BROADPHASE_CELL_SIZE;
+}
+
+
+
+/*
+Name:	GetBucket()
+Params:
+	int cellX - The column of the cell.
+	int cellY - The row of the cell.
+Return: int - The bucket the cell is kept in.
+Description:
+	This method hashes a cell into one of the buckets. There is always a power of two of them.
+	The cells a body covers in a row land next to each other, so looking them up stays in the cache.
+*/
+int UFRBroadphase::GetBucket(int cellX, int cellY)
+{
+	return (int)(((unsigned int)cellX + (unsigned int)cellY * CELL_HASH_Y) & bucketMask);
+}
+
+
+
+/*
+Name:	Group()
+Params: void
+Return: void
+Description:
+	This method sorts the entries into their buckets by counting how many each bucket gets.
+	The number of buckets is picked from the number of entries first, so each bucket holds about one cell.
+	The entries are placed from the last one back, so every bucket keeps them in body order.
+*/
+void UFRBroadphase::Group()
+{
+	unsigned int bucketCount = BROADPHASE_MIN_BUCKETS;
+	int bucket;
+
+	while (bucketCount < entries.size() * BROADPHASE_LOAD_FACTOR)
+	{
+		bucketCount *= 2;
+	}
+	bucketMask = bucketCount - 1;
+
+	// Count the entries of each bucket, then turn the counts into where each bucket ends
+	bucketStarts.assign(bucketCount + 1, 0);
+	for (int entry = 0; entry < entries.size(); entry++)
+	{
+		bucketStarts[GetBucket(entries[entry].cellX, entries[entry].cellY)]++;
+	}
+	for (unsigned int count = 1; count <= bucketCount; count++)
+	{
+		bucketStarts[count] += bucketStarts[count - 1];
+	}
+
+	// Filling each bucket from its end leaves its start behind
+	bucketEntries.resize(entries.size());
+	for (int entry = (int)entries.size() - 1; entry >= 0; entry--)
+	{
+		bucket = GetBucket(entries[entry].cellX, entries[entry].cellY);
+		bucketEntries[--bucketStarts[bucket]] = entries[entry];
+	}
+
+	grouped = true;
+}
+
+
+
+/*
+Name:	Overlap()
+Params:
+	const Body& body - One body.
+	const Body& otherBody - The other body.
+Return: bool - Whether the boxes overlap once widened by BROADPHASE_MARGIN.
+Description:
+	This method compares the boxes of two bodies.
+*/
+bool UFRBroadphase::Overlap(const Body& body, const Body& otherBody)
+{
+	return body.left - BROADPHASE_MARGIN <= otherBody.right + BROADPHASE_MARGIN &&
+		otherBody.left - BROADPHASE_MARGIN <= body.right + BROADPHASE_MARGIN &&
+		body.bottom - BROADPHASE_MARGIN <= otherBody.top + BROADPHASE_MARGIN &&
+		otherBody.bottom - BROADPHASE_MARGIN <= body.top + BROADPHASE_MARGIN;
+}
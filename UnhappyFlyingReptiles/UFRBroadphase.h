@@ -0,0 +1,89 @@
+/*
+File:		UFRBroadphase.h
+Project:	Unhappy Flying Reptiles
+Author(s):	Jorge Ramirez
+Description:
+	This file contains the class definition for the UFRBroadphase class.
+*/
+
+#pragma once
+#include <vector>
+
+#define BROADPHASE_CELL_SIZE 64 // In game image pixels, about the size of the largest body
+#define BROADPHASE_MIN_BUCKETS 1024 // The fewest buckets the grid uses, a power of two
+#define BROADPHASE_LOAD_FACTOR 2 // Buckets for each entry at least, so most buckets hold one cell
+#define BROADPHASE_MARGIN 1 // Bodies this close are paired, since the collision tests count touching as colliding
+
+
+/*
+Name: UFRBodyPair
+Description:
+	Two bodies whose boxes overlap, by the order they were added in. first is always less than second.
+*/
+struct UFRBodyPair
+{
+	int first;
+	int second;
+};
+
+
+/*
+Name: UFRBroadphase
+Description:
+	This class is designed to find which bodies might touch, and which body is under a point,
+	without testing every body against every other.
+	Bodies are boxes in game image coordinates, measured from the left and bottom like the game objects.
+	They are put in the cells of a uniform grid that covers any position, hashed into buckets,
+	so a box only meets the boxes in the cells it covers. There are always at least BROADPHASE_LOAD_FACTOR buckets
+	for each entry, so finding the pairs stays linear in the number of bodies however many there are.
+	Adding a body only appends its entries. They are grouped by bucket with a counting sort the first time the grid is searched,
+	into flat arrays that keep their memory from one build to the next.
+	The grid is rebuilt from scratch whenever the bodies move, which keeps its memory once it has grown,
+	and bodies are added in the order they are drawn so the last one added is the one on top.
+	Nothing here depends on MFC.
+*/
+class UFRBroadphase
+{
+private:
+	struct Body
+	{
+		int left;
+		int bottom;
+		int right; // One past the last column
+		int top; // One past the last row
+		int firstCellX;
+		int firstCellY;
+	};
+
+	struct Entry
+	{
+		int cellX;
+		int cellY;
+		int body;
+	};
+
+	std::vector<Body> bodies;
+	std::vector<Entry> entries; // In the order they were added, which is body order
+	std::vector<Entry> bucketEntries; // The same entries grouped by bucket, still in body order within each bucket
+	std::vector<int> bucketStarts; // Where each bucket starts in bucketEntries, and one more for where the last ends
+	unsigned int bucketMask;
+	bool grouped; // Whether bucketEntries holds every entry
+
+	static int GetCell(int position);
+	int GetBucket(int cellX, int cellY);
+	void Group();
+	static bool Overlap(const Body& body, const Body& otherBody);
+
+	UFRBroadphase(const UFRBroadphase&);
+	UFRBroadphase& operator=(const UFRBroadphase&);
+
+public:
+	UFRBroadphase();
+
+	void Clear();
+	int Add(int left, int bottom, int width, int height);
+	int GetBodyCount() { return (int)bodies.size(); }
+
+	void FindPairs(std::vector<UFRBodyPair>& pairs);
+	int HitTest(int x, int y, int below);
+};
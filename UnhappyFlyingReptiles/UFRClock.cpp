@@ -0,0 +1,162 @@
+/*
+File:		UFRClock.cpp
+Project:	Unhappy Flying Reptiles
+Author(s):	Jorge Ramirez
+Description:
+	This file contains the method definitions for the UFRSystemClock and UFRSimulatedClock classes.
+*/
+
+#include "UFRClock.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#pragma comment(lib, "winmm.lib")
+#else
+#include <chrono>
+#include <thread>
+#endif
+
+#define MICROSECONDS_PER_SECOND 1000000
+#define MICROSECONDS_PER_MILLISECOND 1000
+#define SYSTEM_TIMER_RESOLUTION 1 // In milliseconds
+
+
+/*
+Name:	UFRSystemClock()
+Params: void
+Description:
+	Constructor for the UFRSystemClock class.
+	The counter frequency is read and the system timer resolution is raised here.
+*/
+UFRSystemClock::UFRSystemClock()
+{
+#ifdef _WIN32
+	LARGE_INTEGER frequency;
+	QueryPerformanceFrequency(&frequency);
+	counterFrequency = frequency.QuadPart;
+
+	timeBeginPeriod(SYSTEM_TIMER_RESOLUTION);
+#else
+	counterFrequency = MICROSECONDS_PER_SECOND;
+#endif
+}
+
+
+
+/*
+Name:	~UFRSystemClock()
+Params: void
+Description:
+	Destructor for the UFRSystemClock class.
+	The system timer resolution is restored here.
+*/
+UFRSystemClock::~UFRSystemClock()
+{
+#ifdef _WIN32
+	timeEndPeriod(SYSTEM_TIMER_RESOLUTION);
+#endif
+}
+
+
+
+/*
+Name:	Now()
+Params: void
+Return: long long - The current time in microseconds.
+Description:
+	This method reads the performance counter and converts it to microseconds.
+*/
+long long UFRSystemClock::Now()
+{
+#ifdef _WIN32
+	LARGE_INTEGER counter;
+	QueryPerformanceCounter(&counter);
+
+	// Split the conversion so the multiplication can't overflow
+	return (counter.QuadPart / counterFrequency) * MICROSECONDS_PER_SECOND +
+		(counter.QuadPart % counterFrequency) * MICROSECONDS_PER_SECOND / counterFrequency;
+#else
+	return std::chrono::duration_cast<std::chrono::microseconds>(
+		std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+}
+
+
+
+/*
+Name:	Sleep()
+Params: long long microseconds - The time to sleep for.
+Return: void
+Description:
+	This method gives up the processor for about the given time. The system only sleeps in whole
+	milliseconds, so the time is rounded down and the caller is expected to spin for the rest.
+*/
+void UFRSystemClock::Sleep(long long microseconds)
+{
+	if (microseconds < MICROSECONDS_PER_MILLISECOND)
+	{
+		return;
+	}
+
+#ifdef _WIN32
+	::Sleep((DWORD)(microseconds / MICROSECONDS_PER_MILLISECOND));
+#else
+	std::this_thread::sleep_for(std::chrono::milliseconds(microseconds / MICROSECONDS_PER_MILLISECOND));
+#endif
+}
+
+
+
+/*
+Name:	Spin()
+Params: void
+Return: void
+Description:
+	This method is one step of a busy wait. It tells the processor that the thread is spinning.
+*/
+void UFRSystemClock::Spin()
+{
+#ifdef _WIN32
+	YieldProcessor();
+#else
+	std::this_thread::yield();
+#endif
+}
+
+
+
+/*
+Name:	UFRSimulatedClock()
+Params:
+	long long granularity - The timer granularity that sleeps are rounded up to, in microseconds.
+	long long delay - The extra time every sleep takes to wake up, in microseconds.
+	long long costOfSpin - The time one spin takes, in microseconds.
+Description:
+	Constructor for the UFRSimulatedClock class. The clock starts at 0.
+*/
+UFRSimulatedClock::UFRSimulatedClock(long long granularity, long long delay, long long costOfSpin)
+{
+	currentTime = 0;
+	sleepGranularity = granularity > 0 ? granularity : 1;
+	wakeUpDelay = delay;
+	spinCost = costOfSpin > 0 ? costOfSpin : 1;
+}
+
+
+
+/*
+Name:	Sleep()
+Params: long long microseconds - The time to sleep for.
+Return: void
+Description:
+	This method moves the clock forward by the sleep time rounded up to the granularity, plus the wake up delay.
+*/
+void UFRSimulatedClock::Sleep(long long microseconds)
+{
+	if (microseconds <= 0)
+	{
+		return;
+	}
+
+	currentTime += ((microseconds + sleepGranularity - 1) / sleepGranularity) * sleepGranularity + wakeUpDelay;
+}
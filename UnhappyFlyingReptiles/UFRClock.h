@@ -0,0 +1,76 @@
+/*
+File:		UFRClock.h
+Project:	Unhappy Flying Reptiles
+Author(s):	Jorge Ramirez
+Description:
+	This file contains the class definitions for the UFRClock interface and its system and simulated clocks.
+	Nothing here depends on MFC, so the timing code built on it can be run anywhere.
+*/
+
+#pragma once
+
+
+/*
+Name: UFRClock
+Description:
+	This class is the interface to a monotonic clock that counts in microseconds.
+	Sleep is coarse and may wake up late, Spin is a short busy wait used for the last stretch before a deadline.
+*/
+class UFRClock
+{
+public:
+	virtual ~UFRClock() {}
+
+	virtual long long Now() = 0;
+	virtual void Sleep(long long microseconds) = 0;
+	virtual void Spin() = 0;
+};
+
+
+/*
+Name: UFRSystemClock
+Inherit: public UFRClock
+Description:
+	This class reads the high resolution performance counter of the system.
+	On Windows the system timer resolution is raised to 1 ms for as long as the clock exists.
+*/
+class UFRSystemClock : public UFRClock
+{
+private:
+	long long counterFrequency;
+
+public:
+	UFRSystemClock();
+	~UFRSystemClock();
+
+	long long Now();
+	void Sleep(long long microseconds);
+	void Spin();
+};
+
+
+/*
+Name: UFRSimulatedClock
+Inherit: public UFRClock
+Description:
+	This class is a clock that only moves when it is told to, for testing and benchmarking timing code.
+	Sleeps are rounded up to a timer granularity plus a wake up delay, like a real scheduler,
+	and every spin costs a fixed amount of time.
+*/
+class UFRSimulatedClock : public UFRClock
+{
+private:
+	long long currentTime;
+	long long sleepGranularity;
+	long long wakeUpDelay;
+	long long spinCost;
+
+public:
+	UFRSimulatedClock(long long granularity, long long delay, long long costOfSpin);
+
+	long long Now() { return currentTime; }
+	void Sleep(long long microseconds);
+	void Spin() { currentTime += spinCost; }
+
+	void Advance(long long microseconds) { currentTime += microseconds; }
+};
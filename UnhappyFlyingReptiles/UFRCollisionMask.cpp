@@ -0,0 +1,153 @@
+/*
+File:		UFRCollisionMask.cpp
+Project:	Unhappy Flying Reptiles
+Author(s):	Jorge Ramirez
+Description:
+	This file contains the method definitions for the UFRCollisionMask class.
+*/
+
+#include "UFRCollisionMask.h"
+
+#define BYTES_PER_PIXEL 4
+#define ALPHA_BYTE 3 // Pixels are stored blue, green, red, alpha
+
+
+/*
+Name:	UFRCollisionMask()
+Params: void
+Description:
+	Constructor for the UFRCollisionMask class. The mask is empty until it is built.
+*/
+UFRCollisionMask::UFRCollisionMask()
+{
+	width = 0;
+	height = 0;
+	wordsPerRow = 0;
+}
+
+
+
+/*
+Name:	Build()
+Params:
+	const unsigned char* pixels - The top left pixel of the sprite, 32 bits per pixel with alpha in the last byte.
+	int stride - The number of bytes from one row of pixels to the next.
+	int maskWidth - The width of the sprite.
+	int maskHeight - The height of the sprite.
+	bool mirrored - Whether the mask is for the sprite flipped left to right.
+Return: void
+Description:
+	This method sets a bit for every pixel of the sprite that is at least MASK_ALPHA_THRESHOLD opaque.
+*/
+void UFRCollisionMask::Build(const unsigned char* pixels, int stride, int maskWidth, int maskHeight, bool mirrored)
+{
+	width = maskWidth;
+	height = maskHeight;
+	wordsPerRow = (width + MASK_WORD_BITS - 1) / MASK_WORD_BITS;
+	bits.assign(wordsPerRow * height, 0);
+
+	for (int row = 0; row < height; row++)
+	{
+		const unsigned char* pixel = pixels + row * stride;
+		unsigned long long* rowBits = &bits[row * wordsPerRow];
+
+		for (int column = 0; column < width; column++)
+		{
+			if (pixel[column * BYTES_PER_PIXEL + ALPHA_BYTE] >= MASK_ALPHA_THRESHOLD)
+			{
+				int maskColumn = mirrored ? width - 1 - column : column;
+				rowBits[maskColumn / MASK_WORD_BITS] |= 1ULL << (maskColumn % MASK_WORD_BITS);
+			}
+		}
+	}
+}
+
+
+
+/*
+Name:	Test()
+Params:
+	int x - The column in the sprite, from the left.
+	int y - The row in the sprite, from the top.
+Return: bool - Whether the pixel is solid. Pixels outside the sprite are not.
+Description:
+	This method looks up the bit of one pixel.
+*/
+bool UFRCollisionMask::Test(int x, int y) const
+{
+	if (x < 0 || x >= width || y < 0 || y >= height)
+	{
+		return false;
+	}
+
+	return (bits[y * wordsPerRow + x / MASK_WORD_BITS] >> (x % MASK_WORD_BITS) & 1) != 0;
+}
+
+
+
+/*
+Name:	Overlaps()
+Params:
+	const UFRCollisionMask& other - The mask to test against.
+	int offsetX - How far right of the left of this mask the left of the other one is.
+	int offsetY - How far below the top of this mask the top of the other one is.
+Return: bool - Whether any solid pixel of one mask lands on a solid pixel of the other.
+Description:
+	This method walks the rows the two masks share. For each word of this mask the 64 pixels of the other mask
+	that fall on it are gathered into one word and the two are ANDed, stopping at the first overlap.
+*/
+bool UFRCollisionMask::Overlaps(const UFRCollisionMask& other, int offsetX, int offsetY) const
+{
+	int firstRow = offsetY > 0 ? offsetY : 0;
+	int lastRow = offsetY + other.height < height ? offsetY + other.height : height;
+	int firstWord = offsetX > 0 ? offsetX / MASK_WORD_BITS : 0;
+	int lastWord = (offsetX + other.width < width ? offsetX + other.width : width) - 1;
+
+	if (lastWord < 0)
+	{
+		return false;
+	}
+	lastWord /= MASK_WORD_BITS;
+
+	for (int row = firstRow; row < lastRow; row++)
+	{
+		const unsigned long long* rowBits = &bits[row * wordsPerRow];
+
+		for (int word = firstWord; word <= lastWord; word++)
+		{
+			if ((rowBits[word] & other.GetWord(row - offsetY, word * MASK_WORD_BITS - offsetX)) != 0)
+			{
+				return true;
+			}
+		}
+	}
+
+	return false;
+}
+
+
+
+/*
+Name:	GetWord()
+Params:
+	int row - The row of the mask.
+	int column - The first column of the word, which may be outside the mask.
+Return: unsigned long long - The 64 pixels of the row from the column on, with pixels outside the mask clear.
+Description:
+	This method gathers a word that is not lined up with the words of the row from the two words it straddles.
+*/
+unsigned long long UFRCollisionMask::GetWord(int row, int column) const
+{
+	const unsigned long long* rowBits = &bits[row * wordsPerRow];
+	int word = column >= 0 ? column / MASK_WORD_BITS : -((-column + MASK_WORD_BITS - 1) / MASK_WORD_BITS);
+	int shift = column - word * MASK_WORD_BITS;
+	unsigned long long low = word >= 0 && word < wordsPerRow ? rowBits[word] : 0;
+	unsigned long long high = word + 1 >= 0 && word + 1 < wordsPerRow ? rowBits[word + 1] : 0;
+
+	if (shift == 0)
+	{
+		return low;
+	}
+
+	return low >> shift | high << (MASK_WORD_BITS - shift);
+}
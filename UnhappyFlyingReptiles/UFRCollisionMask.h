@@ -0,0 +1,47 @@
+/*
+File:		UFRCollisionMask.h
+Project:	Unhappy Flying Reptiles
+Author(s):	Jorge Ramirez
+Description:
+	This file contains the class definition for the UFRCollisionMask class.
+*/
+
+#pragma once
+#include <vector>
+
+#define MASK_ALPHA_THRESHOLD 128 // Pixels at least this opaque are solid
+#define MASK_WORD_BITS 64
+
+
+/*
+Name: UFRCollisionMask
+Description:
+	This class is designed to tell exactly which pixels of a sprite are solid, one bit per pixel.
+	Each row is a whole number of 64 bit words with the leftmost pixel in the lowest bit, and rows go
+	from the top of the sprite down, the way it is drawn.
+	Two masks are tested against each other a row at a time, by shifting the words of one into line with
+	the other and ANDing them, so a sprite the size of the reptile costs two words per row.
+	Masks are only meant to be tested after the boxes of the sprites are found to overlap.
+	Nothing here depends on MFC.
+*/
+class UFRCollisionMask
+{
+private:
+	int width;
+	int height;
+	int wordsPerRow;
+	std::vector<unsigned long long> bits;
+
+	unsigned long long GetWord(int row, int column) const;
+
+public:
+	UFRCollisionMask();
+
+	void Build(const unsigned char* pixels, int stride, int maskWidth, int maskHeight, bool mirrored);
+
+	int GetWidth() const { return width; }
+	int GetHeight() const { return height; }
+
+	bool Test(int x, int y) const;
+	bool Overlaps(const UFRCollisionMask& other, int offsetX, int offsetY) const;
+};
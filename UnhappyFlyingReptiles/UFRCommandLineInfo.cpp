@@ -0,0 +1,141 @@
+/*
+File:		UFRCommandLineInfo.cpp
+Project:	Unhappy Flying Reptiles
+Author(s):	Jorge Ramirez
+Description:
+	This file contains the method definitions for the UFRCommandLineInfo class.
+*/
+
+#include "UFRCommandLineInfo.h"
+#include "UFRFrameCapture.h"
+
+
+/*
+Name:	UFRCommandLineInfo()
+Params: void
+Description:
+	Constructor for the UFRCommandLineInfo class. With no options the game starts in its window as usual.
+*/
+UFRCommandLineInfo::UFRCommandLineInfo()
+{
+	captureFrames = DEFAULT_CAPTURE_FRAMES;
+	captureFormat = CAPTURE_FORMAT_FROM_PATH;
+	seed = 0;
+	seedGiven = false;
+	generateCrates = 0;
+	forbidAllocations = false;
+}
+
+
+
+/*
+Name:	ParseParam()
+Params:
+	const TCHAR* pszParam - The option or value, without the leading / or - for options.
+	BOOL bFlag - Whether this is an option.
+	BOOL bLast - Whether this is the last parameter.
+Return: void
+Description:
+	This method is called by MFC for every parameter on the command line.
+	Options that take a value are remembered until the value arrives as the next parameter, the others are set straight away.
+	A lone "-" is passed as a value, so "/capture -" writes to the standard output.
+*/
+void UFRCommandLineInfo::ParseParam(const TCHAR* pszParam, BOOL bFlag, BOOL bLast)
+{
+	if (bFlag && pendingOption.GetLength() == 0)
+	{
+		if (IsValueOption(pszParam))
+		{
+			pendingOption = pszParam;
+		}
+		else if (_tcsicmp(pszParam, TEXT("noalloc")) == 0)
+		{
+			forbidAllocations = true;
+		}
+		else
+		{
+			TRACE(TEXT("Unknown option: %s\n"), pszParam);
+		}
+		return;
+	}
+
+	if (pendingOption.CompareNoCase(TEXT("capture")) == 0)
+	{
+		// MFC strips the dash from "-" and reports an empty option
+		capturePath = (bFlag && pszParam[0] == TEXT('\0')) ? TEXT("-") : pszParam;
+	}
+	else if (pendingOption.CompareNoCase(TEXT("frames")) == 0)
+	{
+		captureFrames = _ttoi(pszParam);
+	}
+	else if (pendingOption.CompareNoCase(TEXT("seed")) == 0)
+	{
+		seed = (unsigned int)_ttoi(pszParam);
+		seedGiven = true;
+	}
+	else if (pendingOption.CompareNoCase(TEXT("format")) == 0)
+	{
+		captureFormat = _tcsicmp(pszParam, TEXT("y4m")) == 0 ? CAPTURE_FORMAT_Y4M : CAPTURE_FORMAT_RGBA;
+	}
+	else if (pendingOption.CompareNoCase(TEXT("audio")) == 0)
+	{
+		audioPath = pszParam;
+	}
+	else if (pendingOption.CompareNoCase(TEXT("bakeatlas")) == 0)
+	{
+		bakeAtlasPath = pszParam;
+	}
+	else if (pendingOption.CompareNoCase(TEXT("cook")) == 0)
+	{
+		cookPath = pszParam;
+	}
+	else if (pendingOption.CompareNoCase(TEXT("level")) == 0)
+	{
+		levelPath = pszParam;
+	}
+	else if (pendingOption.CompareNoCase(TEXT("convertlevel")) == 0)
+	{
+		convertLevelPath = pszParam;
+	}
+	else if (pendingOption.CompareNoCase(TEXT("generatelevel")) == 0)
+	{
+		generateCrates = _ttoi(pszParam);
+	}
+	else if (pendingOption.CompareNoCase(TEXT("trace")) == 0)
+	{
+		tracePath = pszParam;
+	}
+	else if (pendingOption.CompareNoCase(TEXT("bench")) == 0)
+	{
+		benchPath = pszParam;
+	}
+	else if (pendingOption.CompareNoCase(TEXT("record")) == 0)
+	{
+		recordPath = pszParam;
+	}
+	else if (pendingOption.CompareNoCase(TEXT("replay")) == 0)
+	{
+		replayPath = pszParam;
+	}
+
+	pendingOption = TEXT("");
+}
+
+
+
+/*
+Name:	IsValueOption()
+Params: const TCHAR* option - The option, without the leading / or -.
+Return: bool - Whether the option is followed by a value.
+Description:
+	This method checks an option against the options this class understands.
+*/
+bool UFRCommandLineInfo::IsValueOption(const TCHAR* option)
+{
+	return _tcsicmp(option, TEXT("capture")) == 0 || _tcsicmp(option, TEXT("frames")) == 0 ||
+		_tcsicmp(option, TEXT("seed")) == 0 || _tcsicmp(option, TEXT("format")) == 0 || _tcsicmp(option, TEXT("audio")) == 0 ||
+		_tcsicmp(option, TEXT("bakeatlas")) == 0 || _tcsicmp(option, TEXT("cook")) == 0 ||
+		_tcsicmp(option, TEXT("level")) == 0 || _tcsicmp(option, TEXT("convertlevel")) == 0 ||
+		_tcsicmp(option, TEXT("generatelevel")) == 0 || _tcsicmp(option, TEXT("trace")) == 0 ||
+		_tcsicmp(option, TEXT("bench")) == 0 || _tcsicmp(option, TEXT("record")) == 0 || _tcsicmp(option, TEXT("replay")) == 0;
+}
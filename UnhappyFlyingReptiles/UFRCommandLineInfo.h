@@ -0,0 +1,74 @@
+/*
+File:		UFRCommandLineInfo.h
+Project:	Unhappy Flying Reptiles
+Author(s):	Jorge Ramirez
+Description:
+	This file contains the class definition for the UFRCommandLineInfo class.
+*/
+
+#pragma once
+#include <afxwin.h>
+
+#define DEFAULT_CAPTURE_FRAMES 600
+#define CAPTURE_FORMAT_FROM_PATH -1
+
+
+/*
+Name: UFRCommandLineInfo
+Inherit: public CCommandLineInfo
+Description:
+	This class is designed to read the options the game was started with.
+	/capture <file>	Run headless and write every frame to the file, or to the standard output for "-".
+	/frames <count>	The number of frames to capture.
+	/seed <number>	The random seed, so a capture can be repeated exactly.
+	/format <rgba|y4m>	The capture format. By default it is picked from the file extension.
+	/audio <file>	Write the sound of a capture to a WAV file.
+	/bakeatlas <file>	Build the sprite atlas from the sprite files and save it, then exit.
+	/cook <file>	Cook every asset from its source file into an asset pack, then exit.
+	/level <file>	The binary level to capture, or the file /convertlevel writes.
+	/convertlevel <file>	Convert a text level into a binary level, then exit.
+	/generatelevel <crates>	Generate a stress level with that many crates from /seed into the /level file, then exit.
+	/trace <file>	Save a Chrome trace of every thread when the game or capture ends, and on F9.
+	/noalloc	Fail an assertion when a game tick or frame allocates once the game has warmed up.
+	/bench <file>	Time the physics, flight AI and pixel benchmarks on stress levels from /seed and save them as JSON, then exit.
+	/record <file>	Save the mouse input of the game, and its seed, as the ticks apply it.
+	/replay <file>	Play the input /record saved into a capture, in the ticks it was applied in and with its seed.
+*/
+class UFRCommandLineInfo : public CCommandLineInfo
+{
+private:
+	CString pendingOption; // The option waiting for its value
+
+	bool IsValueOption(const TCHAR* option);
+
+public:
+	CString capturePath;
+	int captureFrames;
+	int captureFormat;
+	CString audioPath;
+	unsigned int seed;
+	bool seedGiven;
+	CString bakeAtlasPath;
+	CString cookPath;
+	CString levelPath;
+	CString convertLevelPath;
+	int generateCrates;
+	CString tracePath;
+	bool forbidAllocations;
+	CString benchPath;
+	CString recordPath;
+	CString replayPath;
+
+	UFRCommandLineInfo();
+
+	void ParseParam(const TCHAR* pszParam, BOOL bFlag, BOOL bLast);
+	bool IsCapturing() { return capturePath.GetLength() > 0; }
+	bool IsBakingAtlas() { return bakeAtlasPath.GetLength() > 0; }
+	bool IsCooking() { return cookPath.GetLength() > 0; }
+	bool IsConvertingLevel() { return convertLevelPath.GetLength() > 0; }
+	bool IsGeneratingLevel() { return generateCrates > 0; }
+	bool IsTracing() { return tracePath.GetLength() > 0; }
+	bool IsBenchmarking() { return benchPath.GetLength() > 0; }
+	bool IsRecording() { return recordPath.GetLength() > 0; }
+	bool IsReplaying() { return replayPath.GetLength() > 0; }
+};
@@ -0,0 +1,123 @@
+/*
+File:		UFRComponents.h
+Project:	Unhappy Flying Reptiles
+Author(s):	Jorge Ramirez
+Description:
+	This file contains the definitions of the components that game entities are made of.
+	An entity is only a number, and what it is depends on which components it has:
+	a crate is a body that slides, the reptile is a body with a flight AI that spins when it falls.
+*/
+
+#pragma once
+
+// One bit per component, an archetype is the set of components its entities have
+#define COMPONENT_TRANSFORM 0x01
+#define COMPONENT_VELOCITY 0x02
+#define COMPONENT_BODY 0x04
+#define COMPONENT_FRICTION 0x08
+#define COMPONENT_SPRITE 0x10
+#define COMPONENT_FLIGHT_AI 0x20
+#define COMPONENT_FALL_SPIN 0x40
+
+#define FLIGHT_MAX_FRAMES 8
+
+
+/*
+Name: UFRTransform
+Description:
+	Where an entity is, measured from the left and bottom of the game image, and how far it is rotated clockwise.
+*/
+struct UFRTransform
+{
+	int left;
+	int bottom;
+	int rotation; // In degrees
+	bool teleported; // Set when the entity jumps to a new place this tick and must not be interpolated
+};
+
+
+/*
+Name: UFRVelocity
+Description:
+	How far an entity moves each tick. Positive values go right and up.
+*/
+struct UFRVelocity
+{
+	int x;
+	int y;
+};
+
+
+/*
+Name: UFRBody
+Description:
+	The box an entity collides with, and how it moves and trades forces on impact.
+*/
+struct UFRBody
+{
+	int width;
+	int height;
+	int weight;
+	double forceGiven; // The part of its force the body gives up on impact, from 0 to 1
+	int gravity; // Taken off the vertical velocity every tick the body is off the ground
+	bool lands; // Whether the vertical velocity stops when the body reaches the ground
+	bool pixelExact; // Whether it collides by the solid pixels of its sprite rather than by its box
+};
+
+
+/*
+Name: UFRFriction
+Description:
+	How fast the horizontal velocity of an entity runs down.
+*/
+struct UFRFriction
+{
+	int amount;
+	bool inAir; // Whether it also slows the entity off the ground
+};
+
+
+/*
+Name: UFRSprite
+Description:
+	The atlas sprite an entity is drawn with.
+*/
+struct UFRSprite
+{
+	int sprite;
+	bool mirrored; // Drawn flipped left to right
+};
+
+
+/*
+Name: UFRFlightAI
+Description:
+	An entity that flies by itself: it flaps at random to stay between two heights, picks a new random speed
+	from time to time, faces the way it flies and cycles through its flying frames.
+*/
+struct UFRFlightAI
+{
+	int ticksToNextFlap;
+	int ticksToNextSpeed;
+	int minHeight; // Below this it always flaps
+	int maxHeight; // Above this it never flaps
+	int minSpeed;
+	int maxSpeed;
+	int frames[FLIGHT_MAX_FRAMES];
+	int frameCount;
+	int frame;
+	int fallSprite; // Shown once it is knocked out of the air
+};
+
+
+/*
+Name: UFRFallSpin
+Description:
+	An entity that has been knocked out of the air. It spins the way it is moving and shows its fallen sprite.
+	While it has this component its flight AI is paused.
+*/
+struct UFRFallSpin
+{
+	int degrees; // The rotation each tick it moves sideways
+	int sprite;
+};
@@ -0,0 +1,238 @@
+/*
+File:		UFRCrates.cpp
+Project:	Unhappy Flying Reptiles
+Author(s):	Jorge Ramirez
+Description:
+	This file contains the method definitions for the UFRCrates class.
+*/
+
+#include "UFRCrates.h"
+
+#define DEFAULT_CRATE_SCALE 0.4
+#define SPRITE_FILEPATH TEXT("Crates\\")
+#define CRATE_SPRITE TEXT("Crate.png")
+#define HEAVY_CRATE_SPRITE TEXT("HeavyCrate.png")
+#define LIGHT_CRATE_SPRITE TEXT("LightCrate.png")
+
+#define DEFAULT_FRICTION 1
+#define DEFAULT_GRAVITY 1
+
+#define HEAVY_CRATE_THRESHOLD 12
+#define LIGHT_CRATE_THRESHOLD 3
+#define DEFAULT_WEIGHT 5
+#define DEFAULT_FORCE_GIVEN 0.7
+
+
+/*
+Name:	Create()
+Params:
+	UFRWorld* world - The world to add the crate to.
+	UFRSpriteAtlas* atlas - The atlas to add the crate sprite to.
+	int leftOffset - The initial offset from the left for the crate.
+	int bottomOffset - The initial offset from the bottom for the crate.
+Return: int - The entity of the crate.
+Description:
+	This method adds a crate of the default weight and size to the world.
+*/
+int UFRCrates::Create(UFRWorld* world, UFRSpriteAtlas* atlas, int leftOffset, int bottomOffset)
+{
+	return Create(world, atlas, leftOffset, bottomOffset, DEFAULT_WEIGHT, DEFAULT_FORCE_GIVEN, DEFAULT_CRATE_SCALE);
+}
+
+
+
+/*
+Name:	Create()
+Params:
+	UFRWorld* world - The world to add the crate to.
+	UFRSpriteAtlas* atlas - The atlas to add the crate sprite to.
+	int leftOffset - The initial offset from the left for the crate.
+	int bottomOffset - The initial offset from the bottom for the crate.
+	unsigned int weight - The weight of the crate.
+	float forceGiven - The force that the crate gives up on impact.
+	float scale - The factor by which to scale the crate.
+Return: int - The entity of the crate.
+Description:
+	This method adds a crate to the world. It slides to a stop in the air as well as on the ground.
+*/
+int UFRCrates::Create(UFRWorld* world, UFRSpriteAtlas* atlas, int leftOffset, int bottomOffset, unsigned int weight, float forceGiven, float scale)
+{
+	wchar_t buff[355] = { '\0' };
+	int entity = world->CreateEntity(CRATE_COMPONENTS);
+	UFRTransform& transform = world->GetTransform(entity);
+	UFRBody& body = world->GetBody(entity);
+	UFRFriction& friction = world->GetFriction(entity);
+	UFRSprite& sprite = world->GetSprite(entity);
+
+	swprintf(buff, TEXT("%s%s"), SPRITE_FILEPATH, PickSpriteFile(weight));
+
+	if (forceGiven < 0)
+	{
+		forceGiven = -forceGiven;
+	}
+	if (scale < 0)
+	{
+		scale = -scale;
+	}
+
+	transform.left = leftOffset;
+	transform.bottom = bottomOffset;
+
+	// The atlas keeps the sprite already scaled
+	sprite.sprite = atlas->Add(buff, scale);
+	sprite.mirrored = false;
+
+	body.width = atlas->GetWidth(sprite.sprite);
+	body.height = atlas->GetHeight(sprite.sprite);
+	body.weight = weight;
+	body.forceGiven = forceGiven;
+	body.gravity = DEFAULT_GRAVITY;
+	body.lands = false;
+	body.pixelExact = false;
+
+	friction.amount = DEFAULT_FRICTION;
+	friction.inAir = true;
+
+	return entity;
+}
+
+
+
+/*
+Name:	CreateFromLevel()
+Params:
+	UFRWorld* world - The world to add the crates to.
+	UFRSpriteAtlas* atlas - The atlas to add the crate sprites to.
+	UFRLevel* level - The open level holding the crates.
+Return: int - The entity of the first crate. The rest are numbered after it.
+Description:
+	This method adds every crate of a level to the world at once, the same as Create would one at a time.
+	The crates take consecutive rows of one table, which are filled from the packed arrays of the level in one pass.
+	A level reuses a few sprites for all its crates, so each sprite is only looked up in the atlas once.
+*/
+int UFRCrates::CreateFromLevel(UFRWorld* world, UFRSpriteAtlas* atlas, UFRLevel* level)
+{
+	wchar_t buff[355] = { '\0' };
+	std::vector<LevelSprite> levelSprites;
+	int found = -1;
+	int crateCount = level->GetCrateCount();
+	const int* lefts = level->GetLefts();
+	const int* bottoms = level->GetBottoms();
+	const unsigned int* weights = level->GetWeights();
+	const float* forcesGiven = level->GetForcesGiven();
+	const float* scales = level->GetScales();
+	int first = world->CreateEntities(CRATE_COMPONENTS, crateCount);
+	UFRArchetype* table;
+	int row;
+
+	if (crateCount == 0)
+	{
+		return first;
+	}
+	table = world->GetEntityArchetype(first);
+	row = world->GetRow(first);
+
+	for (int crate = 0; crate < crateCount; crate++, row++)
+	{
+		const wchar_t* file = PickSpriteFile(weights[crate]);
+		float forceGiven = forcesGiven[crate];
+		float scale = scales[crate];
+		UFRTransform& transform = table->transforms[row];
+		UFRBody& body = table->bodies[row];
+		UFRFriction& friction = table->frictions[row];
+		UFRSprite& sprite = table->sprites[row];
+
+		if (forceGiven < 0)
+		{
+			forceGiven = -forceGiven;
+		}
+		if (scale < 0)
+		{
+			scale = -scale;
+		}
+
+		// Crates next to each other in a level tend to share a sprite
+		if (found < 0 || levelSprites[found].file != file || levelSprites[found].scale != scale)
+		{
+			found = -1;
+			for (int levelSprite = 0; levelSprite < levelSprites.size(); levelSprite++)
+			{
+				if (levelSprites[levelSprite].file == file && levelSprites[levelSprite].scale == scale)
+				{
+					found = levelSprite;
+					break;
+				}
+			}
+			if (found < 0)
+			{
+				LevelSprite levelSprite;
+				swprintf(buff, TEXT("%s%s"), SPRITE_FILEPATH, file);
+				levelSprite.file = file;
+				levelSprite.scale = scale;
+				levelSprite.sprite = atlas->Add(buff, scale);
+				levelSprite.width = atlas->GetWidth(levelSprite.sprite);
+				levelSprite.height = atlas->GetHeight(levelSprite.sprite);
+				levelSprites.push_back(levelSprite);
+				found = (int)levelSprites.size() - 1;
+			}
+		}
+
+		transform.left = lefts[crate];
+		transform.bottom = bottoms[crate];
+
+		sprite.sprite = levelSprites[found].sprite;
+		sprite.mirrored = false;
+
+		body.width = levelSprites[found].width;
+		body.height = levelSprites[found].height;
+		body.weight = weights[crate];
+		body.forceGiven = forceGiven;
+		body.gravity = DEFAULT_GRAVITY;
+		body.lands = false;
+		body.pixelExact = false;
+
+		friction.amount = DEFAULT_FRICTION;
+		friction.inAir = true;
+	}
+
+	return first;
+}
+
+
+
+/*
+Name:	PickSpriteFile()
+Params: unsigned int weight - The weight of the crate.
+Return: const wchar_t* - The sprite file of the crate, in SPRITE_FILEPATH.
+Description:
+	This method picks the sprite of a crate by how heavy it is.
+*/
+const wchar_t* UFRCrates::PickSpriteFile(unsigned int weight)
+{
+	if (weight >= HEAVY_CRATE_THRESHOLD)
+	{
+		return HEAVY_CRATE_SPRITE;
+	}
+	else if (weight <= LIGHT_CRATE_THRESHOLD)
+	{
+		return LIGHT_CRATE_SPRITE;
+	}
+	return CRATE_SPRITE;
+}
+
+
+
+/*
+Name:	ListSpriteFiles()
+Params: std::vector<UFRSpriteRequest>& sprites - The list to add the sprite files to.
+Return: void
+Description:
+	This method lists every sprite file a crate can use, so they can be decoded before any crate is created.
+	Each crate picks its own scale, so they are listed at full size and reduced when the crates are added.
+*/
+void UFRCrates::ListSpriteFiles(std::vector<UFRSpriteRequest>& sprites)
+{
+	sprites.push_back(UFRSpriteRequest(std::wstring(SPRITE_FILEPATH) + CRATE_SPRITE, 1.0));
+	sprites.push_back(UFRSpriteRequest(std::wstring(SPRITE_FILEPATH) + HEAVY_CRATE_SPRITE, 1.0));
+	sprites.push_back(UFRSpriteRequest(std::wstring(SPRITE_FILEPATH) + LIGHT_CRATE_SPRITE, 1.0));
+}
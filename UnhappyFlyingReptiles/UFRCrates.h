@@ -0,0 +1,43 @@
+/*
+File:		UFRCrates.h
+Project:	Unhappy Flying Reptiles
+Author(s):	Jorge Ramirez
+Description:
+	This file contains the class definition for the UFRCrates class.
+*/
+
+#pragma once
+#include <vector>
+#include "UFRWorld.h"
+#include "UFRSpriteAtlas.h"
+#include "UFRLevel.h"
+
+#define CRATE_COMPONENTS (COMPONENT_TRANSFORM | COMPONENT_VELOCITY | COMPONENT_BODY | COMPONENT_FRICTION | COMPONENT_SPRITE)
+
+
+/*
+Name: UFRCrates
+Description:
+	This class is designed to create crates. A crate is only a body that slides, so it needs no systems of its own.
+	How heavy it is picks its sprite. A level of any size is added in one go from its packed arrays.
+*/
+class UFRCrates
+{
+private:
+	struct LevelSprite
+	{
+		const wchar_t* file;
+		float scale;
+		int sprite;
+		int width;
+		int height;
+	};
+
+	static const wchar_t* PickSpriteFile(unsigned int weight);
+
+public:
+	static int Create(UFRWorld* world, UFRSpriteAtlas* atlas, int leftOffset, int bottomOffset);
+	static int Create(UFRWorld* world, UFRSpriteAtlas* atlas, int leftOffset, int bottomOffset, unsigned int weight, float forceGiven, float scale);
+	static int CreateFromLevel(UFRWorld* world, UFRSpriteAtlas* atlas, UFRLevel* level);
+	static void ListSpriteFiles(std::vector<UFRSpriteRequest>& sprites);
+};
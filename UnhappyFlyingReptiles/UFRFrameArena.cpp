@@ -0,0 +1,126 @@
+/*
+File:		UFRFrameArena.cpp
+Project:	Unhappy Flying Reptiles
+Author(s):	Jorge Ramirez
+Description:
+	This file contains the method definitions for the UFRFrameArena class.
+*/
+
+#include "UFRFrameArena.h"
+
+
+/*
+Name:	UFRFrameArena()
+Params: size_t size - The number of bytes the arena starts with.
+Description:
+	Constructor for the UFRFrameArena class. The buffer is allocated here.
+*/
+UFRFrameArena::UFRFrameArena(size_t size) : liveBlocks(0)
+{
+	capacity = (size + ARENA_ALIGNMENT - 1) & ~(size_t)(ARENA_ALIGNMENT - 1);
+	memory = (unsigned char*)::operator new(capacity);
+	used = 0;
+	overflowBytes = 0;
+	highWater = 0;
+	overflowCount = 0;
+	skippedResets = 0;
+}
+
+
+
+/*
+Name:	~UFRFrameArena()
+Params: void
+Description:
+	Destructor for the UFRFrameArena class. Every block must have been freed.
+*/
+UFRFrameArena::~UFRFrameArena()
+{
+	::operator delete(memory);
+}
+
+
+
+/*
+Name:	Allocate()
+Params: size_t size - The number of bytes needed.
+Return: void* - The block, aligned to ARENA_ALIGNMENT.
+Description:
+	This method cuts the next block from the buffer, or takes it from the heap when the buffer is full.
+	It may only be called by the thread that owns the arena.
+*/
+void* UFRFrameArena::Allocate(size_t size)
+{
+	void* block;
+
+	size = (size + ARENA_ALIGNMENT - 1) & ~(size_t)(ARENA_ALIGNMENT - 1);
+	liveBlocks++;
+
+	if (size > capacity - used)
+	{
+		overflowBytes += size;
+		overflowCount++;
+		return ::operator new(size);
+	}
+
+	block = memory + used;
+	used += size;
+
+	return block;
+}
+
+
+
+/*
+Name:	Free()
+Params: void* block - A block from Allocate.
+Return: void
+Description:
+	This method gives a block back. Blocks in the buffer are only counted, their memory is reused once the arena is reset.
+	It may be called on any thread.
+*/
+void UFRFrameArena::Free(void* block)
+{
+	if (block < memory || block >= memory + capacity)
+	{
+		::operator delete(block);
+	}
+	liveBlocks--;
+}
+
+
+
+/*
+Name:	Reset()
+Params: void
+Return: bool - Whether the buffer was reused. It is not while any block is still in use.
+Description:
+	This method starts a new cycle, reusing the whole buffer. After a cycle that overflowed,
+	the buffer is first grown to hold everything the cycle asked for.
+	It may only be called by the thread that owns the arena.
+*/
+bool UFRFrameArena::Reset()
+{
+	if (liveBlocks != 0)
+	{
+		skippedResets++;
+		return false;
+	}
+
+	if (used + overflowBytes > highWater)
+	{
+		highWater = used + overflowBytes;
+	}
+
+	if (overflowBytes > 0)
+	{
+		::operator delete(memory);
+		capacity = capacity * 2 > highWater ? capacity * 2 : highWater;
+		memory = (unsigned char*)::operator new(capacity);
+	}
+
+	used = 0;
+	overflowBytes = 0;
+
+	return true;
+}
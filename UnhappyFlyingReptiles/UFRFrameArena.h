@@ -0,0 +1,120 @@
+/*
+File:		UFRFrameArena.h
+Project:	Unhappy Flying Reptiles
+Author(s):	Jorge Ramirez
+Description:
+	This file contains the class definitions for the UFRFrameArena and UFRArenaAllocator classes.
+*/
+
+#pragma once
+#include <stddef.h>
+#include <new>
+#include <utility>
+#include <atomic>
+
+#define ARENA_ALIGNMENT 16 // Every block starts on this many bytes, enough for any type the game allocates
+
+
+/*
+Name: UFRFrameArena
+Description:
+	This class is designed to hand out the memory that only lives for one tick or one frame without going to the heap.
+	Blocks are cut one after another from a single buffer and the whole buffer is reused when the arena is reset,
+	so allocating is an addition and freeing is a counter.
+	Only the thread that owns the arena allocates from it, but blocks may be freed on any thread,
+	so jobs allocated from it can be released by the worker that ran them.
+	When the buffer runs out, blocks come from the heap instead, and the next reset grows the buffer to fit
+	what the last cycle used, so the arena only allocates while it learns how much a cycle needs.
+	Nothing here depends on MFC.
+*/
+class UFRFrameArena
+{
+private:
+	unsigned char* memory;
+	size_t capacity;
+	size_t used;
+	size_t overflowBytes; // Asked for from the heap since the last reset
+	size_t highWater; // The most one cycle has used
+	std::atomic<int> liveBlocks; // Blocks not freed yet, in the buffer or on the heap
+	unsigned int overflowCount;
+	unsigned int skippedResets;
+
+	UFRFrameArena(const UFRFrameArena&);
+	UFRFrameArena& operator=(const UFRFrameArena&);
+
+public:
+	UFRFrameArena(size_t size);
+	~UFRFrameArena();
+
+	void* Allocate(size_t size);
+	void Free(void* block);
+	bool Reset();
+
+	size_t GetCapacity() { return capacity; }
+	size_t GetHighWater() { return highWater; }
+	unsigned int GetOverflowCount() { return overflowCount; }
+	unsigned int GetSkippedResets() { return skippedResets; }
+};
+
+
+/*
+Name: UFRArenaAllocator
+Description:
+	This class is designed to let standard containers and shared pointers take their memory from a frame arena.
+	An allocator without an arena uses the heap, so the same code works with or without one.
+*/
+template <class T>
+class UFRArenaAllocator
+{
+public:
+	typedef T value_type;
+	typedef T* pointer;
+	typedef const T* const_pointer;
+	typedef T& reference;
+	typedef const T& const_reference;
+	typedef size_t size_type;
+	typedef ptrdiff_t difference_type;
+
+	template <class U>
+	struct rebind
+	{
+		typedef UFRArenaAllocator<U> other;
+	};
+
+	UFRFrameArena* arena;
+
+	UFRArenaAllocator(UFRFrameArena* frameArena) { arena = frameArena; }
+	template <class U>
+	UFRArenaAllocator(const UFRArenaAllocator<U>& other) { arena = other.arena; }
+
+	T* address(T& value) const { return &value; }
+	const T* address(const T& value) const { return &value; }
+	size_t max_size() const { return (size_t)-1 / sizeof(T); }
+
+	T* allocate(size_t count, const void* = NULL)
+	{
+		return (T*)(arena != NULL ? arena->Allocate(count * sizeof(T)) : ::operator new(count * sizeof(T)));
+	}
+
+	void deallocate(T* block, size_t)
+	{
+		if (arena != NULL)
+		{
+			arena->Free(block);
+		}
+		else
+		{
+			::operator delete(block);
+		}
+	}
+
+	template <class U, class... Args>
+	void construct(U* place, Args&&... args) { ::new((void*)place) U(std::forward<Args>(args)...); }
+	template <class U>
+	void destroy(U* place) { place->~U(); }
+};
+
+template <class T, class U>
+bool operator==(const UFRArenaAllocator<T>& first, const UFRArenaAllocator<U>& second) { return first.arena == second.arena; }
+template <class T, class U>
+bool operator!=(const UFRArenaAllocator<T>& first, const UFRArenaAllocator<U>& second) { return first.arena != second.arena; }
@@ -0,0 +1,368 @@
+/*
+File:		UFRFrameCapture.cpp
+Project:	Unhappy Flying Reptiles
+Author(s):	Jorge Ramirez
+Description:
+	This file contains the method definitions for the UFRFrameCapture class.
+*/
+
+#include "UFRFrameCapture.h"
+#include "UFRTrace.h"
+#include <wchar.h>
+#include <string.h>
+#include <stdlib.h>
+
+#ifdef _WIN32
+#include <io.h>
+#include <fcntl.h>
+#endif
+
+#define RGBA_BYTES_PER_PIXEL 4
+#define Y4M_PLANES 3
+#define Y4M_FRAME_HEADER "FRAME\n"
+#define Y4M_FRAME_HEADER_SIZE 6
+#define STANDARD_OUTPUT_PATH L"-"
+
+
+/*
+Name:	UFRFrameCapture()
+Params: void
+Description:
+	Constructor for the UFRFrameCapture class. Nothing is written until Open is called.
+*/
+UFRFrameCapture::UFRFrameCapture()
+{
+	output = NULL;
+	ownsOutput = false;
+	format = CAPTURE_FORMAT_RGBA;
+	width = 0;
+	height = 0;
+	frameSize = 0;
+	bufferFull[0] = false;
+	bufferFull[1] = false;
+	fillIndex = 0;
+	closing = false;
+	writeFailed = false;
+	framesWritten = 0;
+}
+
+
+
+/*
+Name:	~UFRFrameCapture()
+Params: void
+Description:
+	Destructor for the UFRFrameCapture class. Any frames still waiting are written and the output is closed.
+*/
+UFRFrameCapture::~UFRFrameCapture()
+{
+	Close();
+}
+
+
+
+/*
+Name:	FormatFromPath()
+Params: const wchar_t* path - The path of the capture file.
+Return: int - CAPTURE_FORMAT_Y4M if the path ends in .y4m, otherwise CAPTURE_FORMAT_RGBA.
+Description:
+	This method picks the capture format from the file extension.
+*/
+int UFRFrameCapture::FormatFromPath(const wchar_t* path)
+{
+	size_t length = wcslen(path);
+
+	if (length >= 4 && (wcscmp(path + length - 4, L".y4m") == 0 || wcscmp(path + length - 4, L".Y4M") == 0))
+	{
+		return CAPTURE_FORMAT_Y4M;
+	}
+
+	return CAPTURE_FORMAT_RGBA;
+}
+
+
+
+/*
+Name:	Open()
+Params:
+	const wchar_t* path - The file or pipe to write to, or "-" for the standard output.
+	int captureFormat - CAPTURE_FORMAT_RGBA or CAPTURE_FORMAT_Y4M.
+	int frameWidth - The width of every frame.
+	int frameHeight - The height of every frame.
+	int framesPerSecond - The frame rate written to the Y4M header.
+Return: bool - Whether the output could be opened.
+Description:
+	This method opens the output, writes the stream header and starts the writer thread.
+*/
+bool UFRFrameCapture::Open(const wchar_t* path, int captureFormat, int frameWidth, int frameHeight, int framesPerSecond)
+{
+	Close();
+
+	if (wcscmp(path, STANDARD_OUTPUT_PATH) == 0)
+	{
+		output = stdout;
+		ownsOutput = false;
+#ifdef _WIN32
+		_setmode(_fileno(stdout), _O_BINARY);
+#endif
+	}
+	else
+	{
+#ifdef _WIN32
+		output = _wfopen(path, L"wb");
+#else
+		char narrowPath[1024];
+		if (wcstombs(narrowPath, path, sizeof(narrowPath)) == (size_t)-1)
+		{
+			return false;
+		}
+		output = fopen(narrowPath, "wb");
+#endif
+		ownsOutput = true;
+	}
+
+	if (output == NULL)
+	{
+		return false;
+	}
+
+	format = captureFormat;
+	width = frameWidth;
+	height = frameHeight;
+
+	if (format == CAPTURE_FORMAT_Y4M)
+	{
+		// Full resolution chroma keeps the frames exact enough to diff
+		fprintf(output, "YUV4MPEG2 W%d H%d F%d:1 Ip A1:1 C444\n", width, height, framesPerSecond);
+		frameSize = Y4M_FRAME_HEADER_SIZE + Y4M_PLANES * width * height;
+	}
+	else
+	{
+		frameSize = RGBA_BYTES_PER_PIXEL * width * height;
+	}
+
+	for (int buffer = 0; buffer < 2; buffer++)
+	{
+		frameBuffers[buffer].resize(frameSize);
+		bufferFull[buffer] = false;
+	}
+	fillIndex = 0;
+	closing = false;
+	writeFailed = false;
+	framesWritten = 0;
+
+	writerThread = std::thread(&UFRFrameCapture::WriterLoop, this);
+	return true;
+}
+
+
+
+/*
+Name:	WriteFrame()
+Params:
+	const unsigned int* pixels - The first pixel of the frame, as 32 bit ARGB values.
+	int stride - The number of bytes between the rows of the frame.
+Return: bool - False if the output has failed.
+Description:
+	This method converts a frame into the free buffer and hands it to the writer thread.
+	It only waits if the writer is still busy with both buffers.
+*/
+bool UFRFrameCapture::WriteFrame(const unsigned int* pixels, int stride)
+{
+	unsigned char* frame;
+
+	if (output == NULL)
+	{
+		return false;
+	}
+
+	// Wait for the writer to empty the buffer
+	{
+		std::unique_lock<std::mutex> guard(lock);
+		while (bufferFull[fillIndex] && !writeFailed)
+		{
+			bufferEmptied.wait(guard);
+		}
+		if (writeFailed)
+		{
+			return false;
+		}
+	}
+
+	frame = &frameBuffers[fillIndex][0];
+	if (format == CAPTURE_FORMAT_Y4M)
+	{
+		ConvertY4M(pixels, stride, frame);
+	}
+	else
+	{
+		ConvertRGBA(pixels, stride, frame);
+	}
+
+	{
+		std::lock_guard<std::mutex> guard(lock);
+		bufferFull[fillIndex] = true;
+	}
+	bufferFilled.notify_one();
+
+	fillIndex = 1 - fillIndex;
+	return true;
+}
+
+
+
+/*
+Name:	Close()
+Params: void
+Return: bool - Whether every frame was written.
+Description:
+	This method waits for the frames still in the buffers to be written, stops the writer thread and closes the output.
+*/
+bool UFRFrameCapture::Close()
+{
+	bool succeeded;
+
+	if (output == NULL)
+	{
+		return true;
+	}
+
+	{
+		std::lock_guard<std::mutex> guard(lock);
+		closing = true;
+	}
+	bufferFilled.notify_one();
+	writerThread.join();
+
+	succeeded = !writeFailed && fflush(output) == 0;
+	if (ownsOutput)
+	{
+		succeeded = fclose(output) == 0 && succeeded;
+	}
+	output = NULL;
+
+	return succeeded;
+}
+
+
+
+/*
+Name:	WriterLoop()
+Params: void
+Return: void
+Description:
+	This method runs on the writer thread. It writes the buffers out in the order they were filled
+	until the capture is closed and both buffers are empty.
+*/
+void UFRFrameCapture::WriterLoop()
+{
+	int writeIndex = 0;
+
+	UFRTrace::NameThread("Capture writer");
+	while (true)
+	{
+		{
+			std::unique_lock<std::mutex> guard(lock);
+			while (!bufferFull[writeIndex] && !closing)
+			{
+				bufferFilled.wait(guard);
+			}
+			if (!bufferFull[writeIndex])
+			{
+				return;
+			}
+		}
+
+		UFRTraceZone writeZone("WriteFrame");
+		bool written = fwrite(&frameBuffers[writeIndex][0], 1, frameSize, output) == (size_t)frameSize;
+
+		{
+			std::lock_guard<std::mutex> guard(lock);
+			bufferFull[writeIndex] = false;
+			if (written)
+			{
+				framesWritten++;
+			}
+			else
+			{
+				writeFailed = true;
+			}
+		}
+		bufferEmptied.notify_one();
+
+		if (!written)
+		{
+			return;
+		}
+
+		writeIndex = 1 - writeIndex;
+	}
+}
+
+
+
+/*
+Name:	ConvertRGBA()
+Params:
+	const unsigned int* pixels - The first pixel of the frame, as 32 bit ARGB values.
+	int stride - The number of bytes between the rows of the frame.
+	unsigned char* frame - The buffer to write the RGBA bytes to.
+Return: void
+Description:
+	This method reorders the pixels of a frame into R, G, B, A bytes.
+*/
+void UFRFrameCapture::ConvertRGBA(const unsigned int* pixels, int stride, unsigned char* frame)
+{
+	for (int row = 0; row < height; row++)
+	{
+		const unsigned int* sourceRow = (const unsigned int*)((const unsigned char*)pixels + row * stride);
+
+		for (int column = 0; column < width; column++)
+		{
+			unsigned int pixel = sourceRow[column];
+			*frame++ = (unsigned char)(pixel >> 16);
+			*frame++ = (unsigned char)(pixel >> 8);
+			*frame++ = (unsigned char)pixel;
+			*frame++ = (unsigned char)(pixel >> 24);
+		}
+	}
+}
+
+
+
+/*
+Name:	ConvertY4M()
+Params:
+	const unsigned int* pixels - The first pixel of the frame, as 32 bit ARGB values.
+	int stride - The number of bytes between the rows of the frame.
+	unsigned char* frame - The buffer to write the Y4M frame to.
+Return: void
+Description:
+	This method converts a frame into a Y4M frame header followed by the Y, U and V planes,
+	using the integer BT.601 studio range formulas.
+*/
+void UFRFrameCapture::ConvertY4M(const unsigned int* pixels, int stride, unsigned char* frame)
+{
+	unsigned char* yPlane = frame + Y4M_FRAME_HEADER_SIZE;
+	unsigned char* uPlane = yPlane + width * height;
+	unsigned char* vPlane = uPlane + width * height;
+
+	memcpy(frame, Y4M_FRAME_HEADER, Y4M_FRAME_HEADER_SIZE);
+
+	for (int row = 0; row < height; row++)
+	{
+		const unsigned int* sourceRow = (const unsigned int*)((const unsigned char*)pixels + row * stride);
+
+		for (int column = 0; column < width; column++)
+		{
+			unsigned int pixel = sourceRow[column];
+			int red = (pixel >> 16) & 0xFF;
+			int green = (pixel >> 8) & 0xFF;
+			int blue = pixel & 0xFF;
+
+			*yPlane++ = (unsigned char)(((66 * red + 129 * green + 25 * blue + 128) >> 8) + 16);
+			*uPlane++ = (unsigned char)(((-38 * red - 74 * green + 112 * blue + 128) >> 8) + 128);
+			*vPlane++ = (unsigned char)(((112 * red - 94 * green - 18 * blue + 128) >> 8) + 128);
+		}
+	}
+}
@@ -0,0 +1,68 @@
+/*
+File:		UFRFrameCapture.h
+Project:	Unhappy Flying Reptiles
+Author(s):	Jorge Ramirez
+Description:
+	This file contains the class definition for the UFRFrameCapture class.
+*/
+
+#pragma once
+#include <stdio.h>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+#define CAPTURE_FORMAT_RGBA 0
+#define CAPTURE_FORMAT_Y4M 1
+
+
+/*
+Name: UFRFrameCapture
+Description:
+	This class is designed to write game frames to a raw video file or pipe.
+	Frames are either raw RGBA, 4 bytes per pixel with no header, or YUV4MPEG2 with full resolution chroma.
+	Each frame is converted into one of two buffers and written out by a writer thread, so converting
+	the next frame overlaps with writing the last one and the game only waits when the disk falls behind.
+	Nothing here depends on MFC.
+*/
+class UFRFrameCapture
+{
+private:
+	FILE* output;
+	bool ownsOutput; // False when writing to the standard output
+	int format;
+	int width;
+	int height;
+	int frameSize;
+
+	std::vector<unsigned char> frameBuffers[2];
+	bool bufferFull[2];
+	int fillIndex; // The buffer the next frame is converted into
+
+	std::thread writerThread;
+	std::mutex lock;
+	std::condition_variable bufferFilled;
+	std::condition_variable bufferEmptied;
+	bool closing;
+	bool writeFailed;
+	unsigned int framesWritten;
+
+	void WriterLoop();
+	void ConvertRGBA(const unsigned int* pixels, int stride, unsigned char* frame);
+	void ConvertY4M(const unsigned int* pixels, int stride, unsigned char* frame);
+
+	UFRFrameCapture(const UFRFrameCapture&);
+	UFRFrameCapture& operator=(const UFRFrameCapture&);
+
+public:
+	UFRFrameCapture();
+	~UFRFrameCapture();
+
+	bool Open(const wchar_t* path, int captureFormat, int frameWidth, int frameHeight, int framesPerSecond);
+	bool WriteFrame(const unsigned int* pixels, int stride);
+	bool Close();
+
+	unsigned int GetFramesWritten() { return framesWritten; }
+	static int FormatFromPath(const wchar_t* path);
+};
@@ -0,0 +1,167 @@
+/*
+File:		UFRFramePacer.cpp
+Project:	Unhappy Flying Reptiles
+Author(s):	Jorge Ramirez
+Description:
+	This file contains the method definitions for the UFRFramePacer class.
+*/
+
+#include "UFRFramePacer.h"
+
+#define OVERSHOOT_DECAY 16 // How slowly the sleep overshoot estimate falls when sleeps wake up earlier
+#define OVERSHOOT_MAX_FRACTION 4 // The overshoot estimate is kept under this fraction of the interval
+
+
+/*
+Name:	UFRFramePacer()
+Params:
+	UFRClock* paceClock - The clock to pace against. It is not owned by the pacer.
+	long long frameInterval - The time between frames in microseconds.
+	long long spinTime - How long before each deadline to stop sleeping and spin, in microseconds.
+Description:
+	Constructor for the UFRFramePacer class.
+*/
+UFRFramePacer::UFRFramePacer(UFRClock* paceClock, long long frameInterval, long long spinTime)
+{
+	clock = paceClock;
+	interval = frameInterval;
+	spinMargin = spinTime;
+	sleepOvershoot = 0;
+	nextDeadline = 0;
+	ResetStats();
+}
+
+
+
+/*
+Name:	Start()
+Params: void
+Return: void
+Description:
+	This method sets the first deadline one interval from now.
+*/
+void UFRFramePacer::Start()
+{
+	nextDeadline = clock->Now() + interval;
+}
+
+
+
+/*
+Name:	ResetStats()
+Params: void
+Return: void
+Description:
+	This method clears the frame and deadline statistics.
+*/
+void UFRFramePacer::ResetStats()
+{
+	frameCount = 0;
+	missedCount = 0;
+	skippedCount = 0;
+	totalWakeUpError = 0;
+	maxWakeUpError = 0;
+	maxLateness = 0;
+}
+
+
+
+/*
+Name:	WaitForNextFrame()
+Params: void
+Return: long long - The deadline that was waited for, in microseconds.
+Description:
+	This method waits until the next frame deadline and moves the deadline on by one interval.
+	If the deadline has already passed the frame is counted as missed and the method returns straight away.
+	Any further deadlines that have also passed are skipped so the loop gets back onto the grid.
+	The sleep overshoot estimate is capped at a fraction of the interval, so one sleep that wakes up very late,
+	such as when the thread is preempted, does not make the frames after it spin for most of their wait.
+*/
+long long UFRFramePacer::WaitForNextFrame()
+{
+	long long deadline = nextDeadline;
+	long long now = clock->Now();
+
+	frameCount++;
+
+	if (now > deadline)
+	{
+		long long lateness = now - deadline;
+		long long skipped = lateness / interval;
+
+		// The work since the last frame ran past this deadline
+		missedCount++;
+		if (lateness > maxLateness)
+		{
+			maxLateness = lateness;
+		}
+
+		// Skip the deadlines that have already gone by
+		skippedCount += (unsigned int)skipped;
+		deadline += skipped * interval;
+		nextDeadline = deadline + interval;
+		return deadline;
+	}
+
+	// Sleep for most of the wait, then spin for the last stretch.
+	// The spin starts early enough to cover how late sleeps have been waking up.
+	if (deadline - now > spinMargin + sleepOvershoot)
+	{
+		long long wakeUpTime = deadline - spinMargin - sleepOvershoot;
+		long long overshoot;
+
+		clock->Sleep(wakeUpTime - now);
+		overshoot = clock->Now() - wakeUpTime;
+
+		// Follow a later wake up straight away, and an earlier one slowly
+		if (overshoot > sleepOvershoot)
+		{
+			sleepOvershoot = overshoot;
+		}
+		else
+		{
+			sleepOvershoot -= (sleepOvershoot - overshoot) / OVERSHOOT_DECAY;
+		}
+		if (sleepOvershoot > interval / OVERSHOOT_MAX_FRACTION)
+		{
+			sleepOvershoot = interval / OVERSHOOT_MAX_FRACTION;
+		}
+	}
+	now = clock->Now();
+	while (now < deadline)
+	{
+		clock->Spin();
+		now = clock->Now();
+	}
+
+	// How late the wait woke up
+	totalWakeUpError += now - deadline;
+	if (now - deadline > maxWakeUpError)
+	{
+		maxWakeUpError = now - deadline;
+	}
+
+	nextDeadline = deadline + interval;
+	return deadline;
+}
+
+
+
+/*
+Name:	GetAverageWakeUpError()
+Params: void
+Return: double - The average time in microseconds that a wait woke up after its deadline.
+Description:
+	This method returns how precisely the waits that were on time hit their deadlines.
+*/
+double UFRFramePacer::GetAverageWakeUpError()
+{
+	unsigned int onTimeCount = frameCount - missedCount;
+
+	if (onTimeCount == 0)
+	{
+		return 0;
+	}
+
+	return totalWakeUpError / (double)onTimeCount;
+}
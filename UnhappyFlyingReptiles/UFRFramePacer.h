@@ -0,0 +1,53 @@
+/*
+File:		UFRFramePacer.h
+Project:	Unhappy Flying Reptiles
+Author(s):	Jorge Ramirez
+Description:
+	This file contains the class definition for the UFRFramePacer class.
+*/
+
+#pragma once
+#include "UFRClock.h"
+
+
+/*
+Name: UFRFramePacer
+Description:
+	This class is designed to run a loop at a fixed rate.
+	Deadlines are kept on a fixed grid from the start time so they never drift. Waiting for a deadline sleeps
+	until shortly before it and then spins, so the wake up is not limited by the system timer granularity.
+	The pacer learns how late sleeps wake up and starts spinning that much earlier.
+	A frame that is already late when the wait starts counts as a missed deadline, and deadlines that have
+	already gone by are skipped instead of being run back to back.
+*/
+class UFRFramePacer
+{
+private:
+	UFRClock* clock;
+	long long interval; // In microseconds
+	long long spinMargin; // How long before the deadline to stop sleeping and start spinning
+	long long sleepOvershoot; // How late sleeps have recently been waking up
+	long long nextDeadline;
+
+	unsigned int frameCount;
+	unsigned int missedCount;
+	unsigned int skippedCount;
+	long long totalWakeUpError;
+	long long maxWakeUpError;
+	long long maxLateness;
+
+public:
+	UFRFramePacer(UFRClock* paceClock, long long frameInterval, long long spinTime);
+
+	void Start();
+	long long WaitForNextFrame();
+	void ResetStats();
+
+	long long GetInterval() { return interval; }
+	unsigned int GetFrameCount() { return frameCount; }
+	unsigned int GetMissedCount() { return missedCount; }
+	unsigned int GetSkippedCount() { return skippedCount; }
+	double GetAverageWakeUpError();
+	long long GetMaxWakeUpError() { return maxWakeUpError; }
+	long long GetMaxLateness() { return maxLateness; }
+};
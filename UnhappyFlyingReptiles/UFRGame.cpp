@@ -8,8 +8,15 @@ Description:
 
 #include "UFRGame.h"
 #include <list>
+#include <string>
+#include <string.h>
+#include <psapi.h>
+
+#pragma comment(lib, "psapi.lib")
 
 #define BYTES_PER_PIXEL 4
+#define BYTES_PER_KILOBYTE 1024
+#define MILLISECONDS_PER_SECOND 1000
 #define SLINGSHOT_SCALE 0.7
 
 #define INIT_LEFT_OFFSET 0
@@ -19,78 +26,395 @@ Description:
 #define HORIZONTAL_VEL_INCREASE 1.15
 
 #define REPTILE_RESET_TICKS 15
+#define PARALLEL_COLLISION_PAIRS 64 // Fewer pairs than this resolve faster on one thread than they take to hand out
+
+#define TICK_ARENA_SIZE 65536 // Grows on its own for levels that need more
+#define ALLOCATION_WARM_UP_TICKS 100 // Ticks and frames that may allocate while containers grow to the size play needs
+#define ALLOCATION_WARM_UP_FRAMES 300
 
 #define NUM_OF_CRATES 5
 #define NUM_OF_TNT_CRATES 1
 
-#define SOUND_CHANNELS 16
+#define SOUND_VOLUME 1.0f
+
+// The punch and the thud tell the player what happened, so they win over the shot and the fall
+#define SOUND_PRIORITY_SHOOT 0
+#define SOUND_PRIORITY_FALL 1
+#define SOUND_PRIORITY_THUD 2
+#define SOUND_PRIORITY_PUNCH 3
+
+#define SOUND_SHOOT "shoot.wav"
+#define SOUND_PUNCH "punch.wav"
+#define SOUND_FALL "falling.wav"
+#define SOUND_THUD "thud.wav"
 
 
 /*
 Name:	UFRGame()
-Params: void
+Params:
+	unsigned int seed - The seed for the random numbers of the game. The same seed gives the same game.
+	UFRAudioOutput* output - Where the game sounds go, or NULL for nowhere. The game deletes it.
+	UFRClock* clock - The clock clicks are timed with, or NULL to not measure input latency. It must outlive the game.
 Return: void
 Description:
 	Constructor for the UFRGame class.
-	The necessary game bitmaps are loaded and color adjusted here.
+	When there is a cooked asset pack the backdrop, the atlas and the sounds are used from it in place.
+	Otherwise only the backdrop is waited for here, its three layers decoded in parallel, so the window can show it straight away.
+	The sprites start decoding in the background and the game objects are created by FinishLoading.
 */
-UFRGame::UFRGame()
+UFRGame::UFRGame(unsigned int seed, UFRAudioOutput* output, UFRClock* clock) : tickArena(TICK_ARENA_SIZE)
 {
-	// load game images
-	background = new Bitmap(TEXT(".\\Background.bmp"));
-	midground = new Bitmap(TEXT(".\\Midground.bmp"));
-	foreground = new Bitmap(TEXT(".\\Foreground.bmp"));
-	slingshot1 = new Bitmap(TEXT(".\\slingshot1.png"));
-	slingshot2 = new Bitmap(TEXT(".\\slingshot2.png"));
-
-	// Create and init fmod system
-	FMOD::System_Create(&fmodSystem);
-	fmodSystem->init(SOUND_CHANNELS, FMOD_INIT_NORMAL, NULL);
-
-	// Init game sounds
-	fmodSystem->createSound("shoot.wav", FMOD_HARDWARE, 0, &shootSound);
-	fmodSystem->createSound("punch.wav", FMOD_HARDWARE, 0, &punchSound);
-	fmodSystem->createSound("falling.wav", FMOD_HARDWARE, 0, &fallSound);
-	fmodSystem->createSound("thud.wav", FMOD_HARDWARE, 0, &thudSound);
+	std::vector<UFRImageFuture> backdropLoads;
+	std::vector<UFRSpriteRequest> spriteFiles;
+	const UFRPackEntry* atlasEntry;
+	UFRTraceZone loadZone("LoadAssets");
+
+	ReportMemory(TEXT("before loading"));
+
+	gameSeed = seed;
+	levelPath = LEVEL_FILE;
+	reptile = -1;
+	spritesReady = false;
+	backdrop = NULL;
+	inputClock = clock;
+	pendingInputTime = 0;
+	lastDrawnInput = 0;
+	steadyAllocationsForbidden = false;
+
+	// One job system does all the parallel work, from decoding the assets to scaling frames
+	jobSystem = new UFRJobSystem(0);
+	assetLoader = new UFRAssetLoader(jobSystem);
+	atlas = new UFRSpriteAtlas();
+
+	// A cooked pack is used where it is mapped, with nothing to decode
+	assetPack = new UFRAssetPack();
+	if (assetPack->Open(PACK_FILE))
+	{
+		backdrop = assetPack->CreateImageView(PACK_BACKDROP);
+		atlasEntry = assetPack->Find(PACK_ATLAS);
+		if (backdrop == NULL || atlasEntry == NULL || atlasEntry->type != PACK_ENTRY_ATLAS ||
+			!atlas->LoadView(assetPack->GetData(atlasEntry), atlasEntry->size))
+		{
+			TRACE(TEXT("Asset pack is incomplete, loading the source files\n"));
+			delete backdrop;
+			backdrop = NULL;
+			delete assetPack;
+			assetPack = NULL;
+		}
+	}
+	else
+	{
+		delete assetPack;
+		assetPack = NULL;
+	}
 
-	// Create image buffer
-	buffer = background->Clone(0, 0, background->GetWidth(), background->GetHeight(), PixelFormat32bppARGB);
-	bufferCanvas = Graphics::FromImage(buffer);
+	if (backdrop == NULL)
+	{
+		// Start decoding the backdrop layers
+		backdropLoads.push_back(assetLoader->DecodeImage(TEXT(".\\Background.bmp")));
+		backdropLoads.push_back(assetLoader->DecodeImage(TEXT(".\\Midground.bmp")));
+		backdropLoads.push_back(assetLoader->DecodeImage(TEXT(".\\Foreground.bmp")));
+
+		// Sprites come from the baked atlas when there is one,
+		// otherwise they are decoded and reduced to the scale they are drawn at in the background
+		if (!atlas->Load(ATLAS_FILE))
+		{
+			spriteFiles.push_back(UFRSpriteRequest(TEXT(".\\slingshot1.png"), SLINGSHOT_SCALE));
+			spriteFiles.push_back(UFRSpriteRequest(TEXT(".\\slingshot2.png"), SLINGSHOT_SCALE));
+			UFRReptiles::ListSpriteFiles(spriteFiles);
+			UFRCrates::ListSpriteFiles(spriteFiles);
+			for (int file = 0; file < spriteFiles.size(); file++)
+			{
+				spriteLoads.push_back(assetLoader->DecodeSprite(spriteFiles[file]));
+			}
+		}
+	}
 
-	// Remove green from background and midground images
-	MakeTransparent(midground, Color(0, 255, 0));
-	MakeTransparent(foreground, Color(0, 255, 0));
+	// Load the game sounds into the mixer while the images decode
+	loadZone.Next("LoadSounds");
+	audioOutput = output != NULL ? output : new UFRNullOutput();
+	mixer = new UFRMixer(audioOutput, inputClock);
+	shootSound = LoadSound(SOUND_SHOOT, SOUND_PRIORITY_SHOOT);
+	punchSound = LoadSound(SOUND_PUNCH, SOUND_PRIORITY_PUNCH);
+	fallSound = LoadSound(SOUND_FALL, SOUND_PRIORITY_FALL);
+	thudSound = LoadSound(SOUND_THUD, SOUND_PRIORITY_THUD);
+	tickSounds = mixer->CreateQueue();
+	mixer->Start();
+
+	if (backdrop == NULL)
+	{
+		loadZone.Next("ComposeBackdrop");
+		ComposeBackdrop(backdropLoads);
+	}
 
 	// The natural size of the background image
-	imageWidth = background->GetWidth();
-	imageHeight = background->GetHeight();
+	imageWidth = backdrop->GetWidth();
+	imageHeight = backdrop->GetHeight();
+
+	// Create image buffer
+	buffer = new Bitmap(imageWidth, imageHeight, PixelFormat32bppARGB);
+	bufferCanvas = Graphics::FromImage(buffer);
+
+	// Create the presenter that copies the buffer to the window, scaling on all processors
+	presenter = new UFRPresenter(imageWidth, imageHeight, jobSystem);
 
-	// Start the reptile off the screen
-	reptileLogic = new UFReptileLogic(0, INIT_GROUND_OFFSET, DEFAULT_HORIZONTAL_VELOCITY, DEFAULT_VERTICAL_VELOCITY);
 	deadTicks = 0; 
 	floorHit = false;
 	reptileFliesLeft = false;
 
-	// Create the crates
-	crates.push_back(new Crate(100, 20, 15, 0.5, 0.5));
-	crates.push_back(new Crate(85, 100));
-	crates.push_back(new Crate(135, 100));
-	crates.push_back(new Crate(80, 180, 2, 0.5, 0.3));
-	crates.push_back(new Crate(110, 180, 2, 0.5, 0.3));
-	crates.push_back(new Crate(140, 180, 2, 0.5, 0.3));
-	crates.push_back(new Crate(170, 180, 2, 0.5, 0.3));
-
-	crates.push_back(new Crate(500, 20, 15, 0.5, 0.5));
-	crates.push_back(new Crate(485, 100));
-	crates.push_back(new Crate(535, 100));
-	crates.push_back(new Crate(480, 180, 2, 0.5, 0.3));
-	crates.push_back(new Crate(510, 180, 2, 0.5, 0.3));
-	crates.push_back(new Crate(540, 180, 2, 0.5, 0.3));
-	crates.push_back(new Crate(570, 180, 2, 0.5, 0.3));
-
 	// Initiate mouse position
 	mouseX = 0;
 	mouseY = 0;
+	droppedInputs = 0;
+	hasHeldInput = false;
+	tickIndex = 0;
+	inputRecording = NULL;
+
+	QueryPerformanceFrequency(&counterFrequency);
+	ReportMemory(TEXT("backdrop loaded"));
+}
+
+
+
+/*
+Name:	ComposeBackdrop()
+Params: std::vector<UFRImageFuture>& layers - The background, midground and foreground being decoded.
+Return: void
+Description:
+	This method waits for the backdrop layers and composites them into the backdrop.
+*/
+void UFRGame::ComposeBackdrop(std::vector<UFRImageFuture>& layers)
+{
+	Graphics* backdropCanvas;
+
+	// Wait for the backdrop layers
+	std::shared_ptr<Bitmap> background = layers[0].get();
+	std::shared_ptr<Bitmap> midground = layers[1].get();
+	std::shared_ptr<Bitmap> foreground = layers[2].get();
+
+	// Remove green from background and midground images.
+	// The layers are only used here, so changing the shared decodes is safe.
+	MakeTransparent(midground.get(), Color(0, 255, 0));
+	MakeTransparent(foreground.get(), Color(0, 255, 0));
+
+	// The backdrop never changes, so composite it once instead of on every frame
+	backdrop = background->Clone(0, 0, background->GetWidth(), background->GetHeight(), PixelFormat32bppARGB);
+	backdropCanvas = Graphics::FromImage(backdrop);
+	backdropCanvas->DrawImage(midground.get(), 0, 0, backdrop->GetWidth(), backdrop->GetHeight());
+	backdropCanvas->DrawImage(foreground.get(), 0, 0, backdrop->GetWidth(), backdrop->GetHeight());
+	delete backdropCanvas;
+}
+
+
+
+/*
+Name:	LoadSound()
+Params:
+	const char* file - The WAV file of the sound, which is also its name in the asset pack.
+	int priority - How much the sound matters when the mixer runs out of voices.
+Return: int - The number of the sound in the mixer, or -1 if it could not be loaded.
+Description:
+	This method adds a sound to the mixer. Cooked samples are played where they are mapped in the asset pack,
+	otherwise the WAV file is decoded and resampled.
+*/
+int UFRGame::LoadSound(const char* file, int priority)
+{
+	const UFRPackEntry* entry = assetPack != NULL ? assetPack->Find(file) : NULL;
+	std::string narrowFile(file);
+	std::wstring wideFile(narrowFile.begin(), narrowFile.end());
+	int sound;
+
+	if (entry != NULL && entry->type == PACK_ENTRY_SOUND && entry->sampleRate == MIXER_SAMPLE_RATE && entry->channels > 0)
+	{
+		sound = mixer->AddSound((const float*)assetPack->GetData(entry),
+			(int)(entry->size / (sizeof(float) * entry->channels)), entry->channels, priority);
+		if (sound >= 0)
+		{
+			return sound;
+		}
+	}
+
+	sound = mixer->LoadSound(wideFile.c_str(), priority);
+	if (sound < 0)
+	{
+		TRACE(TEXT("Sound: could not load %S\n"), file);
+	}
+
+	return sound;
+}
+
+
+
+/*
+Name:	ListSoundFiles()
+Params: std::vector<std::string>& files - The list to add the sound files to.
+Return: void
+Description:
+	This method lists every sound the game plays, for the asset pack cooker.
+*/
+void UFRGame::ListSoundFiles(std::vector<std::string>& files)
+{
+	files.push_back(SOUND_SHOOT);
+	files.push_back(SOUND_PUNCH);
+	files.push_back(SOUND_FALL);
+	files.push_back(SOUND_THUD);
+}
+
+
+
+/*
+Name:	FinishLoading()
+Params: void
+Return: void
+Description:
+	This method waits for the sprites to decode, creates the reptile and the crates and packs the sprite atlas.
+	The reptile is created first so it is drawn behind the crates. The crates come from the level set by SetLevel.
+	It runs on the simulation thread before the first tick. Until it is done the renderer only draws the backdrop.
+*/
+void UFRGame::FinishLoading()
+{
+	std::vector<std::shared_ptr<Bitmap> > decodedSprites;
+	UFRLevel level;
+
+	if (spritesReady)
+	{
+		return;
+	}
+
+	UFRTraceZone loadZone("WaitForSprites");
+
+	// Hold on to the reduced sprites so the atlas finds them in the sprite manager
+	for (int sprite = 0; sprite < spriteLoads.size(); sprite++)
+	{
+		decodedSprites.push_back(spriteLoads[sprite].get());
+	}
+	spriteLoads.clear();
+	delete assetLoader;
+	assetLoader = NULL;
+
+	loadZone.Next("CreateLevel");
+	slingshot1 = atlas->Add(TEXT(".\\slingshot1.png"), SLINGSHOT_SCALE);
+	slingshot2 = atlas->Add(TEXT(".\\slingshot2.png"), SLINGSHOT_SCALE);
+
+	// Start the reptile off the screen.
+	// The random numbers are seeded on the thread that uses them.
+	srand(gameSeed);
+	reptile = UFRReptiles::Create(&world, atlas, 0, INIT_GROUND_OFFSET, DEFAULT_HORIZONTAL_VELOCITY, DEFAULT_VERTICAL_VELOCITY);
+
+	// Create the crates of the level, from the text it is authored in when it has not been converted
+	if (level.Open(levelPath.c_str()) || (levelPath == LEVEL_FILE && level.Parse(LEVEL_SOURCE_FILE)))
+	{
+		UFRCrates::CreateFromLevel(&world, atlas, &level);
+		TRACE(TEXT("Level: %d crates\n"), level.GetCrateCount());
+	}
+	else
+	{
+		TRACE(TEXT("Level: could not load %s\n"), levelPath.c_str());
+	}
+	level.Close();
+
+	// Pack any sprites that were not in the baked atlas and make the collision masks from it
+	loadZone.Next("BuildAtlas");
+	atlas->Build();
+	atlas->BuildMasks();
+
+	// Give the render thread a state to draw and clicks something to hit before the first tick
+	BuildBroadphase();
+	SavePreviousState();
+	PublishSnapshot();
+	spritesReady = true;
+
+	// The reduced sprites are released once this returns, so measure after they are gone
+	decodedSprites.clear();
+	ReportMemory(TEXT("sprites loaded"));
+}
+
+
+
+/*
+Name:	ReportMemory()
+Params: const TCHAR* stage - How far loading has got.
+Return: void
+Description:
+	This method writes the working set and the private memory of the process to the debug output.
+	Private memory is what each running game costs on its own, the working set also counts pages shared
+	with other games, such as the mapped asset pack.
+*/
+void UFRGame::ReportMemory(const TCHAR* stage)
+{
+	PROCESS_MEMORY_COUNTERS_EX counters;
+
+	counters.cb = sizeof(counters);
+	if (GetProcessMemoryInfo(GetCurrentProcess(), (PROCESS_MEMORY_COUNTERS*)&counters, sizeof(counters)))
+	{
+		TRACE(TEXT("Memory %s: %u KB working set, %u KB private\n"), stage,
+			(unsigned int)(counters.WorkingSetSize / BYTES_PER_KILOBYTE), (unsigned int)(counters.PrivateUsage / BYTES_PER_KILOBYTE));
+	}
+}
+
+
+
+/*
+Name:	ReportLatency()
+Params:
+	const TCHAR* name - What the latency is from and to.
+	UFRLatencyStats* stats - The measured latencies.
+Return: void
+Description:
+	This method writes the percentiles of a measured latency to the debug output.
+*/
+void UFRGame::ReportLatency(const TCHAR* name, UFRLatencyStats* stats)
+{
+	TRACE(TEXT("%s latency: %u clicks, %.1f ms median, %.1f ms 90th percentile, %.1f ms 99th percentile, %.1f ms worst\n"),
+		name, stats->GetSampleCount(), stats->GetPercentile(50), stats->GetPercentile(90), stats->GetPercentile(99),
+		stats->GetMaxLatency());
+}
+
+
+
+/*
+Name:	ReportJobs()
+Params: void
+Return: void
+Description:
+	This method writes how many jobs each worker of the job system ran and stole, and how much of the time it was busy,
+	to the debug output. The last line counts the threads outside the job system that helped while they waited.
+*/
+void UFRGame::ReportJobs()
+{
+	long long uptime = jobSystem->GetUptime();
+
+	for (int slot = 0; slot < jobSystem->GetSlotCount(); slot++)
+	{
+		TRACE(TEXT("Jobs %s %d: %u run, %u stolen, %.1f%% busy\n"), slot < jobSystem->GetSlotCount() - 1 ? TEXT("worker") : TEXT("other threads"),
+			slot, jobSystem->GetJobsRun(slot), jobSystem->GetSteals(slot), uptime > 0 ? jobSystem->GetBusyTime(slot) * 100.0 / uptime : 0.0);
+	}
+}
+
+
+
+/*
+Name:	ReportAllocations()
+Params: void
+Return: void
+Description:
+	This method writes how many ticks and frames allocated and how much, how much of the tick arena was needed,
+	and how many allocations were made while they were forbidden, to the debug output.
+*/
+void UFRGame::ReportAllocations()
+{
+	TRACE(TEXT("Allocations: %u of %u ticks allocated, %.1f allocations and %.0f bytes per tick, %I64u allocations and %I64u bytes at most\n"),
+		tickAllocations.GetAllocatingCount(), tickAllocations.GetCount(), tickAllocations.GetAverageAllocations(),
+		tickAllocations.GetAverageBytes(), tickAllocations.GetMaxAllocations(), tickAllocations.GetMaxBytes());
+	TRACE(TEXT("Allocations: %u of %u frames allocated, %.1f allocations and %.0f bytes per frame, %I64u allocations and %I64u bytes at most\n"),
+		frameAllocations.GetAllocatingCount(), frameAllocations.GetCount(), frameAllocations.GetAverageAllocations(),
+		frameAllocations.GetAverageBytes(), frameAllocations.GetMaxAllocations(), frameAllocations.GetMaxBytes());
+	TRACE(TEXT("Tick arena: %u of %u bytes used at most, %u blocks from the heap, %u resets skipped\n"),
+		(unsigned int)tickArena.GetHighWater(), (unsigned int)tickArena.GetCapacity(), tickArena.GetOverflowCount(), tickArena.GetSkippedResets());
+	if (steadyAllocationsForbidden)
+	{
+		TRACE(TEXT("Allocations: %u made in steady state\n"), UFRAllocations::GetForbiddenCount());
+	}
 }
 
 
@@ -105,33 +429,36 @@ Description:
 */
 UFRGame::~UFRGame()
 {
-	delete background;
-	delete midground;
-	delete foreground;
+	delete assetLoader;
+	delete backdrop;
 
-	delete slingshot1;
-	delete slingshot2;
+	delete atlas;
+	UFRSpriteManager::GetInstance()->Report();
 
 	delete buffer;
 	delete bufferCanvas;
 
-	delete reptileLogic;
-
-	// delete crates
-	for (int crate = 0; crate < crates.size(); crate++)
-	{
-		delete crates[crate];
-	}
-
-	// release game sounds
-	shootSound->release();
-	punchSound->release();
-	fallSound->release();
-	thudSound->release();
-
-	// close and release fmod
-	fmodSystem->close();
-	fmodSystem->release();
+	presenter->ReportCosts();
+	delete presenter;
+
+	// Stop the workers once nothing submits jobs, after any decode still running is done
+	ReportJobs();
+	ReportAllocations();
+	delete jobSystem;
+
+	// Stop the sound before the samples it plays are unmapped
+	mixer->Stop();
+	ReportLatency(TEXT("Click to photon"), &photonLatency);
+	ReportLatency(TEXT("Click to sound"), mixer->GetSoundLatency());
+	TRACE(TEXT("Input: %u events dropped\n"), (unsigned int)droppedInputs);
+	TRACE(TEXT("Sound: %I64u blocks mixed, %I64u voice blocks, %u voices merged, %u stolen, %u dropped, %u commands dropped\n"),
+		mixer->GetBlocksMixed(), mixer->GetVoiceBlocksMixed(), mixer->GetMergedVoices(), mixer->GetStolenVoices(),
+		mixer->GetDroppedVoices(), mixer->GetDroppedCommands());
+	delete mixer;
+	delete audioOutput;
+
+	// Unmap the pack once nothing uses it
+	delete assetPack;
 }
 
 
@@ -144,13 +471,14 @@ Params:
 Return: void
 Description:
 	This method finds every pixel within a bitmap of a specific color and makes it transparent.
+	It uses nothing of the game, so the benchmarks can run it on bitmaps of their own.
 */
 void UFRGame::MakeTransparent(Bitmap* bmp, Color color)
 {
 	int width = bmp->GetWidth();
 	int length = bmp->GetHeight();
 	Rect bmpDimensions(0, 0, width, length);
-	BitmapData* bmpData = new BitmapData;
+	BitmapData bmpData;
 	UINT* pixels;
 
 	// Convert the color into a single composite value
@@ -159,8 +487,8 @@ void UFRGame::MakeTransparent(Bitmap* bmp, Color color)
 	colorNum = color.GetG() + (colorNum << 8);
 	colorNum = color.GetB() + (colorNum << 8);
 
-	bmp->LockBits(&bmpDimensions, ImageLockModeWrite, PixelFormat32bppARGB, bmpData);
-	pixels = (UINT*)bmpData->Scan0;
+	bmp->LockBits(&bmpDimensions, ImageLockModeWrite, PixelFormat32bppARGB, &bmpData);
+	pixels = (UINT*)bmpData.Scan0;
 
 
 	// Find every pixel of the specific color
@@ -172,9 +500,7 @@ void UFRGame::MakeTransparent(Bitmap* bmp, Color color)
 		}
 	}
 
-	bmp->UnlockBits(bmpData);
-
-	delete bmpData;
+	bmp->UnlockBits(&bmpData);
 }
 
 
@@ -186,112 +512,216 @@ Params:
 	CRect* dimensions - The desired dimensions of the images to be drawn to the Graphics object.
 Return: void
 Description:
-	This method draws all the game images onto a Graphics object.
+	This method draws the latest published game state onto a Graphics object.
+	It only reads the snapshot and the sprites, so it runs on the render thread while the game keeps ticking.
+	The allocations of every frame drawn once loading is finished are counted.
 */
 void UFRGame::Draw(Graphics* canvas, CRect* dimensions)
 {
-	// The stretched size of the window
-	int windowWidth = dimensions->Width();
-	int windowHeight = dimensions->Height();
+	LARGE_INTEGER now;
+	long long inputTime;
+	bool loaded = spritesReady;
+	UFRAllocationScope allocationScope(loaded ? &frameAllocations : NULL,
+		loaded && steadyAllocationsForbidden && frameAllocations.GetCount() >= ALLOCATION_WARM_UP_FRAMES);
+	UFRTraceZone drawZone("Draw");
+	UFRTraceZone phaseZone("Compose");
+
+	// Pick up the latest state published by the simulation
+	snapshots.Update();
+
+	// How far the render is into the tick after the current one
+	QueryPerformanceCounter(&now);
+	float alpha = (now.QuadPart - snapshots.GetReadBuffer().tickTime) * 1000.0f / (counterFrequency.QuadPart * (float)GAME_LOOP_INTERVAL);
+	if (alpha < 0)
+	{
+		alpha = 0;
+	}
+	else if (alpha > 1)
+	{
+		alpha = 1;
+	}
 
-	// Calc scaled mouse position
-	int scaledMouseX = (mouseX / (float)windowWidth) * imageWidth;
-	int scaledMouseY = (mouseY / (float)windowHeight) * imageHeight;
+	Compose(alpha);
 
-	// Calculate the scaled size of the slingshot
-	int scaleSlngWidth = slingshot1->GetWidth() * SLINGSHOT_SCALE;
-	int scaleSlngHeight = slingshot1->GetHeight() * SLINGSHOT_SCALE;
+	// Draw buffer to canvas
+	phaseZone.Next("Present");
+	presenter->Present(canvas, buffer, dimensions);
 
-	// If the reptile is out of bounds of the screen, draw it on the other side
-	if (reptileLogic->GetLeftOffset() > imageWidth)
+	// The first frame drawn from the tick that took in a click is the one that shows it
+	inputTime = snapshots.GetReadBuffer().inputTime;
+	if (inputClock != NULL && inputTime != 0 && inputTime != lastDrawnInput)
 	{
-		reptileLogic->SetLeftOffset(-reptileLogic->GetWidth());
-	}
-	else if (reptileLogic->GetLeftOffset() < -reptileLogic->GetWidth())
-	{
-		reptileLogic->SetLeftOffset(imageWidth);
+		photonLatency.Record(inputClock->Now() - inputTime);
+		lastDrawnInput = inputTime;
 	}
+}
 
-	// Draw Backdrop to buffer
-	bufferCanvas->DrawImage(background, 0, 0);
-	bufferCanvas->DrawImage(midground, 0, 0);
-	bufferCanvas->DrawImage(foreground, 0, 0);
 
-	// Set up tranformations for reptile:
-	// center, rotate, and return to original offset
-	bufferCanvas->TranslateTransform(-(reptileLogic->GetLeftOffset() + reptileLogic->GetWidth() / 2),
-		-(imageHeight - reptileLogic->GetBottomOffset() - reptileLogic->GetHeight() / 2));
-	bufferCanvas->RotateTransform(reptileLogic->GetReptileRotation(), MatrixOrderAppend);
-	bufferCanvas->TranslateTransform((reptileLogic->GetLeftOffset() + reptileLogic->GetWidth() / 2),
-		(imageHeight - reptileLogic->GetBottomOffset() - reptileLogic->GetHeight() / 2), MatrixOrderAppend);
 
-	// Draw reptile with transformations
-	bufferCanvas->DrawImage(reptileLogic->GetSprite() , reptileLogic->GetLeftOffset(),
-		imageHeight - reptileLogic->GetHeight() - reptileLogic->GetBottomOffset(),
-		reptileLogic->GetWidth(), reptileLogic->GetHeight());
+/*
+Name:	DrawLatestTick()
+Params: void
+Return: void
+Description:
+	This method draws the most recently published tick into the image buffer exactly, without interpolation
+	and without presenting it. It is used when the game runs without a window.
+*/
+void UFRGame::DrawLatestTick()
+{
+	bool loaded = spritesReady;
+	UFRAllocationScope allocationScope(loaded ? &frameAllocations : NULL,
+		loaded && steadyAllocationsForbidden && frameAllocations.GetCount() >= ALLOCATION_WARM_UP_FRAMES);
+	UFRTraceZone drawZone("DrawLatestTick");
+
+	snapshots.Update();
+	Compose(1);
+}
+
 
-	// Clear transformations
-	bufferCanvas->ResetTransform();
 
-	// Draw crates
-	for (int crate = 0; crate < crates.size(); crate++)
+/*
+Name:	Compose()
+Params: 
+	float alpha - How far between the previous and current tick of the snapshot to draw the bodies, from 0 to 1.
+Return: void
+Description:
+	This method draws the snapshot last picked up by the renderer into the image buffer.
+	The slingshot is drawn where the mouse was as of the current tick.
+*/
+void UFRGame::Compose(float alpha)
+{
+	const UFRGameSnapshot& state = snapshots.GetReadBuffer();
+
+	// Copy Backdrop to buffer, replacing the last frame
+	bufferCanvas->SetCompositingMode(CompositingModeSourceCopy);
+	bufferCanvas->DrawImage(backdrop, 0, 0, imageWidth, imageHeight);
+	bufferCanvas->SetCompositingMode(CompositingModeSourceOver);
+
+	// Only the backdrop is shown while the sprites are loading
+	if (!spritesReady)
+	{
+		return;
+	}
+
+	// Draw every sprite between its previous and current tick
+	for (int entity = 0; entity < state.sprites.size(); entity++)
 	{
-		bufferCanvas->DrawImage(crates[crate]->GetSprite(), crates[crate]->GetLeftOffset(),
-			imageHeight - crates[crate]->GetHeight() - crates[crate]->GetBottomOffset(),
-			crates[crate]->GetWidth(), crates[crate]->GetHeight());
+		const UFRSpriteSnapshot& sprite = state.sprites[entity];
+		float left = Interpolate(sprite.previous.leftOffset, sprite.current.leftOffset, alpha);
+		float top = imageHeight - sprite.height - Interpolate(sprite.previous.bottomOffset, sprite.current.bottomOffset, alpha);
+		float rotation = InterpolateRotation(sprite.previous.rotation, sprite.current.rotation, alpha);
+
+		if (!sprite.mirrored && rotation == 0)
+		{
+			atlas->Draw(bufferCanvas, sprite.sprite, left, top, (REAL)sprite.width, (REAL)sprite.height);
+			continue;
+		}
+
+		// Set up tranformations for the sprite:
+		// center, mirror if it faces left, rotate, and return to original offset
+		bufferCanvas->TranslateTransform(-(left + sprite.width / 2), -(top + sprite.height / 2));
+		if (sprite.mirrored)
+		{
+			bufferCanvas->ScaleTransform(-1, 1, MatrixOrderAppend);
+		}
+		bufferCanvas->RotateTransform(rotation, MatrixOrderAppend);
+		bufferCanvas->TranslateTransform((left + sprite.width / 2), (top + sprite.height / 2), MatrixOrderAppend);
+
+		// Draw the sprite with transformations, then clear them
+		atlas->Draw(bufferCanvas, sprite.sprite, left, top, (REAL)sprite.width, (REAL)sprite.height);
+		bufferCanvas->ResetTransform();
 	}
 
+	// The slingshot is stored at its scaled size
+	int scaleSlngWidth = atlas->GetWidth(slingshot1);
+
 	// Draw slingshot to buffer at mouse postition 
 	// (the center of the slingshot firing area is adjusted to the mouse position)
-	bufferCanvas->DrawImage(slingshot1, scaledMouseX - (scaleSlngWidth / 2), 
-		scaledMouseY - 15, scaleSlngWidth, scaleSlngHeight);
-	bufferCanvas->DrawImage(slingshot2, scaledMouseX - (scaleSlngWidth / 2), 
-		scaledMouseY - 15, scaleSlngWidth, scaleSlngHeight);
-
-	// Draw buffer to canvas
-	canvas->DrawImage(buffer, 0, 0, windowWidth, windowHeight);
+	atlas->Draw(bufferCanvas, slingshot1, state.slingshotX - (scaleSlngWidth / 2), state.slingshotY - 15);
+	atlas->Draw(bufferCanvas, slingshot2, state.slingshotX - (scaleSlngWidth / 2), state.slingshotY - 15);
 }
 
 
 /*
 Name:	CalcGameState()
-Params: void
+Params: long long tickTime - The input clock time at the end of the tick. Input up to then is applied first.
 Return: void
 Description:
 	This method calculates a new game state every time it is called.
+	It runs on the simulation thread and publishes a snapshot of the new state for the render thread.
+	Only the simulation thread changes the game state, so nothing here needs a lock.
+	Working space that only lasts for the tick comes from the tick arena, and the allocations of every tick are counted.
 */
-void UFRGame::CalcGameState()
+void UFRGame::CalcGameState(long long tickTime)
 {
 	int newHorizontalVelocity = DEFAULT_HORIZONTAL_VELOCITY;
+	int islandCount;
 
-	// Calculate new location of the crates.
-	for (int crate = 0; crate < crates.size(); crate++)
+	if (!spritesReady)
 	{
-		crates[crate]->Tick();
+		return;
 	}
 
-	// Calculate collision of reptile with crates
-	for (int crate = 0; crate < crates.size(); crate++)
+	// The jobs and working space of the last tick are all released
+	tickArena.Reset();
+	UFRAllocationScope allocationScope(&tickAllocations,
+		steadyAllocationsForbidden && tickAllocations.GetCount() >= ALLOCATION_WARM_UP_TICKS);
+	UFRTraceZone tickZone("Tick");
+	UFRTraceZone phaseZone("SavePreviousState");
+	SavePreviousState();
+	phaseZone.Next("ApplyInputs");
+	ApplyInputs(tickTime);
+
+	// Calculate new location of the crates.
+	// Bodies that fly move after the collisions, with the velocity the collisions left them.
+	phaseZone.Next("MoveCrates");
+	UFRPhysics::Move(&world, 0, COMPONENT_FLIGHT_AI);
+
+	// Calculate collision of the bodies with each other, only for the bodies the broadphase finds close together.
+	// Pairs pushed into contact by another collision this tick are caught on the next one.
+	// Islands share no body, so they are resolved in parallel when there are enough pairs to be worth it.
+	phaseZone.Next("Collisions");
+	BuildBroadphase();
+	broadphase.FindPairs(bodyPairs);
+	islandCount = UFRPhysics::FindIslands(bodyPairs, broadphase.GetBodyCount(), islandPairs, islandStarts, &tickArena);
+	if (bodyPairs.size() >= PARALLEL_COLLISION_PAIRS)
 	{
-		reptileLogic->DetectCollision(crates[crate]);
+		jobSystem->ParallelFor(islandCount, [this](int island) { ResolveIsland(island); }, &tickArena);
 	}
-
-	// Calculate collision on all crate pairs crates
-	for (int crate = 0; crate < crates.size(); crate++)
+	else
 	{
-		for (int otherCrate = crate + 1; otherCrate < crates.size(); otherCrate++)
+		for (int island = 0; island < islandCount; island++)
 		{
-			crates[crate]->DetectCollision(crates[otherCrate]);
+			ResolveIsland(island);
 		}
 	}
 
-	// Calculate new reptile location.
-	reptileLogic->Tick();
+	// Calculate new reptile location and let it fly.
+	// A knocked down reptile spins by the velocity it has after the collisions, before friction slows it.
+	phaseZone.Next("MoveReptile");
+	UFRReptiles::Spin(&world);
+	UFRPhysics::Move(&world, COMPONENT_FLIGHT_AI, 0);
+	UFRReptiles::Fly(&world);
+
+	// If the reptile is out of bounds of the screen, move it to the other side
+	phaseZone.Next("Rules");
+	UFRTransform& reptileTransform = world.GetTransform(reptile);
+	int reptileWidth = world.GetBody(reptile).width;
+	if (reptileTransform.left > imageWidth)
+	{
+		reptileTransform.left = -reptileWidth;
+		reptileTransform.teleported = true;
+	}
+	else if (reptileTransform.left < -reptileWidth)
+	{
+		reptileTransform.left = imageWidth;
+		reptileTransform.teleported = true;
+	}
 
 	// Play a thud sound when the reptile first hits the ground
-	if (deadTicks == 0 && reptileLogic->GetVerticaltalVel() == 0 && reptileLogic->GetBottomOffset() == 0 && !floorHit)
+	if (deadTicks == 0 && world.GetVelocity(reptile).y == 0 && reptileTransform.bottom == 0 && !floorHit)
 	{
-		fmodSystem->playSound(FMOD_CHANNEL_FREE, thudSound, false, 0);
+		tickSounds->Play(thudSound, SOUND_VOLUME);
 		floorHit = true;
 	}
 
@@ -306,24 +736,308 @@ void UFRGame::CalcGameState()
 			newHorizontalVelocity = -newHorizontalVelocity;
 		}
 
-		reptileLogic->SetOffsetAndVelocity(0 - reptileLogic->GetWidth(), INIT_GROUND_OFFSET, newHorizontalVelocity, DEFAULT_VERTICAL_VELOCITY);
-		reptileLogic->SetReptileState(REPTILE_STATE_FLYING);
+		UFRReptiles::Revive(&world, reptile, 0 - reptileWidth, INIT_GROUND_OFFSET, newHorizontalVelocity, DEFAULT_VERTICAL_VELOCITY);
 
-		// Set new min/max horizontal velocity to faster then before
-		reptileLogic->SetMaxHorSpeed(reptileLogic->GetMaxHorSpeed() * HORIZONTAL_VEL_INCREASE);
-		reptileLogic->SetMinHorSpeed(reptileLogic->GetMinHorSpeed() * HORIZONTAL_VEL_INCREASE);
+		// Set new min/max horizontal velocity to faster then before and select starting velocity
+		UFRReptiles::SpeedUp(&world.GetFlightAI(reptile), HORIZONTAL_VEL_INCREASE);
+		UFRReptiles::SetRandomSpeed(&world.GetFlightAI(reptile), &world.GetVelocity(reptile));
 
-		// Select starting velocity
-		reptileLogic->SetRandHorVel();
-		
 		// Reset dead ticks and floor hit
 		deadTicks = 0;
 		floorHit = false;
+		world.GetTransform(reptile).teleported = true;
 	}
-	else if (reptileLogic->GetHorizontalVel() == 0 && reptileLogic->GetVerticaltalVel() == 0)
+	else if (world.GetVelocity(reptile).x == 0 && world.GetVelocity(reptile).y == 0)
 	{
 		deadTicks++;
 	}
+
+	// Without a sound device, mix exactly one tick of sound per tick
+	phaseZone.Next("MixSound");
+	if (!audioOutput->IsRealTime())
+	{
+		mixer->Render(MIXER_SAMPLE_RATE * GAME_LOOP_INTERVAL / MILLISECONDS_PER_SECOND);
+	}
+
+	// Clicks at the start of the next tick are tested against where the bodies ended up
+	phaseZone.Next("Publish");
+	BuildBroadphase();
+	PublishSnapshot();
+	tickIndex++;
+}
+
+
+
+/*
+Name:	BuildBroadphase()
+Params: void
+Return: void
+Description:
+	This method puts every body into the broadphase where it is now, in the order they are drawn.
+	It is built after the crates move for the collisions and again at the end of the tick for clicks.
+*/
+void UFRGame::BuildBroadphase()
+{
+	broadphase.Clear();
+	bodyEntities.clear();
+
+	for (int entity = 0; entity < world.GetEntityCount(); entity++)
+	{
+		if (world.HasComponents(entity, COMPONENT_TRANSFORM | COMPONENT_BODY))
+		{
+			UFRTransform& transform = world.GetTransform(entity);
+			UFRBody& body = world.GetBody(entity);
+			broadphase.Add(transform.left, transform.bottom, body.width, body.height);
+			bodyEntities.push_back(entity);
+		}
+	}
+}
+
+
+
+/*
+Name:	ResolveIsland()
+Params: int island - The island to resolve.
+Return: void
+Description:
+	This method resolves the collisions of the pairs in one island, in the order the broadphase found them.
+	It only changes the bodies of the island, so islands can be resolved on different threads at once.
+*/
+void UFRGame::ResolveIsland(int island)
+{
+	int first;
+	int second;
+
+	for (int pair = islandStarts[island]; pair < islandStarts[island + 1]; pair++)
+	{
+		first = bodyEntities[bodyPairs[islandPairs[pair]].first];
+		second = bodyEntities[bodyPairs[islandPairs[pair]].second];
+		if (BodiesTouch(first, second))
+		{
+			UFRPhysics::DetectCollision(&world, first, second);
+		}
+	}
+}
+
+
+
+/*
+Name:	FindBodyAt()
+Params:
+	int x - The x coordinate in the game image.
+	int y - The y coordinate in the game image, from the top.
+Return: int - The entity drawn on top at the point, or -1 if there is only backdrop there.
+Description:
+	This method asks the broadphase for the bodies whose boxes are under the point, from the top down,
+	and takes the first one with a solid pixel there, so clicks go through the transparent parts of sprites.
+	A rotated body is only tested against its box, since the masks are not rotated.
+*/
+int UFRGame::FindBodyAt(int x, int y)
+{
+	int body = broadphase.HitTest(x, imageHeight - y, broadphase.GetBodyCount());
+	int entity;
+	int spriteTop;
+
+	while (body != -1)
+	{
+		entity = bodyEntities[body];
+		UFRTransform& transform = world.GetTransform(entity);
+
+		if (transform.rotation != 0 || !world.HasComponents(entity, COMPONENT_SPRITE))
+		{
+			return entity;
+		}
+
+		UFRSprite& sprite = world.GetSprite(entity);
+		spriteTop = imageHeight - (transform.bottom + world.GetBody(entity).height);
+		if (atlas->GetMask(sprite.sprite, sprite.mirrored).Test(x - transform.left, y - spriteTop))
+		{
+			return entity;
+		}
+
+		body = broadphase.HitTest(x, imageHeight - y, body);
+	}
+
+	return -1;
+}
+
+
+
+/*
+Name:	BodiesTouch()
+Params:
+	int first - The entity of a body whose box is touching the box of the other.
+	int second - The entity of the other body.
+Return: bool - Whether the bodies are close enough for the physics to test them.
+Description:
+	This method tests the collision masks of two bodies against each other, in the image rows from the top that both are drawn in,
+	when either of them collides by its pixels. Otherwise their boxes touching is enough.
+	A rotated body is only tested against its box, since the masks are not rotated.
+*/
+bool UFRGame::BodiesTouch(int first, int second)
+{
+	UFRTransform& firstTransform = world.GetTransform(first);
+	UFRTransform& secondTransform = world.GetTransform(second);
+	UFRBody& firstBody = world.GetBody(first);
+	UFRBody& secondBody = world.GetBody(second);
+
+	if ((!firstBody.pixelExact && !secondBody.pixelExact) || firstTransform.rotation != 0 || secondTransform.rotation != 0)
+	{
+		return true;
+	}
+
+	UFRSprite& firstSprite = world.GetSprite(first);
+	UFRSprite& secondSprite = world.GetSprite(second);
+	return atlas->GetMask(firstSprite.sprite, firstSprite.mirrored).Overlaps(atlas->GetMask(secondSprite.sprite, secondSprite.mirrored),
+		secondTransform.left - firstTransform.left, (firstTransform.bottom + firstBody.height) - (secondTransform.bottom + secondBody.height));
+}
+
+
+
+/*
+Name:	PublishSnapshot()
+Params: void
+Return: void
+Description:
+	This method copies the drawable state of every entity into a snapshot and hands it to the render thread.
+	Every entity in the game is a body with a sprite.
+*/
+void UFRGame::PublishSnapshot()
+{
+	UFRGameSnapshot& state = snapshots.GetWriteBuffer();
+	LARGE_INTEGER now;
+	UFRArchetype* table;
+	int entity;
+
+	QueryPerformanceCounter(&now);
+	state.tickTime = now.QuadPart;
+	state.inputTime = pendingInputTime;
+	pendingInputTime = 0;
+	state.slingshotX = mouseX;
+	state.slingshotY = mouseY;
+
+	state.sprites.resize(world.GetEntityCount());
+	for (int archetype = 0; archetype < world.GetArchetypeCount(); archetype++)
+	{
+		table = world.GetArchetype(archetype);
+		if (!table->Matches(COMPONENT_TRANSFORM | COMPONENT_BODY | COMPONENT_SPRITE, 0))
+		{
+			continue;
+		}
+
+		for (int row = 0; row < table->GetSize(); row++)
+		{
+			entity = table->entities[row];
+			UFRSpriteSnapshot& sprite = state.sprites[entity];
+			sprite.current.leftOffset = table->transforms[row].left;
+			sprite.current.bottomOffset = table->transforms[row].bottom;
+			sprite.current.rotation = table->transforms[row].rotation;
+			sprite.previous = table->transforms[row].teleported || entity >= previousBodies.size() ? sprite.current : previousBodies[entity];
+			sprite.width = table->bodies[row].width;
+			sprite.height = table->bodies[row].height;
+			sprite.sprite = table->sprites[row].sprite;
+			sprite.mirrored = table->sprites[row].mirrored;
+		}
+	}
+
+	snapshots.Publish();
+}
+
+
+
+/*
+Name:	SavePreviousState()
+Params: void
+Return: void
+Description:
+	This method remembers where every body is before a tick moves them, so the snapshot of the tick holds
+	both ends of the movement.
+*/
+void UFRGame::SavePreviousState()
+{
+	UFRArchetype* table;
+
+	previousBodies.resize(world.GetEntityCount());
+	for (int archetype = 0; archetype < world.GetArchetypeCount(); archetype++)
+	{
+		table = world.GetArchetype(archetype);
+		if (!table->Matches(COMPONENT_TRANSFORM, 0))
+		{
+			continue;
+		}
+
+		for (int row = 0; row < table->GetSize(); row++)
+		{
+			UFRBodyState& previous = previousBodies[table->entities[row]];
+			previous.leftOffset = table->transforms[row].left;
+			previous.bottomOffset = table->transforms[row].bottom;
+			previous.rotation = table->transforms[row].rotation;
+			table->transforms[row].teleported = false;
+		}
+	}
+}
+
+
+
+/*
+Name:	Interpolate()
+Params:
+	int previous - The value at the previous tick.
+	int current - The value at the current tick.
+	float alpha - How far between the ticks to go, from 0 to 1.
+Return: float - The interpolated value.
+Description:
+	This method blends a position between two ticks.
+*/
+float UFRGame::Interpolate(int previous, int current, float alpha)
+{
+	return previous + (current - previous) * alpha;
+}
+
+
+
+/*
+Name:	InterpolateRotation()
+Params:
+	int previous - The rotation in degrees at the previous tick.
+	int current - The rotation in degrees at the current tick.
+	float alpha - How far between the ticks to go, from 0 to 1.
+Return: float - The interpolated rotation in degrees.
+Description:
+	This method blends a rotation between two ticks the short way around the circle.
+*/
+float UFRGame::InterpolateRotation(int previous, int current, float alpha)
+{
+	int delta = (current - previous) % 360;
+
+	if (delta > 180)
+	{
+		delta -= 360;
+	}
+	else if (delta < -180)
+	{
+		delta += 360;
+	}
+
+	return previous + delta * alpha;
+}
+
+
+
+/*
+Name:	MouseMove()
+Params: 
+	int windowX - The x coordinate of the mouse based on the window size.
+	int windowY - The y coordinate of the mouse based on the window size.
+	CRect* windowDimensions - The dimensions of the window.
+	long long inputTime - The input clock time the mouse moved at.
+Return: void
+Description:
+	This method queues a mouse move for the simulation. It runs on the UI thread.
+*/
+void UFRGame::MouseMove(int windowX, int windowY, CRect* windowDimensions, long long inputTime)
+{
+	SendInput(INPUT_MOUSE_MOVE, windowX, windowY, windowDimensions, inputTime);
 }
 
 
@@ -331,31 +1045,147 @@ void UFRGame::CalcGameState()
 /*
 Name:	Click()
 Params: 
-int windowX - The x coordinate of the mouse click based on the window size.
-int windowY - The y coordinate of the mouse click based on the window size.
-CRect* windowDimensions - The dimensions of the window.
+	int windowX - The x coordinate of the mouse click based on the window size.
+	int windowY - The y coordinate of the mouse click based on the window size.
+	CRect* windowDimensions - The dimensions of the window.
+	long long inputTime - The input clock time the click happened at.
+Return: void
+Description:
+	This method queues a click for the simulation. It runs on the UI thread.
+*/
+void UFRGame::Click(int windowX, int windowY, CRect* windowDimensions, long long inputTime)
+{
+	SendInput(INPUT_CLICK, windowX, windowY, windowDimensions, inputTime);
+}
+
+
+
+/*
+Name:	SendInput()
+Params: 
+	int type - INPUT_MOUSE_MOVE or INPUT_CLICK.
+	int windowX - The x coordinate of the mouse based on the window size.
+	int windowY - The y coordinate of the mouse based on the window size.
+	CRect* windowDimensions - The dimensions of the window.
+	long long inputTime - The input clock time the event happened at.
+Return: void
+Description:
+	This method converts a mouse event to the game image and puts it on the input queue.
+	The window is only known to the UI thread, so the conversion is done here rather than in the tick.
+	An event that does not fit in the queue is dropped and counted.
+*/
+void UFRGame::SendInput(int type, int windowX, int windowY, CRect* windowDimensions, long long inputTime)
+{
+	UFRInputEvent input;
+
+	input.type = type;
+	input.time = inputTime;
+	presenter->WindowToImage(windowX, windowY, windowDimensions, &input.x, &input.y);
+
+	if (!inputs.Push(input))
+	{
+		droppedInputs.fetch_add(1, std::memory_order_relaxed);
+	}
+}
+
+
+
+/*
+Name:	ReplayInput()
+Params: 
+	int type - INPUT_MOUSE_MOVE or INPUT_CLICK.
+	int x - The x coordinate of the event in the game image.
+	int y - The y coordinate of the event in the game image.
+	long long inputTime - The time to apply the event at. The tick that ends at or after it applies it.
+Return: void
+Description:
+	This method puts a recorded event on the input queue. It is already in game image coordinates, so there is no window to convert from.
+	A capture calls it on the thread that calculates the ticks, which is then the only thread using the queue.
+*/
+void UFRGame::ReplayInput(int type, int x, int y, long long inputTime)
+{
+	UFRInputEvent input;
+
+	input.type = type;
+	input.x = x;
+	input.y = y;
+	input.time = inputTime;
+
+	if (!inputs.Push(input))
+	{
+		droppedInputs.fetch_add(1, std::memory_order_relaxed);
+	}
+}
+
+
+
+/*
+Name:	ApplyInputs()
+Params: long long tickTime - The input clock time at the end of the tick.
+Return: void
+Description:
+	This method applies the queued input that happened before the end of the tick, in the order it happened.
+	When several ticks are calculated at once to catch up, each one only takes its own input,
+	so the first event of a later tick is held on to until that tick.
+	Each event is saved to the input recording as it is applied, with the index of the tick, so a capture can replay it.
+*/
+void UFRGame::ApplyInputs(long long tickTime)
+{
+	while (hasHeldInput || inputs.Pop(&heldInput))
+	{
+		hasHeldInput = true;
+		if (heldInput.time > tickTime)
+		{
+			return;
+		}
+		hasHeldInput = false;
+
+		mouseX = heldInput.x;
+		mouseY = heldInput.y;
+		if (inputRecording != NULL)
+		{
+			inputRecording->Record(tickIndex, heldInput.type, heldInput.x, heldInput.y);
+		}
+		if (heldInput.type == INPUT_CLICK)
+		{
+			ApplyClick(heldInput.x, heldInput.y, heldInput.time);
+		}
+	}
+}
+
+
+
+/*
+Name:	ApplyClick()
+Params: 
+	int x - The x coordinate of the click in the game image.
+	int y - The y coordinate of the click in the game image.
+	long long inputTime - The input clock time the click happened at.
 Return: void
 Description:
 	This method executes game logic that heppens at the click of the mouse.
-	Sounds play and the reptile is checked for clicks.
+	Sounds play and the body whose pixels are on top at the click is found.
+	The time of the click goes with its sounds to the mixer and with this tick to the renderer,
+	so how long it takes to be heard and seen can be measured.
 */
-void UFRGame::Click(int windowX, int windowY, CRect* windowDimensions)
+void UFRGame::ApplyClick(int x, int y, long long inputTime)
 {
-	// Calculate the mouse click in relation to the image resolution
-	int x = windowX * (imageWidth / (float) windowDimensions->Width());
-	int y = windowY * (imageHeight / (float) windowDimensions->Height());
+	int body;
 
-	fmodSystem->playSound(FMOD_CHANNEL_FREE, shootSound, false, 0);
+	tickSounds->Play(shootSound, SOUND_VOLUME, inputTime);
 
-	// If reptile is clicked, change to falling state
-	if (x > reptileLogic->GetLeftOffset() && x < reptileLogic->GetLeftOffset() + reptileLogic->GetWidth() &&
-		y > imageHeight - (reptileLogic->GetBottomOffset() + reptileLogic->GetHeight()) && y < imageHeight - reptileLogic->GetBottomOffset())
+	// Clicks within one tick show in the same frame, so the oldest of them is measured
+	if (pendingInputTime == 0)
 	{
-		reptileLogic->SetReptileState(REPTILE_STATE_FALLING);
-		fmodSystem->playSound(FMOD_CHANNEL_FREE, punchSound, false, 0);
-		fmodSystem->playSound(FMOD_CHANNEL_FREE, fallSound, false, 0);
+		pendingInputTime = inputTime;
 	}
 
-	// FMOD maintanence
-	fmodSystem->update();
+	// If a reptile is clicked, and no crate is drawn over it there, knock it down
+	body = FindBodyAt(x, y);
+	if (body != -1 && world.HasComponents(body, COMPONENT_FLIGHT_AI))
+	{
+		UFRReptiles::KnockDown(&world, body);
+		tickSounds->Play(punchSound, SOUND_VOLUME, inputTime);
+		tickSounds->Play(fallSound, SOUND_VOLUME, inputTime);
+	}
 }
\ No newline at end of file
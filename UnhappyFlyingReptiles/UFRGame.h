@@ -9,13 +9,54 @@ Description:
 #pragma once
 #include "afxwin.h"
 #include <gdiplus.h>
-#include "UFReptileLogic.h"
 #include <vector>
-#include "Crate.h"
-#include "FMOD\inc\fmod.hpp"
+#include <string>
+#include <atomic>
+#include "UFRWorld.h"
+#include "UFRPhysics.h"
+#include "UFRReptiles.h"
+#include "UFRCrates.h"
+#include "UFRPresenter.h"
+#include "UFRGameSnapshot.h"
+#include "UFRTripleBuffer.h"
+#include "UFRSpriteAtlas.h"
+#include "UFRJobSystem.h"
+#include "UFRAssetLoader.h"
+#include "UFRAssetPack.h"
+#include "UFRMixer.h"
+#include "UFRAudioOutput.h"
+#include "UFRClock.h"
+#include "UFRLatencyStats.h"
+#include "UFRBroadphase.h"
+#include "UFRSpscQueue.h"
+#include "UFRTrace.h"
+#include "UFRAllocations.h"
+#include "UFRFrameArena.h"
+#include "UFRInputRecording.h"
 
 using namespace Gdiplus;
 
+#define GAME_LOOP_INTERVAL 50 // The length of a game tick in milliseconds
+
+#define LEVEL_FILE TEXT(".\\Level.ufrl") // The binary level played unless another is chosen
+#define LEVEL_SOURCE_FILE TEXT(".\\Level.txt") // The text the default level is converted from
+
+#define INPUT_QUEUE_CAPACITY 256 // Events the UI thread can send between two ticks
+
+
+/*
+Name: UFRInputEvent
+Description:
+	A mouse event from the UI thread, already in game image coordinates, and when it happened.
+*/
+struct UFRInputEvent
+{
+	int type;
+	int x;
+	int y;
+	long long time; // In input clock microseconds
+};
+
 
 /*
 Name: UFRGame
@@ -26,45 +67,120 @@ Description:
 class UFRGame
 {
 private:
-	Bitmap* background;
-	Bitmap* midground;
-	Bitmap* foreground;
+	Bitmap* backdrop; // The background, midground and foreground composited together
 
 	int imageWidth;
 	int imageHeight;
 
-	Bitmap* slingshot1;
-	Bitmap* slingshot2;
+	UFRSpriteAtlas* atlas; // Every sprite, already scaled, in one image
+	UFRJobSystem* jobSystem; // Runs the parallel work of the game: decoding, scaling and collisions
+	UFRAssetLoader* assetLoader; // Decodes images in the background until loading is finished
+	UFRAssetPack* assetPack; // The cooked assets, or NULL when they are loaded from their source files
+	std::vector<UFRImageFuture> spriteLoads;
+	std::atomic<bool> spritesReady; // Set once the game objects exist and the atlas is packed
+	unsigned int gameSeed;
+	std::wstring levelPath;
+	int slingshot1;
+	int slingshot2;
 
 	Bitmap* buffer;
 	Graphics* bufferCanvas;
-
-	FMOD::System *fmodSystem;
-	FMOD::Sound *shootSound;
-	FMOD::Sound *punchSound;
-	FMOD::Sound *fallSound;
-	FMOD::Sound *thudSound;
-
-	UFReptileLogic* reptileLogic;
+	UFRPresenter* presenter;
+
+	UFRAudioOutput* audioOutput;
+	UFRMixer* mixer;
+	UFRSoundQueue* tickSounds; // Sounds triggered by the simulation
+	int shootSound;
+	int punchSound;
+	int fallSound;
+	int thudSound;
+
+	UFRWorld world; // The reptile and the crates, drawn in the order they were created
+	int reptile; // The entity of the reptile, or -1 until the sprites are loaded
 	int deadTicks; // To keep track of how long the reptile has been dead
 	bool floorHit; // To keep track of when the reptile first hits the ground
 
-	std::vector<Crate*> crates;
-
-	void MakeTransparent(Bitmap* bmp, Color color);
+	UFRFrameArena tickArena; // Working space and jobs that only last for one tick
+	UFRAllocationStats tickAllocations;
+	UFRAllocationStats frameAllocations; // Only frames drawn once loading is finished
+	bool steadyAllocationsForbidden; // Whether ticks and frames may not allocate once warmed up
+	void ReportAllocations();
+
+	UFRBroadphase broadphase; // Every body as it was when the broadphase was last built
+	std::vector<int> bodyEntities; // The entity of each body in the broadphase
+	std::vector<UFRBodyPair> bodyPairs;
+	std::vector<int> islandPairs; // The pairs grouped into islands that share no body
+	std::vector<int> islandStarts;
+	void BuildBroadphase();
+	void ResolveIsland(int island);
+	int FindBodyAt(int x, int y);
+	bool BodiesTouch(int first, int second);
+
+	UFRClock* inputClock; // The clock clicks are timed with, or NULL when latency is not measured
+	long long pendingInputTime; // The oldest click since the last tick was published, or 0
+	long long lastDrawnInput; // The last click whose frame was measured, only used by the render thread
+	UFRLatencyStats photonLatency;
+
+	void ComposeBackdrop(std::vector<UFRImageFuture>& layers);
+	int LoadSound(const char* file, int priority);
+	static void ReportMemory(const TCHAR* stage);
+	static void ReportLatency(const TCHAR* name, UFRLatencyStats* stats);
+	void ReportJobs();
 
 	bool reptileFliesLeft; // To keep track of the direction of flight of the reptile
 
+	// Input from the UI thread, applied by the simulation at the start of the tick it happened in
+	UFRSpscQueue<UFRInputEvent, INPUT_QUEUE_CAPACITY> inputs;
+	std::atomic<unsigned int> droppedInputs;
+	UFRInputEvent heldInput; // Taken off the queue but belonging to a later tick
+	bool hasHeldInput;
+	int mouseX; // Where the mouse was as of the current tick, in the game image
+	int mouseY;
+	int tickIndex; // Ticks calculated since loading finished, which recorded input is timed by
+	UFRInputRecording* inputRecording; // Where applied input is saved, or NULL
+	void SendInput(int type, int windowX, int windowY, CRect* windowDimensions, long long inputTime);
+	void ApplyInputs(long long tickTime);
+	void ApplyClick(int x, int y, long long inputTime);
+
+	UFRTripleBuffer<UFRGameSnapshot> snapshots; // Drawable states passed to the render thread
+	void PublishSnapshot();
+
+	// Body states at the start of the tick by entity, for the renderer to interpolate from
+	std::vector<UFRBodyState> previousBodies;
+	void SavePreviousState();
+
+	LARGE_INTEGER counterFrequency;
+	static float Interpolate(int previous, int current, float alpha);
+	static float InterpolateRotation(int previous, int current, float alpha);
+
+	void Compose(float alpha);
+
 public:
-	UFRGame();
+	UFRGame(unsigned int seed, UFRAudioOutput* output, UFRClock* clock);
 	~UFRGame();
 
-	int mouseX;
-	int mouseY;
-
 	void Draw(Graphics* canvas, CRect* dimensions);
-	void CalcGameState();
-
-	void Click(int windowX, int windowY, CRect* windowDimensions);
+	void DrawLatestTick();
+	void SetLevel(const wchar_t* path) { levelPath = path; }
+	void ForbidSteadyAllocations() { steadyAllocationsForbidden = true; }
+	void FinishLoading();
+	bool IsLoaded() { return spritesReady; }
+	Bitmap* GetImage() { return buffer; }
+	int GetImageWidth() { return imageWidth; }
+	int GetImageHeight() { return imageHeight; }
+	UFRSpriteAtlas* GetAtlas() { return atlas; }
+	Bitmap* GetBackdrop() { return backdrop; }
+	static void ListSoundFiles(std::vector<std::string>& files);
+	static void MakeTransparent(Bitmap* bmp, Color color);
+	void CalcGameState(long long tickTime);
+
+	// UI thread
+	void MouseMove(int windowX, int windowY, CRect* windowDimensions, long long inputTime);
+	void Click(int windowX, int windowY, CRect* windowDimensions, long long inputTime);
+
+	void RecordInput(UFRInputRecording* recording) { inputRecording = recording; }
+	unsigned int GetSeed() { return gameSeed; }
+	int GetTickIndex() { return tickIndex; }
+	void ReplayInput(int type, int x, int y, long long inputTime);
 };
 
@@ -0,0 +1,67 @@
+/*
+File:		UFRGameSnapshot.h
+Project:	Unhappy Flying Reptiles
+Author(s):	Jorge Ramirez
+Description:
+	This file contains the definitions of the game state snapshots that are passed from the
+	simulation thread to the render thread.
+*/
+
+#pragma once
+#include "afxwin.h"
+#include <gdiplus.h>
+#include <vector>
+
+using namespace Gdiplus;
+
+
+/*
+Name: UFRBodyState
+Description:
+	The position and rotation of a body at the end of a game tick.
+*/
+struct UFRBodyState
+{
+	int leftOffset;
+	int bottomOffset;
+	int rotation;
+};
+
+
+/*
+Name: UFRSpriteSnapshot
+Description:
+	The drawable state of one entity at the end of the previous and the current game tick.
+*/
+struct UFRSpriteSnapshot
+{
+	UFRBodyState previous;
+	UFRBodyState current;
+	int width;
+	int height;
+	int sprite; // The number of the sprite in the atlas
+	bool mirrored; // Drawn flipped left to right
+};
+
+
+/*
+Name: UFRGameSnapshot
+Description:
+	The drawable state of the whole game at the end of the previous and the current game tick.
+	The renderer interpolates between the two by how far it is into the next tick.
+	Sprites are referred to by their number in the sprite atlas, which is never modified after loading,
+	so the render thread can draw them while the simulation thread keeps ticking.
+	Every buffer starts zeroed, so a frame drawn before the first tick is published reads no garbage.
+*/
+struct UFRGameSnapshot
+{
+	LONGLONG tickTime; // The performance counter value when the current tick was published
+	long long inputTime; // The input clock time of the oldest click that first shows in this tick, or 0
+
+	std::vector<UFRSpriteSnapshot> sprites; // By entity, which is the order they are drawn in
+
+	int slingshotX; // The mouse position in the game image as of the current tick
+	int slingshotY;
+
+	UFRGameSnapshot() : tickTime(0), inputTime(0), slingshotX(0), slingshotY(0) {}
+};
\ No newline at end of file
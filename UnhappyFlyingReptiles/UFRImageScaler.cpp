@@ -0,0 +1,220 @@
+/*
+File:		UFRImageScaler.cpp
+Project:	Unhappy Flying Reptiles
+Author(s):	Jorge Ramirez
+Description:
+	This file contains the method definitions for the UFRImageScaler class.
+*/
+
+#include "UFRImageScaler.h"
+#include <string.h>
+
+#define BYTES_PER_PIXEL 4
+#define INTEGER_TILE_ROWS 8 // Image rows per tile at an integer scale
+#define STRETCH_TILE_ROWS 32 // Scaled rows per tile when stretching
+#define SCALE_ARENA_SIZE 16384 // Room for the jobs of one scale
+
+
+/*
+Name:	UFRImageScaler()
+Params:
+	int width - The width of the images that will be scaled.
+	int height - The height of the images that will be scaled.
+	UFRJobSystem* jobs - The job system that scales the tiles, or NULL to scale them on the calling thread. It is not owned by the scaler.
+Description:
+	Constructor for the UFRImageScaler class. Nothing is scaled until SetSize is called.
+*/
+UFRImageScaler::UFRImageScaler(int width, int height, UFRJobSystem* jobs) : frameArena(SCALE_ARENA_SIZE)
+{
+	imageWidth = width;
+	imageHeight = height;
+	scaledWidth = 0;
+	scaledHeight = 0;
+	integerScale = 1;
+
+	jobSystem = jobs;
+	scaleSource = NULL;
+	scaleStride = 0;
+}
+
+
+
+/*
+Name:	SetSize()
+Params:
+	int width - The width of the scaled image.
+	int height - The height of the scaled image.
+	int scale - The integer scale, with the width and height the image size times it, or 1 to stretch the image to them.
+Return: void
+Description:
+	This method sets the size the image is scaled to and rebuilds the lookup tables.
+	Nothing is done if the size has not changed since the last call.
+*/
+void UFRImageScaler::SetSize(int width, int height, int scale)
+{
+	if (width == scaledWidth && height == scaledHeight && scale == integerScale)
+	{
+		return;
+	}
+
+	scaledWidth = width;
+	scaledHeight = height;
+	integerScale = scale;
+
+	// Rebuild the nearest neighbour lookup tables
+	columnLookup.resize(scaledWidth);
+	for (int column = 0; column < scaledWidth; column++)
+	{
+		columnLookup[column] = (int)(((long long)column * imageWidth) / scaledWidth);
+	}
+	rowLookup.resize(scaledHeight);
+	for (int row = 0; row < scaledHeight; row++)
+	{
+		rowLookup[row] = (int)(((long long)row * imageHeight) / scaledHeight);
+	}
+
+	scaledPixels.resize((size_t)scaledWidth * scaledHeight);
+}
+
+
+
+/*
+Name:	ScaleIntegerRows()
+Params:
+	int firstRow - The first image row to scale.
+	int endRow - The image row after the last one to scale.
+Return: void
+Description:
+	This method scales a band of image rows by the integer scale into the scaled pixels.
+	Every pixel is repeated across the row and the finished row is then copied down.
+*/
+void UFRImageScaler::ScaleIntegerRows(int firstRow, int endRow)
+{
+	unsigned int* destRow = &scaledPixels[(size_t)firstRow * integerScale * scaledWidth];
+
+	for (int row = firstRow; row < endRow; row++)
+	{
+		const unsigned int* sourceRow = (const unsigned int*)((const unsigned char*)scaleSource + (size_t)row * scaleStride);
+		unsigned int* dest = destRow;
+
+		for (int column = 0; column < imageWidth; column++)
+		{
+			unsigned int pixel = sourceRow[column];
+			for (int repeat = 0; repeat < integerScale; repeat++)
+			{
+				*dest++ = pixel;
+			}
+		}
+
+		// Copy the scaled row to the rows bellow it
+		for (int repeat = 1; repeat < integerScale; repeat++)
+		{
+			memcpy(destRow + repeat * scaledWidth, destRow, scaledWidth * BYTES_PER_PIXEL);
+		}
+
+		destRow += integerScale * scaledWidth;
+	}
+}
+
+
+
+/*
+Name:	ScaleStretchRows()
+Params:
+	int firstRow - The first scaled row to fill.
+	int endRow - The scaled row after the last one to fill.
+Return: void
+Description:
+	This method fills a band of the scaled pixels from the image using the cached lookup tables.
+	Rows that sample the same image row as the row above them in the band are copied instead of rescaled.
+*/
+void UFRImageScaler::ScaleStretchRows(int firstRow, int endRow)
+{
+	int lastSourceRow = -1;
+
+	for (int row = firstRow; row < endRow; row++)
+	{
+		unsigned int* destRow = &scaledPixels[(size_t)row * scaledWidth];
+
+		if (rowLookup[row] == lastSourceRow)
+		{
+			memcpy(destRow, destRow - scaledWidth, scaledWidth * BYTES_PER_PIXEL);
+			continue;
+		}
+
+		const unsigned int* sourceRow = (const unsigned int*)((const unsigned char*)scaleSource + (size_t)rowLookup[row] * scaleStride);
+		for (int column = 0; column < scaledWidth; column++)
+		{
+			destRow[column] = sourceRow[columnLookup[column]];
+		}
+		lastSourceRow = rowLookup[row];
+	}
+}
+
+
+
+/*
+Name:	Scale()
+Params:
+	const unsigned int* pixels - The first pixel of the image.
+	int stride - The number of bytes between the rows of the image.
+Return: void
+Description:
+	This method scales the image into the scaled pixels at the size last set.
+	The rows are split into tiles that are scaled in parallel on the job system. Every tile writes
+	its own rows only, so the result is the same no matter how the tiles are spread over the workers.
+*/
+void UFRImageScaler::Scale(const unsigned int* pixels, int stride)
+{
+	int tileRows = integerScale > 1 ? INTEGER_TILE_ROWS : STRETCH_TILE_ROWS;
+	int rowCount = integerScale > 1 ? imageHeight : scaledHeight;
+	int tileCount = (rowCount + tileRows - 1) / tileRows;
+
+	if (scaledPixels.empty())
+	{
+		return;
+	}
+
+	// The jobs of the last scale have all finished
+	frameArena.Reset();
+	scaleSource = pixels;
+	scaleStride = stride;
+
+	if (jobSystem == NULL)
+	{
+		for (int tile = 0; tile < tileCount; tile++)
+		{
+			ScaleTile(tile);
+		}
+		return;
+	}
+
+	// The tiles only capture the scaler, so the body fits in the job without allocating
+	jobSystem->ParallelFor(tileCount, [this](int tile) { ScaleTile(tile); }, &frameArena);
+}
+
+
+
+/*
+Name:	ScaleTile()
+Params: int tile - The tile of rows to scale.
+Return: void
+Description:
+	This method scales one tile of the image with the scaler for an integer scale or a stretch.
+*/
+void UFRImageScaler::ScaleTile(int tile)
+{
+	int tileRows = integerScale > 1 ? INTEGER_TILE_ROWS : STRETCH_TILE_ROWS;
+	int rowCount = integerScale > 1 ? imageHeight : scaledHeight;
+	int firstRow = tile * tileRows;
+	int endRow = firstRow + tileRows < rowCount ? firstRow + tileRows : rowCount;
+
+	if (integerScale > 1)
+	{
+		ScaleIntegerRows(firstRow, endRow);
+	}
+	else
+	{
+		ScaleStretchRows(firstRow, endRow);
+	}
+}
@@ -0,0 +1,59 @@
+/*
+File:		UFRImageScaler.h
+Project:	Unhappy Flying Reptiles
+Author(s):	Jorge Ramirez
+Description:
+	This file contains the class definition for the UFRImageScaler class.
+*/
+
+#pragma once
+#include <vector>
+#include "UFRJobSystem.h"
+#include "UFRFrameArena.h"
+
+
+/*
+Name: UFRImageScaler
+Description:
+	This class is designed to scale a 32 bit image up to another size with nearest neighbour sampling, for the presenter.
+	An integer scale repeats every pixel, and any other size is sampled through lookup tables
+	that are only rebuilt when the size changes.
+	Scaling is split into tiles of rows that run in parallel on the job system, with the jobs made in a frame arena
+	so scaling does not allocate once the size is set. Without a job system the tiles are scaled one after another.
+	Nothing here depends on MFC.
+*/
+class UFRImageScaler
+{
+private:
+	int imageWidth;
+	int imageHeight;
+	int scaledWidth;
+	int scaledHeight;
+	int integerScale; // 1 when the image is stretched through the lookup tables
+
+	std::vector<int> columnLookup; // The image column for every scaled column
+	std::vector<int> rowLookup; // The image row for every scaled row
+	std::vector<unsigned int> scaledPixels;
+
+	UFRJobSystem* jobSystem;
+	UFRFrameArena frameArena; // The jobs of the current scale
+	const unsigned int* scaleSource; // The image being scaled, and the number of bytes between its rows
+	int scaleStride;
+	void ScaleTile(int tile);
+	void ScaleIntegerRows(int firstRow, int endRow);
+	void ScaleStretchRows(int firstRow, int endRow);
+
+	UFRImageScaler(const UFRImageScaler&);
+	UFRImageScaler& operator=(const UFRImageScaler&);
+
+public:
+	UFRImageScaler(int width, int height, UFRJobSystem* jobs);
+
+	void SetSize(int width, int height, int scale);
+	void Scale(const unsigned int* pixels, int stride);
+
+	const unsigned int* GetPixels() { return scaledPixels.empty() ? NULL : &scaledPixels[0]; }
+	int GetScaledWidth() { return scaledWidth; }
+	int GetScaledHeight() { return scaledHeight; }
+	UFRFrameArena* GetArena() { return &frameArena; }
+};
@@ -0,0 +1,191 @@
+/*
+File:		UFRInputRecording.cpp
+Project:	Unhappy Flying Reptiles
+Author(s):	Jorge Ramirez
+Description:
+	This file contains the method definitions for the UFRInputRecording class.
+*/
+
+#include "UFRInputRecording.h"
+#include "UFRWaveFile.h"
+#include <string.h>
+
+#define RECORDING_LINE_LENGTH 256
+#define RECORDING_COMMENT '#'
+#define RECORDING_BLANKS " \t\r\n"
+
+
+/*
+Name:	UFRInputRecording()
+Params: void
+Description:
+	Constructor for the UFRInputRecording class. Nothing is recorded until Create is called.
+*/
+UFRInputRecording::UFRInputRecording()
+{
+	file = NULL;
+	seed = 0;
+	errorLine = 0;
+}
+
+
+
+/*
+Name:	~UFRInputRecording()
+Params: void
+Description:
+	Destructor for the UFRInputRecording class. A recording still open is closed.
+*/
+UFRInputRecording::~UFRInputRecording()
+{
+	Close();
+}
+
+
+
+/*
+Name:	Create()
+Params:
+	const wchar_t* path - The file to record to. It is replaced.
+	unsigned int gameSeed - The seed the recorded game was started with.
+Return: bool - Whether the file was created.
+Description:
+	This method starts a recording. Events are added with Record until Close is called.
+*/
+bool UFRInputRecording::Create(const wchar_t* path, unsigned int gameSeed)
+{
+	Close();
+
+	file = UFRWaveFile::OpenFile(path, L"w");
+	if (file == NULL)
+	{
+		return false;
+	}
+
+	seed = gameSeed;
+	fprintf(file, "# Unhappy Flying Reptiles input, as \"tick type x y\"\nseed %u\n", seed);
+
+	return true;
+}
+
+
+
+/*
+Name:	Record()
+Params:
+	int tick - The tick the event was applied in.
+	int type - INPUT_MOUSE_MOVE or INPUT_CLICK.
+	int x - The x coordinate of the event in the game image.
+	int y - The y coordinate of the event in the game image.
+Return: void
+Description:
+	This method writes one event to the recording, if there is one. It runs on the simulation thread.
+*/
+void UFRInputRecording::Record(int tick, int type, int x, int y)
+{
+	if (file != NULL)
+	{
+		fprintf(file, "%d %d %d %d\n", tick, type, x, y);
+	}
+}
+
+
+
+/*
+Name:	Close()
+Params: void
+Return: bool - Whether every event was written, or true when nothing was being recorded.
+Description:
+	This method ends a recording and closes its file.
+*/
+bool UFRInputRecording::Close()
+{
+	bool written;
+
+	if (file == NULL)
+	{
+		return true;
+	}
+
+	written = ferror(file) == 0;
+	written = fclose(file) == 0 && written;
+	file = NULL;
+
+	return written;
+}
+
+
+
+/*
+Name:	Load()
+Params: const wchar_t* path - The recording to read.
+Return: bool - Whether the file was a valid recording. If not, GetErrorLine says which line was not, or 0 when the seed was missing.
+Description:
+	This method reads a recording for playback. The seed must come before the first event,
+	every event must be a known type in a tick that is not before the one of the event above it,
+	and there must be nothing after the four numbers of an event but a comment.
+*/
+bool UFRInputRecording::Load(const wchar_t* path)
+{
+	FILE* recordingFile;
+	char line[RECORDING_LINE_LENGTH];
+	char* comment;
+	int lineNumber = 0;
+	bool seedRead = false;
+	bool valid;
+	UFRRecordedInput input;
+	int end;
+
+	inputs.clear();
+	errorLine = 0;
+
+	recordingFile = UFRWaveFile::OpenFile(path, L"r");
+	if (recordingFile == NULL)
+	{
+		return false;
+	}
+
+	while (fgets(line, sizeof(line), recordingFile) != NULL)
+	{
+		lineNumber++;
+		comment = strchr(line, RECORDING_COMMENT);
+		if (comment != NULL)
+		{
+			*comment = '\0';
+		}
+
+		// A blank line
+		if (line[strspn(line, RECORDING_BLANKS)] == '\0')
+		{
+			continue;
+		}
+
+		// The seed comes first, then the events
+		end = 0;
+		if (!seedRead)
+		{
+			valid = sscanf(line, " seed %u %n", &seed, &end) == 1 && line[end] == '\0';
+			seedRead = valid;
+		}
+		else
+		{
+			valid = sscanf(line, "%d %d %d %d %n", &input.tick, &input.type, &input.x, &input.y, &end) == 4 && line[end] == '\0' &&
+				input.tick >= (inputs.empty() ? 0 : inputs.back().tick) && (input.type == INPUT_MOUSE_MOVE || input.type == INPUT_CLICK);
+			if (valid)
+			{
+				inputs.push_back(input);
+			}
+		}
+
+		if (!valid)
+		{
+			fclose(recordingFile);
+			inputs.clear();
+			errorLine = lineNumber;
+			return false;
+		}
+	}
+	fclose(recordingFile);
+
+	return seedRead;
+}
@@ -0,0 +1,66 @@
+/*
+File:		UFRInputRecording.h
+Project:	Unhappy Flying Reptiles
+Author(s):	Jorge Ramirez
+Description:
+	This file contains the class definition for the UFRInputRecording class.
+*/
+
+#pragma once
+#include <stdio.h>
+#include <vector>
+
+#define INPUT_MOUSE_MOVE 0
+#define INPUT_CLICK 1
+
+
+/*
+Name: UFRRecordedInput
+Description:
+	A mouse event as the simulation applied it, in game image coordinates, and the tick it was applied in.
+	Ticks are counted from the first one calculated once the game finished loading.
+*/
+struct UFRRecordedInput
+{
+	int tick;
+	int type;
+	int x;
+	int y;
+};
+
+
+/*
+Name: UFRInputRecording
+Description:
+	This class is designed to save the input of a game as the simulation applies it, so a capture can play it back tick for tick.
+	The file is text, a "seed <number>" line with the seed the game was started with,
+	then one event per line as "tick type x y", in the order the events were applied. Anything after a # is a comment.
+	Events are written as they happen, with no allocation through new, so a tick that records stays free of allocations.
+	Nothing here depends on MFC.
+*/
+class UFRInputRecording
+{
+private:
+	FILE* file; // The file being recorded to, or NULL
+	unsigned int seed;
+	std::vector<UFRRecordedInput> inputs; // The events read by Load
+	int errorLine; // The line Load could not read, or 0
+
+	UFRInputRecording(const UFRInputRecording&);
+	UFRInputRecording& operator=(const UFRInputRecording&);
+
+public:
+	UFRInputRecording();
+	~UFRInputRecording();
+
+	bool Create(const wchar_t* path, unsigned int gameSeed);
+	void Record(int tick, int type, int x, int y);
+	bool Close();
+	bool IsRecording() { return file != NULL; }
+
+	bool Load(const wchar_t* path);
+	unsigned int GetSeed() { return seed; }
+	int GetCount() { return (int)inputs.size(); }
+	const UFRRecordedInput& GetInput(int input) { return inputs[input]; }
+	int GetErrorLine() { return errorLine; }
+};
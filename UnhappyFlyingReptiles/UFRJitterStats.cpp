@@ -0,0 +1,132 @@
+/*
+File:		UFRJitterStats.cpp
+Project:	Unhappy Flying Reptiles
+Author(s):	Jorge Ramirez
+Description:
+	This file contains the method definitions for the UFRJitterStats class.
+*/
+
+#include "UFRJitterStats.h"
+#include <math.h>
+
+#define MILLISECONDS_PER_SECOND 1000.0
+
+
+/*
+Name:	UFRJitterStats()
+Params:
+	const TCHAR* statsName - The name of the event used when reporting.
+	double interval - The interval in milliseconds that the event is meant to run at.
+Description:
+	Constructor for the UFRJitterStats class.
+*/
+UFRJitterStats::UFRJitterStats(const TCHAR* statsName, double interval)
+{
+	name = statsName;
+	targetInterval = interval;
+	QueryPerformanceFrequency(&counterFrequency);
+	Reset();
+}
+
+
+
+/*
+Name:	Reset()
+Params: void
+Return: void
+Description:
+	This method clears all the measured intervals.
+*/
+void UFRJitterStats::Reset()
+{
+	hasLastEvent = false;
+	intervalCount = 0;
+	intervalSum = 0;
+	squaredDeviationSum = 0;
+	maxDeviation = 0;
+}
+
+
+
+/*
+Name:	Record()
+Params: void
+Return: void
+Description:
+	This method marks that the event happened now and measures the interval since the last time it happened.
+*/
+void UFRJitterStats::Record()
+{
+	LARGE_INTEGER now;
+	QueryPerformanceCounter(&now);
+
+	if (hasLastEvent)
+	{
+		double interval = (now.QuadPart - lastEvent.QuadPart) * MILLISECONDS_PER_SECOND / counterFrequency.QuadPart;
+		double deviation = fabs(interval - targetInterval);
+
+		intervalCount++;
+		intervalSum += interval;
+		squaredDeviationSum += deviation * deviation;
+		if (deviation > maxDeviation)
+		{
+			maxDeviation = deviation;
+		}
+	}
+
+	lastEvent = now;
+	hasLastEvent = true;
+}
+
+
+
+/*
+Name:	GetAverageInterval()
+Params: void
+Return: double - The average measured interval in milliseconds.
+Description:
+	This method returns the average time between events.
+*/
+double UFRJitterStats::GetAverageInterval()
+{
+	if (intervalCount == 0)
+	{
+		return 0;
+	}
+
+	return intervalSum / intervalCount;
+}
+
+
+
+/*
+Name:	GetJitter()
+Params: void
+Return: double - The jitter in milliseconds.
+Description:
+	This method returns the root mean square of how far each interval was from the target interval.
+*/
+double UFRJitterStats::GetJitter()
+{
+	if (intervalCount == 0)
+	{
+		return 0;
+	}
+
+	return sqrt(squaredDeviationSum / intervalCount);
+}
+
+
+
+/*
+Name:	Report()
+Params: void
+Return: void
+Description:
+	This method writes the measured intervals and jitter to the debug output.
+*/
+void UFRJitterStats::Report()
+{
+	TRACE(TEXT("%s: %u intervals, %.2f ms average (target %.2f ms), %.2f ms jitter, %.2f ms worst\n"),
+		name, intervalCount, GetAverageInterval(), targetInterval, GetJitter(), maxDeviation);
+}
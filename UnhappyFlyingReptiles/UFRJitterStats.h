@@ -0,0 +1,46 @@
+/*
+File:		UFRJitterStats.h
+Project:	Unhappy Flying Reptiles
+Author(s):	Jorge Ramirez
+Description:
+	This file contains the class definition for the UFRJitterStats class.
+*/
+
+#pragma once
+#include "afxwin.h"
+
+
+/*
+Name: UFRJitterStats
+Description:
+	This class is designed to measure how evenly a periodic event, such as a game tick or a frame, is spaced.
+	The time between each pair of events is compared to the interval the event is meant to run at.
+*/
+class UFRJitterStats
+{
+private:
+	const TCHAR* name;
+	double targetInterval; // In milliseconds
+
+	LARGE_INTEGER counterFrequency;
+	LARGE_INTEGER lastEvent;
+	bool hasLastEvent;
+
+	unsigned int intervalCount;
+	double intervalSum;
+	double squaredDeviationSum;
+	double maxDeviation;
+
+public:
+	UFRJitterStats(const TCHAR* statsName, double interval);
+
+	void Record();
+	void Reset();
+
+	unsigned int GetIntervalCount() { return intervalCount; }
+	double GetAverageInterval();
+	double GetJitter();
+	double GetMaxDeviation() { return maxDeviation; }
+
+	void Report();
+};
@@ -0,0 +1,522 @@
+/*
+File:		UFRJobSystem.cpp
+Project:	Unhappy Flying Reptiles
+Author(s):	Jorge Ramirez
+Description:
+	This file contains the method definitions for the UFRJobSystem class.
+*/
+
+#include "UFRJobSystem.h"
+#include "UFRTrace.h"
+#include "UFRAllocations.h"
+
+#define JOBS_PER_THREAD 4 // Parallel for items are batched into this many jobs per thread, to even out the load
+#define JOB_RING_CAPACITY 256 // Jobs each deque holds before it has to grow, a power of two
+
+
+/*
+Name:	UFRJobSystem()
+Params: int threadCount - The number of threads that run jobs, counting one thread that waits for them.
+	0 uses one thread per processor. There is always at least one worker thread.
+Description:
+	Constructor for the UFRJobSystem class.
+	The worker threads are started here and wait for the first job.
+*/
+UFRJobSystem::UFRJobSystem(int threadCount) : queuedJobs(0)
+{
+	stopping = false;
+
+	if (threadCount <= 0)
+	{
+		threadCount = std::thread::hardware_concurrency();
+	}
+
+	// The thread that waits is the first worker, but futures can be waited on without helping
+	workerCount = threadCount - 1;
+	if (workerCount < 1)
+	{
+		workerCount = 1;
+	}
+	sharedSlot = workerCount;
+
+	for (int slot = 0; slot <= workerCount; slot++)
+	{
+		workers.push_back(new Worker());
+		workers[slot]->jobs.resize(JOB_RING_CAPACITY);
+		workers[slot]->firstJob = 0;
+		workers[slot]->jobCount = 0;
+		workers[slot]->jobsRun = 0;
+		workers[slot]->steals = 0;
+		workers[slot]->busyTime = 0;
+	}
+
+	for (int slot = 0; slot < workerCount; slot++)
+	{
+		workers[slot]->thread = std::thread(&UFRJobSystem::WorkerLoop, this, slot);
+	}
+	startTime = clock.Now();
+}
+
+
+
+/*
+Name:	~UFRJobSystem()
+Params: void
+Description:
+	Destructor for the UFRJobSystem class.
+	The workers finish the job they are running and stop. Jobs that have not started are dropped.
+*/
+UFRJobSystem::~UFRJobSystem()
+{
+	{
+		std::lock_guard<std::mutex> guard(sleepLock);
+		stopping = true;
+	}
+	jobReady.notify_all();
+
+	for (int slot = 0; slot < workerCount; slot++)
+	{
+		workers[slot]->thread.join();
+	}
+	for (int slot = 0; slot < workers.size(); slot++)
+	{
+		delete workers[slot];
+	}
+}
+
+
+
+/*
+Name:	Create()
+Params:
+	const std::function<void()>& work - What the job does.
+	UFRFrameArena* arena - The arena of the calling thread to make the job in, or NULL to make it on the heap.
+		The job must be released before the arena is reset.
+Return: UFRJobHandle - The job, which does not run until it is submitted.
+Description:
+	This method makes a job, so its dependencies can be added before it is submitted.
+*/
+UFRJobHandle UFRJobSystem::Create(const std::function<void()>& work, UFRFrameArena* arena)
+{
+	return std::allocate_shared<UFRJob>(UFRArenaAllocator<UFRJob>(arena), work);
+}
+
+
+
+/*
+Name:	DependsOn()
+Params:
+	const UFRJobHandle& job - A job that has not been submitted yet.
+	const UFRJobHandle& dependency - The job it has to wait for.
+Return: void
+Description:
+	This method makes a job wait for another one to finish before it runs.
+	A dependency that has already finished is ignored.
+*/
+void UFRJobSystem::DependsOn(const UFRJobHandle& job, const UFRJobHandle& dependency)
+{
+	std::lock_guard<std::mutex> guard(dependency->lock);
+
+	if (!dependency->finished)
+	{
+		if (dependency->dependents == NULL)
+		{
+			dependency->dependents = new std::vector<UFRJobHandle>();
+		}
+		job->waitingFor++;
+		dependency->dependents->push_back(job);
+	}
+}
+
+
+
+/*
+Name:	Submit()
+Params: const UFRJobHandle& job - The job to run.
+Return: void
+Description:
+	This method lets a job run as soon as its dependencies are finished.
+	A job submitted by a worker goes on its own deque, any other thread's on the shared queue.
+*/
+void UFRJobSystem::Submit(const UFRJobHandle& job)
+{
+	if (--job->waitingFor == 0)
+	{
+		Push(FindSlot(), job);
+	}
+}
+
+
+
+/*
+Name:	Wait()
+Params: const UFRJobHandle& job - A submitted job.
+Return: void
+Description:
+	This method returns once a job has run. The waiting thread runs other jobs in the meantime.
+*/
+void UFRJobSystem::Wait(const UFRJobHandle& job)
+{
+	int slot = FindSlot();
+	UFRJobHandle other;
+
+	while (!job->done)
+	{
+		if (Take(slot, &other))
+		{
+			Run(slot, other);
+			other.reset();
+		}
+		else
+		{
+			std::this_thread::yield();
+		}
+	}
+}
+
+
+
+/*
+Name:	ParallelFor()
+Params:
+	int itemCount - The number of items in the job.
+	const std::function<void(int)>& body - Called once with every item number from 0 to itemCount - 1.
+	UFRFrameArena* arena - The arena of the calling thread to make the batch jobs in, or NULL to make them on the heap.
+Return: void
+Description:
+	This method runs every item across the workers and the calling thread, and returns once all of them are finished.
+	The items are split into batches of neighbouring items, one job each, that count down a shared counter as they finish.
+	Each job only holds the loop and its batch number, which fits inside the job without allocating,
+	so with an arena a parallel for does not touch the heap. Its jobs are released by the time the arena is next reset.
+	What the batches allocate on other threads is added to the calling thread once they finish,
+	as if it had run them all, and they may not allocate if it may not.
+*/
+void UFRJobSystem::ParallelFor(int itemCount, const std::function<void(int)>& body, UFRFrameArena* arena)
+{
+	ParallelLoop loop;
+	UFRJobHandle job;
+	UFRAllocationCounts batchCounts;
+	int slot;
+
+	// Not worth waking the workers for
+	if (itemCount <= 1)
+	{
+		for (int item = 0; item < itemCount; item++)
+		{
+			body(item);
+		}
+		return;
+	}
+
+	loop.body = &body;
+	loop.itemCount = itemCount;
+	loop.batchCount = GetThreadCount() * JOBS_PER_THREAD;
+	if (loop.batchCount > itemCount)
+	{
+		loop.batchCount = itemCount;
+	}
+	loop.remaining = loop.batchCount;
+	loop.caller = std::this_thread::get_id();
+	loop.forbidden = UFRAllocations::IsForbidden();
+	loop.allocations = 0;
+	loop.bytes = 0;
+
+	for (int batch = 0; batch < loop.batchCount; batch++)
+	{
+		ParallelLoop* batchLoop = &loop;
+
+		Submit(Create([batchLoop, batch]() { RunBatch(batchLoop, batch); }, arena));
+	}
+
+	// Help with the batches until every one has finished
+	slot = FindSlot();
+	while (loop.remaining > 0)
+	{
+		if (Take(slot, &job))
+		{
+			Run(slot, job);
+			job.reset();
+		}
+		else
+		{
+			std::this_thread::yield();
+		}
+	}
+
+	batchCounts.allocations = loop.allocations;
+	batchCounts.bytes = loop.bytes;
+	UFRAllocations::Add(batchCounts);
+}
+
+
+
+/*
+Name:	RunBatch()
+Params:
+	ParallelLoop* loop - The parallel for the batch belongs to.
+	int batch - The number of the batch.
+Return: void
+Description:
+	This method calls the body of a parallel for with every item of one batch and counts the batch as finished.
+	On a thread other than the caller, the batch takes on whether the caller may allocate and its allocations are kept for the caller.
+	The loop may be gone as soon as the count reaches 0, so it is not touched afterwards.
+*/
+void UFRJobSystem::RunBatch(ParallelLoop* loop, int batch)
+{
+	int firstItem = (int)((long long)loop->itemCount * batch / loop->batchCount);
+	int endItem = (int)((long long)loop->itemCount * (batch + 1) / loop->batchCount);
+	bool onBehalf = std::this_thread::get_id() != loop->caller;
+	UFRAllocationCounts start;
+	UFRAllocationCounts end;
+	bool wasForbidden = false;
+
+	if (onBehalf)
+	{
+		start = UFRAllocations::GetThreadCounts();
+		wasForbidden = UFRAllocations::IsForbidden();
+		UFRAllocations::Forbid(loop->forbidden);
+	}
+
+	for (int item = firstItem; item < endItem; item++)
+	{
+		(*loop->body)(item);
+	}
+
+	if (onBehalf)
+	{
+		end = UFRAllocations::GetThreadCounts();
+		UFRAllocations::Forbid(wasForbidden);
+		loop->allocations += end.allocations - start.allocations;
+		loop->bytes += end.bytes - start.bytes;
+	}
+	loop->remaining--;
+}
+
+
+
+/*
+Name:	FindSlot()
+Params: void
+Return: int - The slot of the calling thread.
+Description:
+	This method finds which worker the calling thread is, or the shared slot if it is not one.
+*/
+int UFRJobSystem::FindSlot()
+{
+	std::thread::id self = std::this_thread::get_id();
+
+	for (int slot = 0; slot < workerCount; slot++)
+	{
+		if (workers[slot]->thread.get_id() == self)
+		{
+			return slot;
+		}
+	}
+
+	return sharedSlot;
+}
+
+
+
+/*
+Name:	Push()
+Params:
+	int slot - The deque to put the job on.
+	const UFRJobHandle& job - A job that is ready to run.
+Return: void
+Description:
+	This method queues a job and wakes a sleeping worker.
+	A full deque is doubled, with its jobs moved to the start of the new ring in order.
+*/
+void UFRJobSystem::Push(int slot, const UFRJobHandle& job)
+{
+	Worker* worker = workers[slot];
+
+	{
+		std::lock_guard<std::mutex> guard(worker->lock);
+		int capacity = (int)worker->jobs.size();
+
+		if (worker->jobCount == capacity)
+		{
+			std::vector<UFRJobHandle> grown(capacity * 2);
+
+			for (int index = 0; index < worker->jobCount; index++)
+			{
+				grown[index].swap(worker->jobs[(worker->firstJob + index) & (capacity - 1)]);
+			}
+			worker->jobs.swap(grown);
+			worker->firstJob = 0;
+			capacity *= 2;
+		}
+
+		worker->jobs[(worker->firstJob + worker->jobCount) & (capacity - 1)] = job;
+		worker->jobCount++;
+	}
+	queuedJobs++;
+
+	// Taking the lock makes sure a worker about to sleep sees the job first
+	{
+		std::lock_guard<std::mutex> guard(sleepLock);
+	}
+	jobReady.notify_one();
+}
+
+
+
+/*
+Name:	Pop()
+Params:
+	int slot - The deque to take from.
+	bool newest - Whether to take the newest job, as the owner does, or the oldest, as a thief does.
+	UFRJobHandle* job - Set to the job taken.
+Return: bool - Whether there was a job.
+Description:
+	This method takes a job off one end of a deque.
+*/
+bool UFRJobSystem::Pop(int slot, bool newest, UFRJobHandle* job)
+{
+	Worker* worker = workers[slot];
+	std::lock_guard<std::mutex> guard(worker->lock);
+	int mask = (int)worker->jobs.size() - 1;
+
+	if (worker->jobCount == 0)
+	{
+		return false;
+	}
+
+	if (newest)
+	{
+		UFRJobHandle& newestJob = worker->jobs[(worker->firstJob + worker->jobCount - 1) & mask];
+		*job = newestJob;
+		newestJob.reset();
+	}
+	else
+	{
+		*job = worker->jobs[worker->firstJob];
+		worker->jobs[worker->firstJob].reset();
+		worker->firstJob = (worker->firstJob + 1) & mask;
+	}
+	worker->jobCount--;
+	queuedJobs--;
+
+	return true;
+}
+
+
+
+/*
+Name:	Take()
+Params:
+	int slot - The slot of the calling thread.
+	UFRJobHandle* job - Set to the job to run.
+Return: bool - Whether a job was found.
+Description:
+	This method finds the next job for a thread: its own newest job, then the oldest shared job,
+	then the oldest job of another worker, starting with its neighbour.
+*/
+bool UFRJobSystem::Take(int slot, UFRJobHandle* job)
+{
+	int victim;
+
+	if (slot != sharedSlot && Pop(slot, true, job))
+	{
+		return true;
+	}
+
+	if (Pop(sharedSlot, false, job))
+	{
+		return true;
+	}
+
+	for (int offset = 1; offset <= workerCount; offset++)
+	{
+		victim = (slot + offset) % workerCount;
+		if (victim != slot && Pop(victim, false, job))
+		{
+			workers[slot]->steals++;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+
+
+/*
+Name:	Run()
+Params:
+	int slot - The slot of the calling thread.
+	const UFRJobHandle& job - The job to run.
+Return: void
+Description:
+	This method runs a job, marks it finished and queues the jobs that were only waiting for it.
+	The work is released once it has run, so whatever it holds on to goes with it.
+	No dependents are added once the job is finished, so they are queued without holding its lock.
+*/
+void UFRJobSystem::Run(int slot, const UFRJobHandle& job)
+{
+	long long start = clock.Now();
+
+	{
+		UFRTraceZone jobZone("Job");
+		job->work();
+		job->work = nullptr;
+	}
+
+	workers[slot]->busyTime += clock.Now() - start;
+	workers[slot]->jobsRun++;
+
+	{
+		std::lock_guard<std::mutex> guard(job->lock);
+		job->finished = true;
+	}
+	job->done = true;
+
+	if (job->dependents != NULL)
+	{
+		for (int dependent = 0; dependent < job->dependents->size(); dependent++)
+		{
+			if (--(*job->dependents)[dependent]->waitingFor == 0)
+			{
+				Push(slot, (*job->dependents)[dependent]);
+			}
+		}
+		job->dependents->clear();
+	}
+}
+
+
+
+/*
+Name:	WorkerLoop()
+Params: int slot - The slot of the worker.
+Return: void
+Description:
+	This method runs on every worker thread. It runs jobs while there are any and sleeps when there are none.
+*/
+void UFRJobSystem::WorkerLoop(int slot)
+{
+	UFRJobHandle job;
+
+	UFRTrace::NameThread("Worker");
+	while (true)
+	{
+		if (Take(slot, &job))
+		{
+			Run(slot, job);
+			job.reset();
+			continue;
+		}
+
+		std::unique_lock<std::mutex> guard(sleepLock);
+		while (!stopping && queuedJobs == 0)
+		{
+			jobReady.wait(guard);
+		}
+		if (stopping)
+		{
+			return;
+		}
+	}
+}
@@ -0,0 +1,134 @@
+/*
+File:		UFRJobSystem.h
+Project:	Unhappy Flying Reptiles
+Author(s):	Jorge Ramirez
+Description:
+	This file contains the class definitions for the UFRJob and UFRJobSystem classes.
+*/
+
+#pragma once
+#include <vector>
+#include <memory>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <functional>
+#include "UFRClock.h"
+#include "UFRFrameArena.h"
+
+
+/*
+Name: UFRJob
+Description:
+	A piece of work for the job system and the jobs that wait for it to finish.
+	A job runs once every job it depends on has finished and it has been submitted.
+*/
+class UFRJob
+{
+private:
+	friend class UFRJobSystem;
+
+	std::function<void()> work;
+	std::atomic<int> waitingFor; // Unfinished dependencies, plus one until the job is submitted
+	std::mutex lock; // Guards dependents and finished
+	std::vector<std::shared_ptr<UFRJob> >* dependents; // Made by the first DependsOn, so most jobs never allocate one
+	bool finished;
+	std::atomic<bool> done; // Set once the work has run, for threads waiting on the job
+
+	UFRJob(const UFRJob&);
+	UFRJob& operator=(const UFRJob&);
+
+public:
+	UFRJob(const std::function<void()>& jobWork) : waitingFor(1), done(false) { work = jobWork; dependents = NULL; finished = false; }
+	~UFRJob() { delete dependents; }
+
+	bool IsDone() { return done; }
+};
+
+typedef std::shared_ptr<UFRJob> UFRJobHandle;
+
+
+/*
+Name: UFRJobSystem
+Description:
+	This class is designed to run every piece of parallel work in the game on one fixed set of worker threads.
+	Each worker keeps its own deque of jobs, a ring that only ever grows, so queueing jobs does not allocate once it is big enough. It runs the newest of its own jobs first, and when it has none
+	it takes the oldest job of another worker, so idle workers steal from busy ones instead of sitting on a shared lock.
+	Jobs submitted from threads that are not workers go to a shared queue that every worker takes from.
+	A thread that waits for a job runs other jobs until it is done, so waiting never leaves a processor idle.
+	Jobs can be made in a frame arena, so work handed out every tick or frame does not allocate.
+	A parallel for counts the allocations of its batches on the calling thread and forbids them when the caller does,
+	so a tick or frame sees everything it handed out. Jobs submitted on their own are only counted where they run.
+	Every worker counts the jobs it runs, the jobs it steals and the time it is busy.
+	The threads outside the pool that help while they wait are counted together in one more slot.
+	Nothing here depends on MFC.
+*/
+class UFRJobSystem
+{
+private:
+	struct Worker
+	{
+		std::vector<UFRJobHandle> jobs; // A ring of a power of two. Owner works from the back, thieves take from the front.
+		int firstJob; // Where the oldest job is in the ring
+		int jobCount;
+		std::mutex lock;
+		std::thread thread;
+		std::atomic<unsigned int> jobsRun;
+		std::atomic<unsigned int> steals;
+		std::atomic<long long> busyTime; // In microseconds
+	};
+
+	// The state of one parallel for, shared by its batches on the stack of the thread that runs it
+	struct ParallelLoop
+	{
+		const std::function<void(int)>* body;
+		int itemCount;
+		int batchCount;
+		std::atomic<int> remaining; // Batches that have not finished
+		std::thread::id caller;
+		bool forbidden; // Whether the caller may not allocate, which holds for the batches it hands out too
+		std::atomic<unsigned long long> allocations; // Made by the batches other threads ran
+		std::atomic<unsigned long long> bytes;
+	};
+
+	std::vector<Worker*> workers; // The threads, then the slot shared by every other thread
+	int workerCount;
+	int sharedSlot;
+
+	std::mutex sleepLock;
+	std::condition_variable jobReady;
+	std::atomic<int> queuedJobs;
+	bool stopping;
+
+	UFRSystemClock clock;
+	long long startTime;
+
+	int FindSlot();
+	void Push(int slot, const UFRJobHandle& job);
+	bool Pop(int slot, bool newest, UFRJobHandle* job);
+	bool Take(int slot, UFRJobHandle* job);
+	void Run(int slot, const UFRJobHandle& job);
+	void WorkerLoop(int slot);
+	static void RunBatch(ParallelLoop* loop, int batch);
+
+	UFRJobSystem(const UFRJobSystem&);
+	UFRJobSystem& operator=(const UFRJobSystem&);
+
+public:
+	UFRJobSystem(int threadCount);
+	~UFRJobSystem();
+
+	UFRJobHandle Create(const std::function<void()>& work, UFRFrameArena* arena = NULL);
+	void DependsOn(const UFRJobHandle& job, const UFRJobHandle& dependency);
+	void Submit(const UFRJobHandle& job);
+	void Wait(const UFRJobHandle& job);
+	void ParallelFor(int itemCount, const std::function<void(int)>& body, UFRFrameArena* arena = NULL);
+
+	int GetThreadCount() { return workerCount + 1; }
+	int GetSlotCount() { return (int)workers.size(); }
+	unsigned int GetJobsRun(int slot) { return workers[slot]->jobsRun; }
+	unsigned int GetSteals(int slot) { return workers[slot]->steals; }
+	long long GetBusyTime(int slot) { return workers[slot]->busyTime; }
+	long long GetUptime() { return clock.Now() - startTime; }
+};
@@ -0,0 +1,117 @@
+/*
+File:		UFRLatencyStats.cpp
+Project:	Unhappy Flying Reptiles
+Author(s):	Jorge Ramirez
+Description:
+	This file contains the method definitions for the UFRLatencyStats class.
+*/
+
+#include "UFRLatencyStats.h"
+#include <algorithm>
+
+#define MICROSECONDS_PER_MILLISECOND 1000.0
+
+
+/*
+Name:	UFRLatencyStats()
+Params: void
+Description:
+	Constructor for the UFRLatencyStats class. Room for LATENCY_MAX_SAMPLES samples is reserved.
+*/
+UFRLatencyStats::UFRLatencyStats()
+{
+	samples.reserve(LATENCY_MAX_SAMPLES);
+	Reset();
+}
+
+
+
+/*
+Name:	Reset()
+Params: void
+Return: void
+Description:
+	This method clears all the recorded samples.
+*/
+void UFRLatencyStats::Reset()
+{
+	samples.clear();
+	sampleCount = 0;
+	maxLatency = 0;
+}
+
+
+
+/*
+Name:	Record()
+Params: long long microseconds - The time from an input until its result.
+Return: void
+Description:
+	This method adds one latency sample. Once LATENCY_MAX_SAMPLES are kept, later samples only count
+	towards the number of samples and the worst latency.
+*/
+void UFRLatencyStats::Record(long long microseconds)
+{
+	if (microseconds < 0)
+	{
+		microseconds = 0;
+	}
+
+	if (samples.size() < LATENCY_MAX_SAMPLES)
+	{
+		samples.push_back(microseconds);
+	}
+	sampleCount++;
+	if (microseconds > maxLatency)
+	{
+		maxLatency = microseconds;
+	}
+}
+
+
+
+/*
+Name:	GetPercentile()
+Params: double percent - The percentile to find, from 0 to 100.
+Return: double - The latency in milliseconds that the given percent of the kept samples are at or below.
+Description:
+	This method sorts a copy of the kept samples and picks the nearest rank, so it is only meant for reporting.
+*/
+double UFRLatencyStats::GetPercentile(double percent)
+{
+	std::vector<long long> sorted(samples);
+	int rank;
+
+	if (sorted.empty())
+	{
+		return 0;
+	}
+
+	std::sort(sorted.begin(), sorted.end());
+
+	rank = (int)(percent / 100.0 * sorted.size() + 0.5) - 1;
+	if (rank < 0)
+	{
+		rank = 0;
+	}
+	else if (rank >= (int)sorted.size())
+	{
+		rank = (int)sorted.size() - 1;
+	}
+
+	return sorted[rank] / MICROSECONDS_PER_MILLISECOND;
+}
+
+
+
+/*
+Name:	GetMaxLatency()
+Params: void
+Return: double - The worst latency recorded, in milliseconds.
+Description:
+	This method returns the worst latency, including samples that were not kept.
+*/
+double UFRLatencyStats::GetMaxLatency()
+{
+	return maxLatency / MICROSECONDS_PER_MILLISECOND;
+}
@@ -0,0 +1,43 @@
+/*
+File:		UFRLatencyStats.h
+Project:	Unhappy Flying Reptiles
+Author(s):	Jorge Ramirez
+Description:
+	This file contains the class definition for the UFRLatencyStats class.
+*/
+
+#pragma once
+#include <vector>
+
+#define LATENCY_MAX_SAMPLES 4096 // Later samples are counted but not kept
+
+
+/*
+Name: UFRLatencyStats
+Description:
+	This class is designed to collect how long it takes from an input until its result is seen or heard,
+	and to give the percentiles of those times.
+	Room for the samples is made up front, so recording never allocates and can be done on the audio thread.
+	Only one thread may record at a time, and the percentiles are only read once it has stopped.
+	Nothing here depends on MFC.
+*/
+class UFRLatencyStats
+{
+private:
+	std::vector<long long> samples; // In microseconds
+	unsigned int sampleCount;
+	long long maxLatency;
+
+	UFRLatencyStats(const UFRLatencyStats&);
+	UFRLatencyStats& operator=(const UFRLatencyStats&);
+
+public:
+	UFRLatencyStats();
+
+	void Record(long long microseconds);
+	void Reset();
+
+	unsigned int GetSampleCount() { return sampleCount; }
+	double GetPercentile(double percent);
+	double GetMaxLatency();
+};
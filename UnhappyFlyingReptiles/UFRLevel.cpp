@@ -0,0 +1,404 @@
+/*
+File:		UFRLevel.cpp
+Project:	Unhappy Flying Reptiles
+Author(s):	Jorge Ramirez
+Description:
+	This file contains the method definitions for the UFRLevel class.
+*/
+
+#include "UFRLevel.h"
+#include "UFRWaveFile.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#define LEVEL_VALUE_SIZE 4 // Every field of a crate is a 4 byte value
+#define LEVEL_LINE_LENGTH 256
+#define LEVEL_COMMENT '#'
+#define LEVEL_BLANKS " \t\r\n"
+
+
+/*
+Name:	UFRLevel()
+Params: void
+Description:
+	Constructor for the UFRLevel class. The level has no crates until Open or Parse is called.
+*/
+UFRLevel::UFRLevel()
+{
+#ifdef _WIN32
+	file = INVALID_HANDLE_VALUE;
+	mapping = NULL;
+#else
+	file = -1;
+#endif
+	base = NULL;
+	fileSize = 0;
+	crateCount = 0;
+	errorLine = 0;
+	for (int array = 0; array < LEVEL_ARRAY_COUNT; array++)
+	{
+		arrays[array] = NULL;
+	}
+}
+
+
+
+/*
+Name:	~UFRLevel()
+Params: void
+Description:
+	Destructor for the UFRLevel class. The level file is unmapped.
+*/
+UFRLevel::~UFRLevel()
+{
+	Close();
+}
+
+
+
+/*
+Name:	Open()
+Params: const wchar_t* path - The binary level file.
+Return: bool - Whether the file is a valid level.
+Description:
+	This method maps a binary level and checks that its header and every array fit inside it.
+	The weights and scales are checked too, since the physics divides by the weight,
+	so opening reads those two arrays once but parses and copies nothing.
+*/
+bool UFRLevel::Open(const wchar_t* path)
+{
+	const UFRLevelHeader* header;
+	unsigned long long offset;
+
+	Close();
+
+	if (!Map(path) || fileSize < sizeof(UFRLevelHeader))
+	{
+		Close();
+		return false;
+	}
+
+	header = (const UFRLevelHeader*)base;
+	if (memcmp(header->magic, LEVEL_MAGIC, sizeof(header->magic)) != 0 || header->version != LEVEL_VERSION ||
+		header->crateCount < 0)
+	{
+		Close();
+		return false;
+	}
+
+	for (int array = 0; array < LEVEL_ARRAY_COUNT; array++)
+	{
+		offset = header->arrayOffsets[array];
+		if (offset % LEVEL_VALUE_SIZE != 0 || offset > fileSize ||
+			(fileSize - offset) / LEVEL_VALUE_SIZE < (unsigned long long)header->crateCount)
+		{
+			Close();
+			return false;
+		}
+		arrays[array] = base + offset;
+	}
+
+	for (int crate = 0; crate < header->crateCount; crate++)
+	{
+		if (!IsValidCrate(((const unsigned int*)arrays[LEVEL_ARRAY_WEIGHTS])[crate], ((const float*)arrays[LEVEL_ARRAY_SCALES])[crate]))
+		{
+			Close();
+			return false;
+		}
+	}
+	crateCount = header->crateCount;
+
+	return true;
+}
+
+
+
+/*
+Name:	Map()
+Params: const wchar_t* path - The file to map.
+Return: bool - Whether the whole file was mapped.
+Description:
+	This method maps a file read only and sets base and fileSize.
+*/
+bool UFRLevel::Map(const wchar_t* path)
+{
+#ifdef _WIN32
+	LARGE_INTEGER size;
+
+	file = CreateFile(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+	if (file == INVALID_HANDLE_VALUE || !GetFileSizeEx(file, &size) || size.QuadPart == 0)
+	{
+		return false;
+	}
+	fileSize = size.QuadPart;
+
+	mapping = CreateFileMapping(file, NULL, PAGE_READONLY, 0, 0, NULL);
+	if (mapping != NULL)
+	{
+		base = (const unsigned char*)MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+	}
+	return base != NULL;
+#else
+	char narrowPath[1024];
+	size_t converted;
+	struct stat status;
+	void* view;
+
+	// A path that fills the buffer is not terminated
+	converted = wcstombs(narrowPath, path, sizeof(narrowPath));
+	if (converted == (size_t)-1 || converted >= sizeof(narrowPath))
+	{
+		return false;
+	}
+
+	file = open(narrowPath, O_RDONLY);
+	if (file < 0 || fstat(file, &status) != 0 || status.st_size == 0)
+	{
+		return false;
+	}
+	fileSize = status.st_size;
+
+	view = mmap(NULL, fileSize, PROT_READ, MAP_PRIVATE, file, 0);
+	if (view == MAP_FAILED)
+	{
+		return false;
+	}
+	base = (const unsigned char*)view;
+	return true;
+#endif
+}
+
+
+
+/*
+Name:	Parse()
+Params: const wchar_t* path - The text level file.
+Return: bool - Whether every line was a crate, a comment or blank. If not, GetErrorLine says which line was not.
+Description:
+	This method reads a text level, one crate per line as "left bottom weight forceGiven scale".
+	Anything after a # is a comment. A crate with no weight or a scale that is not a positive number up to LEVEL_MAX_SCALE is an error.
+*/
+bool UFRLevel::Parse(const wchar_t* path)
+{
+	FILE* levelFile;
+	char line[LEVEL_LINE_LENGTH];
+	char* comment;
+	int lineNumber = 0;
+	int left;
+	int bottom;
+	unsigned int weight;
+	float forceGiven;
+	float scale;
+	int end;
+
+	Close();
+
+	levelFile = UFRWaveFile::OpenFile(path, L"r");
+	if (levelFile == NULL)
+	{
+		return false;
+	}
+
+	while (fgets(line, sizeof(line), levelFile) != NULL)
+	{
+		lineNumber++;
+		comment = strchr(line, LEVEL_COMMENT);
+		if (comment != NULL)
+		{
+			*comment = '\0';
+		}
+
+		// A blank line
+		if (line[strspn(line, LEVEL_BLANKS)] == '\0')
+		{
+			continue;
+		}
+
+		// A crate, with nothing after it
+		end = 0;
+		if (sscanf(line, "%d %d %u %f %f %n", &left, &bottom, &weight, &forceGiven, &scale, &end) != 5 || line[end] != '\0' ||
+			!IsValidCrate(weight, scale))
+		{
+			fclose(levelFile);
+			Close();
+			errorLine = lineNumber;
+			return false;
+		}
+
+		AddCrate(left, bottom, weight, forceGiven, scale);
+	}
+	fclose(levelFile);
+
+	return true;
+}
+
+
+
+/*
+Name:	IsValidCrate()
+Params:
+	unsigned int weight - The weight of the crate.
+	float scale - The factor by which to scale the crate.
+Return: bool - Whether the crate can be put in the world. Its weight is divided by on impact and its sprite must have a size.
+Description:
+	This method checks a crate read from a level file. Levels are data from outside the game, so nothing in them is trusted.
+	The scale sizes the sprite of the crate in the atlas, so it is kept to LEVEL_MAX_SCALE.
+	Both comparisons are false for NaN, and infinity is past the maximum, so neither gets through.
+*/
+bool UFRLevel::IsValidCrate(unsigned int weight, float scale)
+{
+	return weight > 0 && scale > 0 && scale <= LEVEL_MAX_SCALE;
+}
+
+
+
+/*
+Name:	AddCrate()
+Params:
+	int left - The offset from the left of the crate.
+	int bottom - The offset from the bottom of the crate.
+	unsigned int weight - The weight of the crate.
+	float forceGiven - The force that the crate gives up on impact.
+	float scale - The factor by which to scale the crate.
+Return: void
+Description:
+	This method adds a crate at the end of a level that was parsed or is being built. A mapped level cannot change.
+*/
+void UFRLevel::AddCrate(int left, int bottom, unsigned int weight, float forceGiven, float scale)
+{
+	if (base != NULL)
+	{
+		return;
+	}
+
+	parsedLefts.push_back(left);
+	parsedBottoms.push_back(bottom);
+	parsedWeights.push_back(weight);
+	parsedForcesGiven.push_back(forceGiven);
+	parsedScales.push_back(scale);
+
+	crateCount = (int)parsedLefts.size();
+	arrays[LEVEL_ARRAY_LEFTS] = parsedLefts.data();
+	arrays[LEVEL_ARRAY_BOTTOMS] = parsedBottoms.data();
+	arrays[LEVEL_ARRAY_WEIGHTS] = parsedWeights.data();
+	arrays[LEVEL_ARRAY_FORCES_GIVEN] = parsedForcesGiven.data();
+	arrays[LEVEL_ARRAY_SCALES] = parsedScales.data();
+}
+
+
+
+/*
+Name:	Write()
+Params: const wchar_t* path - The binary level file to write.
+Return: bool - Whether the whole file was written.
+Description:
+	This method writes the crates of the level as a binary level that Open can map.
+	Each array is padded to start on a multiple of LEVEL_ALIGNMENT.
+*/
+bool UFRLevel::Write(const wchar_t* path)
+{
+	FILE* levelFile;
+	UFRLevelHeader header;
+	unsigned long long offset = sizeof(UFRLevelHeader);
+	unsigned long long written = 0;
+	char padding[LEVEL_ALIGNMENT];
+	bool ok = true;
+
+	memset(&header, 0, sizeof(header));
+	memset(padding, 0, sizeof(padding));
+	memcpy(header.magic, LEVEL_MAGIC, sizeof(header.magic));
+	header.version = LEVEL_VERSION;
+	header.crateCount = crateCount;
+	for (int array = 0; array < LEVEL_ARRAY_COUNT; array++)
+	{
+		offset = (offset + LEVEL_ALIGNMENT - 1) / LEVEL_ALIGNMENT * LEVEL_ALIGNMENT;
+		header.arrayOffsets[array] = offset;
+		offset += (unsigned long long)crateCount * LEVEL_VALUE_SIZE;
+	}
+
+	levelFile = UFRWaveFile::OpenFile(path, L"wb");
+	if (levelFile == NULL)
+	{
+		return false;
+	}
+
+	ok = fwrite(&header, sizeof(header), 1, levelFile) == 1;
+	written = sizeof(header);
+	for (int array = 0; array < LEVEL_ARRAY_COUNT && ok; array++)
+	{
+		ok = fwrite(padding, 1, (size_t)(header.arrayOffsets[array] - written), levelFile) == header.arrayOffsets[array] - written &&
+			fwrite(arrays[array], LEVEL_VALUE_SIZE, crateCount, levelFile) == (size_t)crateCount;
+		written = header.arrayOffsets[array] + (unsigned long long)crateCount * LEVEL_VALUE_SIZE;
+	}
+
+	if (fclose(levelFile) != 0)
+	{
+		ok = false;
+	}
+
+	return ok;
+}
+
+
+
+/*
+Name:	Close()
+Params: void
+Return: void
+Description:
+	This method unmaps or frees the level. Its arrays must no longer be used.
+*/
+void UFRLevel::Close()
+{
+#ifdef _WIN32
+	if (base != NULL)
+	{
+		UnmapViewOfFile(base);
+	}
+	if (mapping != NULL)
+	{
+		CloseHandle(mapping);
+		mapping = NULL;
+	}
+	if (file != INVALID_HANDLE_VALUE)
+	{
+		CloseHandle(file);
+		file = INVALID_HANDLE_VALUE;
+	}
+#else
+	if (base != NULL)
+	{
+		munmap((void*)base, fileSize);
+	}
+	if (file >= 0)
+	{
+		close(file);
+		file = -1;
+	}
+#endif
+	base = NULL;
+	fileSize = 0;
+
+	parsedLefts.clear();
+	parsedBottoms.clear();
+	parsedWeights.clear();
+	parsedForcesGiven.clear();
+	parsedScales.clear();
+
+	crateCount = 0;
+	errorLine = 0;
+	for (int array = 0; array < LEVEL_ARRAY_COUNT; array++)
+	{
+		arrays[array] = NULL;
+	}
+}
@@ -0,0 +1,97 @@
+/*
+File:		UFRLevel.h
+Project:	Unhappy Flying Reptiles
+Author(s):	Jorge Ramirez
+Description:
+	This file contains the class definition for the UFRLevel class and the layout of a level file.
+*/
+
+#pragma once
+#include <vector>
+
+#define LEVEL_MAGIC "UFRL"
+#define LEVEL_VERSION 1
+#define LEVEL_ALIGNMENT 64 // Every array starts on its own cache line
+#define LEVEL_MAX_SCALE 8.0f // Far larger than any crate fits on screen, and small enough that the scaled sprite sizes cannot overflow
+
+#define LEVEL_ARRAY_LEFTS 0 // int
+#define LEVEL_ARRAY_BOTTOMS 1 // int
+#define LEVEL_ARRAY_WEIGHTS 2 // unsigned int
+#define LEVEL_ARRAY_FORCES_GIVEN 3 // float
+#define LEVEL_ARRAY_SCALES 4 // float
+#define LEVEL_ARRAY_COUNT 5
+
+
+/*
+Name: UFRLevelHeader
+Description:
+	The start of a level file. Each field of the crates is packed in its own array of crateCount 4 byte values,
+	at arrayOffsets[LEVEL_ARRAY_...] from the start of the file.
+*/
+struct UFRLevelHeader
+{
+	char magic[4];
+	int version;
+	int crateCount;
+	int reserved;
+	unsigned long long arrayOffsets[LEVEL_ARRAY_COUNT];
+};
+
+
+/*
+Name: UFRLevel
+Description:
+	This class is designed to hand the crates of a level to the game as packed arrays, one for each field.
+	A binary level is mapped read only and its arrays are used where they lie in the file, nothing is parsed or copied,
+	so the load only reads the weights and scales it checks, whatever the size of the level.
+	A text level, one crate per line as "left bottom weight forceGiven scale" with # comments,
+	is parsed into arrays of its own. It is how levels are authored, and Write turns it into a binary level.
+	A level can also be built a crate at a time with AddCrate, as the level generator does.
+	The arrays are only valid while the level is open.
+	Nothing here depends on MFC.
+*/
+class UFRLevel
+{
+private:
+#ifdef _WIN32
+	void* file;
+	void* mapping;
+#else
+	int file;
+#endif
+	const unsigned char* base;
+	unsigned long long fileSize;
+
+	int crateCount;
+	const void* arrays[LEVEL_ARRAY_COUNT];
+	std::vector<int> parsedLefts;
+	std::vector<int> parsedBottoms;
+	std::vector<unsigned int> parsedWeights;
+	std::vector<float> parsedForcesGiven;
+	std::vector<float> parsedScales;
+	int errorLine; // The text line that could not be parsed, or 0
+
+	bool Map(const wchar_t* path);
+	static bool IsValidCrate(unsigned int weight, float scale);
+
+	UFRLevel(const UFRLevel&);
+	UFRLevel& operator=(const UFRLevel&);
+
+public:
+	UFRLevel();
+	~UFRLevel();
+
+	bool Open(const wchar_t* path);
+	bool Parse(const wchar_t* path);
+	bool Write(const wchar_t* path);
+	void AddCrate(int left, int bottom, unsigned int weight, float forceGiven, float scale);
+	void Close();
+
+	int GetCrateCount() { return crateCount; }
+	const int* GetLefts() { return (const int*)arrays[LEVEL_ARRAY_LEFTS]; }
+	const int* GetBottoms() { return (const int*)arrays[LEVEL_ARRAY_BOTTOMS]; }
+	const unsigned int* GetWeights() { return (const unsigned int*)arrays[LEVEL_ARRAY_WEIGHTS]; }
+	const float* GetForcesGiven() { return (const float*)arrays[LEVEL_ARRAY_FORCES_GIVEN]; }
+	const float* GetScales() { return (const float*)arrays[LEVEL_ARRAY_SCALES]; }
+	int GetErrorLine() { return errorLine; }
+};
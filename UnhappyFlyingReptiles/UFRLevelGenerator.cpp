@@ -0,0 +1,301 @@
+/*
+File:		UFRLevelGenerator.cpp
+Project:	Unhappy Flying Reptiles
+Author(s):	Jorge Ramirez
+Description:
+	This file contains the method definitions for the UFRLevelGenerator class.
+*/
+
+#include "UFRLevelGenerator.h"
+#include <stddef.h>
+
+#define CRATE_SPRITE_SIZE 131 // The width and height of the crate sprite files
+#define GENERATOR_GROUND 20 // The bottom of the lowest crates, as in the hand placed level
+#define GENERATOR_FIRST_LEFT 80
+#define GENERATOR_CRATE_GAP 2 // Between crates, so none start out touching
+#define GENERATOR_STRUCTURE_GAP 40
+
+#define MIN_TOWER_CRATES 2
+#define MAX_TOWER_CRATES 12
+#define MIN_PYRAMID_BASE 3
+#define MAX_PYRAMID_BASE 10
+#define MIN_WALL_ROWS 2
+#define MAX_WALL_ROWS 6
+#define MIN_WALL_COLUMNS 3
+#define MAX_WALL_COLUMNS 12
+#define MIN_PILE_CRATES 5
+#define MAX_PILE_CRATES 40
+#define PILE_WIDTH 200
+#define PILE_HEIGHT 300 // Piled crates start anywhere up to this high and fall
+
+// A numerical recipes linear congruential generator
+#define RANDOM_MULTIPLIER 1664525u
+#define RANDOM_INCREMENT 1013904223u
+#define RANDOM_SHIFT 8 // The low bits of the generator repeat quickly, so they are dropped
+
+
+/*
+Name: CrateClass
+Description:
+	How the crates of one class are made. The weights fall on the same sides of HEAVY_CRATE_THRESHOLD
+	and LIGHT_CRATE_THRESHOLD as the sprites UFRCrates picks, and the rest match the hand placed level.
+*/
+struct CrateClass
+{
+	int minWeight;
+	int maxWeight;
+	float forceGiven;
+	float scale;
+};
+
+static const CrateClass crateClasses[CRATE_CLASS_COUNT] =
+{
+	{ 1, 3, 0.5f, 0.3f }, // Light
+	{ 4, 11, 0.7f, 0.4f }, // Normal
+	{ 12, 20, 0.5f, 0.5f } // Heavy
+};
+
+
+/*
+Name:	UFRLevelGenerator()
+Params: unsigned int seed - The seed of the layout. The same seed always gives the same level.
+Description:
+	Constructor for the UFRLevelGenerator class.
+*/
+UFRLevelGenerator::UFRLevelGenerator(unsigned int seed)
+{
+	randomState = seed;
+	level = NULL;
+	remainingCrates = 0;
+}
+
+
+
+/*
+Name:	Generate()
+Params:
+	UFRLevel* output - The level to build. Any crates it had are removed.
+	int crateCount - The number of crates, from GENERATOR_MIN_CRATES to GENERATOR_MAX_CRATES.
+Return: int - The number of crates in the level, which is crateCount kept inside those limits.
+Description:
+	This method builds a level from structures picked at random, each with a random size,
+	until there are crateCount crates. The last structure is cut short to fit.
+*/
+int UFRLevelGenerator::Generate(UFRLevel* output, int crateCount)
+{
+	int left = GENERATOR_FIRST_LEFT;
+	int width = 0;
+
+	if (crateCount < GENERATOR_MIN_CRATES)
+	{
+		crateCount = GENERATOR_MIN_CRATES;
+	}
+	if (crateCount > GENERATOR_MAX_CRATES)
+	{
+		crateCount = GENERATOR_MAX_CRATES;
+	}
+
+	level = output;
+	level->Close();
+	remainingCrates = crateCount;
+
+	while (remainingCrates > 0)
+	{
+		switch (NextRandom() % STRUCTURE_COUNT)
+		{
+		case STRUCTURE_TOWER:
+			width = AddTower(left);
+			break;
+		case STRUCTURE_PYRAMID:
+			width = AddPyramid(left);
+			break;
+		case STRUCTURE_WALL:
+			width = AddWall(left);
+			break;
+		default:
+			width = AddPile(left);
+			break;
+		}
+		left += width + GENERATOR_STRUCTURE_GAP;
+	}
+
+	level = NULL;
+	return crateCount;
+}
+
+
+
+/*
+Name:	AddTower()
+Params: int left - Where the tower starts.
+Return: int - The width of the tower.
+Description:
+	This method stacks crates of one class in a single column.
+*/
+int UFRLevelGenerator::AddTower(int left)
+{
+	int crateClass = NextRandom() % CRATE_CLASS_COUNT;
+	int size = GetCrateSize(crateClass);
+	int height = RandomBetween(MIN_TOWER_CRATES, MAX_TOWER_CRATES);
+
+	for (int crate = 0; crate < height && remainingCrates > 0; crate++)
+	{
+		AddCrate(crateClass, left, GENERATOR_GROUND + crate * (size + GENERATOR_CRATE_GAP));
+	}
+
+	return size;
+}
+
+
+
+/*
+Name:	AddPyramid()
+Params: int left - Where the pyramid starts.
+Return: int - The width of the pyramid.
+Description:
+	This method stacks rows of crates of one class, each row one crate shorter and centred on the row below.
+	The base is made smaller if there are not enough crates left for the whole pyramid.
+*/
+int UFRLevelGenerator::AddPyramid(int left)
+{
+	int crateClass = NextRandom() % CRATE_CLASS_COUNT;
+	int size = GetCrateSize(crateClass);
+	int step = size + GENERATOR_CRATE_GAP;
+	int base = RandomBetween(MIN_PYRAMID_BASE, MAX_PYRAMID_BASE);
+
+	while (base > 1 && base * (base + 1) / 2 > remainingCrates)
+	{
+		base--;
+	}
+
+	for (int row = 0; row < base; row++)
+	{
+		for (int column = 0; column < base - row && remainingCrates > 0; column++)
+		{
+			AddCrate(crateClass, left + row * step / 2 + column * step, GENERATOR_GROUND + row * step);
+		}
+	}
+
+	return base * step - GENERATOR_CRATE_GAP;
+}
+
+
+
+/*
+Name:	AddWall()
+Params: int left - Where the wall starts.
+Return: int - The width of the wall.
+Description:
+	This method lays light crates in rows like bricks, every other row moved half a crate to the right.
+*/
+int UFRLevelGenerator::AddWall(int left)
+{
+	int size = GetCrateSize(CRATE_CLASS_LIGHT);
+	int step = size + GENERATOR_CRATE_GAP;
+	int rows = RandomBetween(MIN_WALL_ROWS, MAX_WALL_ROWS);
+	int columns = RandomBetween(MIN_WALL_COLUMNS, MAX_WALL_COLUMNS);
+
+	if (columns > remainingCrates)
+	{
+		columns = remainingCrates;
+	}
+
+	for (int row = 0; row < rows; row++)
+	{
+		for (int column = 0; column < columns && remainingCrates > 0; column++)
+		{
+			AddCrate(CRATE_CLASS_LIGHT, left + (row % 2) * step / 2 + column * step, GENERATOR_GROUND + row * step);
+		}
+	}
+
+	return columns * step + step / 2;
+}
+
+
+
+/*
+Name:	AddPile()
+Params: int left - Where the pile starts.
+Return: int - The width of the pile.
+Description:
+	This method drops crates of every class anywhere over PILE_WIDTH, up to PILE_HEIGHT high.
+	They may start inside each other, so piles are where collisions are hardest.
+*/
+int UFRLevelGenerator::AddPile(int left)
+{
+	int crates = RandomBetween(MIN_PILE_CRATES, MAX_PILE_CRATES);
+	int crateClass;
+
+	for (int crate = 0; crate < crates && remainingCrates > 0; crate++)
+	{
+		crateClass = NextRandom() % CRATE_CLASS_COUNT;
+		AddCrate(crateClass, left + RandomBetween(0, PILE_WIDTH - GetCrateSize(crateClass)), GENERATOR_GROUND + RandomBetween(0, PILE_HEIGHT));
+	}
+
+	return PILE_WIDTH;
+}
+
+
+
+/*
+Name:	AddCrate()
+Params:
+	int crateClass - The CRATE_CLASS_ of the crate.
+	int left - The offset from the left of the crate.
+	int bottom - The offset from the bottom of the crate.
+Return: void
+Description:
+	This method adds one crate of a class to the level, with a random weight within the class.
+*/
+void UFRLevelGenerator::AddCrate(int crateClass, int left, int bottom)
+{
+	const CrateClass& crate = crateClasses[crateClass];
+
+	level->AddCrate(left, bottom, (unsigned int)RandomBetween(crate.minWeight, crate.maxWeight), crate.forceGiven, crate.scale);
+	remainingCrates--;
+}
+
+
+
+/*
+Name:	GetCrateSize()
+Params: int crateClass - The CRATE_CLASS_ of the crate.
+Return: int - The width and height of a crate of the class, as the atlas scales it.
+Description:
+	This method works out how big the crates of a class are, so structures can be laid out without the sprites.
+*/
+int UFRLevelGenerator::GetCrateSize(int crateClass)
+{
+	return (int)(CRATE_SPRITE_SIZE * crateClasses[crateClass].scale);
+}
+
+
+
+/*
+Name:	NextRandom()
+Params: void
+Return: unsigned int - A random number of 24 bits.
+Description:
+	This method steps the random numbers of the generator.
+*/
+unsigned int UFRLevelGenerator::NextRandom()
+{
+	randomState = randomState * RANDOM_MULTIPLIER + RANDOM_INCREMENT;
+	return randomState >> RANDOM_SHIFT;
+}
+
+
+
+/*
+Name:	RandomBetween()
+Params:
+	int low - The smallest number to return.
+	int high - The largest number to return.
+Return: int - A random number from low to high.
+Description:
+	This method picks a random number in a range.
+*/
+int UFRLevelGenerator::RandomBetween(int low, int high)
+{
+	return low + (int)(NextRandom() % (unsigned int)(high - low + 1));
+}
@@ -0,0 +1,62 @@
+/*
+File:		UFRLevelGenerator.h
+Project:	Unhappy Flying Reptiles
+Author(s):	Jorge Ramirez
+Description:
+	This file contains the class definition for the UFRLevelGenerator class.
+*/
+
+#pragma once
+#include "UFRLevel.h"
+
+#define GENERATOR_MIN_CRATES 10
+#define GENERATOR_MAX_CRATES 1000000
+
+#define STRUCTURE_TOWER 0
+#define STRUCTURE_PYRAMID 1
+#define STRUCTURE_WALL 2
+#define STRUCTURE_PILE 3
+#define STRUCTURE_COUNT 4
+
+#define CRATE_CLASS_LIGHT 0
+#define CRATE_CLASS_NORMAL 1
+#define CRATE_CLASS_HEAVY 2
+#define CRATE_CLASS_COUNT 3
+
+
+/*
+Name: UFRLevelGenerator
+Description:
+	This class is designed to build stress levels far bigger than a level anyone would place by hand.
+	Towers, pyramids, walls and random piles of crates are laid out along the ground from left to right,
+	past the right of the screen for big levels, until there are as many crates as were asked for.
+	Every crate is light, normal or heavy, each class with its own scale, so a level of any size uses three sprites.
+	The layout only depends on the seed and the crate count. The generator has its own random numbers,
+	so it gives the same level on every system and does not disturb the random numbers of the game.
+	Nothing here depends on MFC.
+*/
+class UFRLevelGenerator
+{
+private:
+	unsigned int randomState;
+	UFRLevel* level;
+	int remainingCrates;
+
+	unsigned int NextRandom();
+	int RandomBetween(int low, int high);
+	void AddCrate(int crateClass, int left, int bottom);
+	int AddTower(int left);
+	int AddPyramid(int left);
+	int AddWall(int left);
+	int AddPile(int left);
+
+	static int GetCrateSize(int crateClass);
+
+	UFRLevelGenerator(const UFRLevelGenerator&);
+	UFRLevelGenerator& operator=(const UFRLevelGenerator&);
+
+public:
+	UFRLevelGenerator(unsigned int seed);
+
+	int Generate(UFRLevel* output, int crateCount);
+};
@@ -7,46 +7,75 @@ Description:
 */
 
 #include "UFRMainWindow.h"
-
-#define DEFAULT_GAME_LOOP_TIMER_ID 1
-#define GAME_LOOP_INTERVAL 50
-#define DEFAULT_REDRAW_TIMER_ID 2
-#define REDRAW_INTERVAL 1000/60
+#include "UFRJitterStats.h"
+#include "UFRFramePacer.h"
+#include "UFRWaveOutOutput.h"
+#include <time.h>
+
+#define REDRAW_RATE 60
+#define MAX_CATCH_UP_TICKS 5 // The most ticks run back to back after a stall before the lost time is dropped
+#define MICROSECONDS_PER_MILLISECOND 1000
+#define MICROSECONDS_PER_SECOND 1000000
+#define PACER_SPIN_MARGIN 2000 // How long before a deadline the pacers stop sleeping and spin, in microseconds
+#define FILETIME_UNITS_PER_MILLISECOND 10000
+#define TRACE_FILE TEXT(".\\Trace.json")
+#define TRACE_KEY VK_F9
 
 // Map the window messages to methods.
 BEGIN_MESSAGE_MAP(UFRMainWindow, CFrameWnd)
 	ON_WM_PAINT()
 	ON_WM_ERASEBKGND()
-	ON_WM_TIMER()
 	ON_WM_CLOSE()
 	ON_WM_LBUTTONDOWN()
 	ON_WM_MOUSEMOVE()
+	ON_WM_KEYDOWN()
 END_MESSAGE_MAP()
 
 
 /*
 Name:	UFRMainWindow()
-Params: void
+Params:
+	const TCHAR* traceFile - The file F9 saves the trace to and that it is saved to on close, or NULL to save it to TRACE_FILE only on F9.
+	bool forbidAllocations - Whether game ticks and frames fail an assertion when they allocate once the game has warmed up.
+	const TCHAR* recordFile - The file the input of the game is recorded to, or NULL to not record it.
 Return: void
 Description:
 	This is the constructor for the UFRMainWindow class.
-	GDI+ is started here along with the window and the timers.
+	GDI+ is started here along with the window and the game threads.
 */
-UFRMainWindow::UFRMainWindow()
+UFRMainWindow::UFRMainWindow(const TCHAR* traceFile, bool forbidAllocations, const TCHAR* recordFile)
 {
+	UFRTrace::NameThread("UI");
+	traceOnClose = traceFile != NULL;
+	tracePath = traceFile != NULL ? traceFile : TRACE_FILE;
+
 	// Start GDI+
 	GdiplusStartup(&gdiplusToken, &gdiplusStartupInput, NULL);
 
 	// Create the window and window title
 	Create(NULL, TEXT("Unhappy Flying Reptiles"));
 
-	// Set the game and redraw timers
-	gameLoopTimerID = DEFAULT_GAME_LOOP_TIMER_ID;
-	gameLoopTimerID = SetTimer(gameLoopTimerID, GAME_LOOP_INTERVAL, NULL);
-	redrawTimerID = DEFAULT_REDRAW_TIMER_ID;
-	redrawTimerID = SetTimer(redrawTimerID, REDRAW_INTERVAL, NULL);
+	gameLogic = new UFRGame(time(NULL), new UFRWaveOutOutput(), &systemClock);
+	if (forbidAllocations)
+	{
+		gameLogic->ForbidSteadyAllocations();
+	}
+	if (recordFile != NULL)
+	{
+		if (inputRecording.Create(recordFile, gameLogic->GetSeed()))
+		{
+			gameLogic->RecordInput(&inputRecording);
+		}
+		else
+		{
+			TRACE(TEXT("Record: could not create %s\n"), recordFile);
+		}
+	}
 
-	gameLogic = new UFRGame();
+	// Start the simulation and render threads
+	running = true;
+	simulationThread = std::thread(&UFRMainWindow::SimulationLoop, this);
+	renderThread = std::thread(&UFRMainWindow::RenderLoop, this);
 }
 
 
@@ -57,10 +86,15 @@ Params: void
 Return: void
 Description:
 	This is the destructor for the UFRMainWindow class.
-	GDI+ is shut down here.
+	The input recording is finished once the simulation thread has stopped adding to it, and GDI+ is shut down here.
 */
 UFRMainWindow::~UFRMainWindow()
 {
+	StopThreads();
+	if (!inputRecording.Close())
+	{
+		TRACE(TEXT("Record: writing the input failed\n"));
+	}
 	delete gameLogic;
 
 	// Shutdown GDI+
@@ -75,18 +109,14 @@ Params: void
 Return: void
 Description:
 	This method is called by the window any time the paint message is received by the window.
-	The device context for the window is created here and the current game state is drawn.
+	The render thread redraws the whole window every frame, so the paint is only acknowledged here.
 */
 void UFRMainWindow::OnPaint()
 {
-	// Get device context, create Graphics object and find the dimensions of the window
-	CPaintDC dc(this);
-	Graphics canvas(dc.m_hDC);
-	CRect windowDimensions;
-	GetClientRect(windowDimensions);
+	UFRTraceZone paintZone("OnPaint");
 
-	// Draw the game onto the Grphics object
-	gameLogic->Draw(&canvas, &windowDimensions);
+	// Validate the window so the paint message is not sent again
+	CPaintDC dc(this);
 }
 
 
@@ -107,28 +137,210 @@ BOOL UFRMainWindow::OnEraseBkgnd(CDC* pDC)
 
 
 /*
-Name:	OnTimer()
-Params: 
-	UINT_PTR nIDEvent - The identifier for the timer event fired.
+Name:	SimulationLoop()
+Params: void
+Return: void
+Description:
+	This method runs on the simulation thread until the threads are stopped.
+	The thread is woken by a pacer on every tick deadline. The real time that passes is added to an accumulator
+	and a game tick is calculated for every game loop interval in it, so the game runs at a fixed rate
+	no matter how late the thread wakes up.
+	Whatever is left over is how far the renderer is into the next tick.
+*/
+void UFRMainWindow::SimulationLoop()
+{
+	UFRJitterStats tickStats(TEXT("Game tick"), GAME_LOOP_INTERVAL);
+	long long tickInterval = GAME_LOOP_INTERVAL * MICROSECONDS_PER_MILLISECOND;
+	UFRFramePacer pacer(&systemClock, tickInterval, PACER_SPIN_MARGIN);
+	long long lastTime;
+	long long now;
+	long long accumulator = 0; // In microseconds
+
+	UFRTrace::NameThread("Simulation");
+
+	// Create the game objects while the render thread shows the backdrop
+	gameLogic->FinishLoading();
+
+	pacer.Start();
+	lastTime = systemClock.Now();
+
+	while (running)
+	{
+		// Wait until the next tick is due
+		pacer.WaitForNextFrame();
+
+		now = systemClock.Now();
+		accumulator += now - lastTime;
+		lastTime = now;
+
+		// After a long stall, drop the time that can't be caught up on instead of ticking forever
+		if (accumulator > MAX_CATCH_UP_TICKS * tickInterval)
+		{
+			accumulator = MAX_CATCH_UP_TICKS * tickInterval;
+		}
+
+		// Calculate a new game state for every whole tick of time passed
+		while (accumulator >= tickInterval)
+		{
+			tickStats.Record();
+			// The tick takes the input up to the end of the time it covers
+			gameLogic->CalcGameState(now - accumulator + tickInterval);
+			accumulator -= tickInterval;
+		}
+	}
+
+	tickStats.Report();
+	ReportPacer(TEXT("Game tick"), &pacer);
+}
+
+
+
+/*
+Name:	RenderLoop()
+Params: void
+Return: void
+Description:
+	This method runs on the render thread and draws the latest game state to the window every redraw interval
+	until the threads are stopped.
+	How long after the process started the first frame and the first frame with sprites were shown is reported.
+*/
+void UFRMainWindow::RenderLoop()
+{
+	UFRJitterStats frameStats(TEXT("Frame"), 1000.0 / REDRAW_RATE);
+	UFRFramePacer pacer(&systemClock, MICROSECONDS_PER_SECOND / REDRAW_RATE, PACER_SPIN_MARGIN);
+	CRect windowDimensions;
+	HDC hdc;
+	bool firstFrameShown = false;
+	bool firstLoadedFrameShown = false;
+
+	UFRTrace::NameThread("Render");
+	pacer.Start();
+
+	while (running)
+	{
+		pacer.WaitForNextFrame();
+		frameStats.Record();
+		UFRTraceZone frameZone("Frame");
+
+		// Get device context, create Graphics object and find the dimensions of the window
+		::GetClientRect(m_hWnd, windowDimensions);
+		hdc = ::GetDC(m_hWnd);
+		{
+			Graphics canvas(hdc);
+
+			// Draw the game onto the Graphics object
+			gameLogic->Draw(&canvas, &windowDimensions);
+		}
+		::ReleaseDC(m_hWnd, hdc);
+
+		// Startup time, taken after the frame has gone to the window
+		if (!firstFrameShown)
+		{
+			TRACE(TEXT("Startup: first frame %.1f ms after process start\n"), GetTimeSinceProcessStart());
+			firstFrameShown = true;
+		}
+		if (!firstLoadedFrameShown && gameLogic->IsLoaded())
+		{
+			TRACE(TEXT("Startup: first frame with sprites %.1f ms after process start\n"), GetTimeSinceProcessStart());
+			firstLoadedFrameShown = true;
+		}
+	}
+
+	frameStats.Report();
+	ReportPacer(TEXT("Frame"), &pacer);
+}
+
+
+
+/*
+Name:	GetTimeSinceProcessStart()
+Params: void
+Return: double - The time since the process was created, in milliseconds.
+Description:
+	This method measures from the creation time the system keeps for the process, so the time spent
+	loading the executable and its libraries before any game code ran is included.
+*/
+double UFRMainWindow::GetTimeSinceProcessStart()
+{
+	FILETIME creationTime;
+	FILETIME exitTime;
+	FILETIME kernelTime;
+	FILETIME userTime;
+	FILETIME now;
+	ULARGE_INTEGER start;
+	ULARGE_INTEGER end;
+
+	GetProcessTimes(GetCurrentProcess(), &creationTime, &exitTime, &kernelTime, &userTime);
+	GetSystemTimeAsFileTime(&now);
+
+	start.LowPart = creationTime.dwLowDateTime;
+	start.HighPart = creationTime.dwHighDateTime;
+	end.LowPart = now.dwLowDateTime;
+	end.HighPart = now.dwHighDateTime;
+
+	return (double)(end.QuadPart - start.QuadPart) / FILETIME_UNITS_PER_MILLISECOND;
+}
+
+
+
+/*
+Name:	ReportPacer()
+Params:
+	const TCHAR* name - The name of the loop the pacer ran.
+	UFRFramePacer* pacer - The pacer to report on.
 Return: void
 Description:
-	This method exectutes every time a timer message is received.
+	This method writes the deadline statistics of a pacer to the debug output.
 */
-void UFRMainWindow::OnTimer(UINT_PTR nIDEvent)
+void UFRMainWindow::ReportPacer(const TCHAR* name, UFRFramePacer* pacer)
 {
-	if (nIDEvent == gameLoopTimerID)
+	TRACE(TEXT("%s pacer: %u frames, %u missed deadlines (%u skipped, %lld us worst), %.1f us average wake up error (%lld us worst)\n"),
+		name, pacer->GetFrameCount(), pacer->GetMissedCount(), pacer->GetSkippedCount(), pacer->GetMaxLateness(),
+		pacer->GetAverageWakeUpError(), pacer->GetMaxWakeUpError());
+}
+
+
+
+/*
+Name:	StopThreads()
+Params: void
+Return: void
+Description:
+	This method stops the simulation and render threads and waits for them to finish.
+*/
+void UFRMainWindow::StopThreads()
+{
+	running = false;
+
+	if (simulationThread.joinable())
 	{
-		// Calculate new game state
-		gameLogic->CalcGameState();
+		simulationThread.join();
 	}
-	if (nIDEvent == redrawTimerID)
+	if (renderThread.joinable())
 	{
-		// Redraw screen
-		Invalidate();
+		renderThread.join();
 	}
+}
+
 
-	// Call the handler for the base class
-	CFrameWnd::OnTimer(nIDEvent);
+
+/*
+Name:	WriteTrace()
+Params: void
+Return: void
+Description:
+	This method saves the trace of every thread to the trace file. The threads keep recording while it does.
+*/
+void UFRMainWindow::WriteTrace()
+{
+	if (UFRTrace::Write(tracePath))
+	{
+		TRACE(TEXT("Trace: saved to %s\n"), (const TCHAR*)tracePath);
+	}
+	else
+	{
+		TRACE(TEXT("Trace: could not save %s\n"), (const TCHAR*)tracePath);
+	}
 }
 
 
@@ -139,12 +351,16 @@ Params: void
 Return: void
 Description:
 	This method executes when the user exits the window.
-	The timers are shut down here.
+	The game threads are shut down here, before the window they draw to is destroyed.
+	The trace is saved once they have stopped when the trace file was given.
 */
 void UFRMainWindow::OnClose()
 {
-	KillTimer(gameLoopTimerID);
-	KillTimer(redrawTimerID);
+	StopThreads();
+	if (traceOnClose)
+	{
+		WriteTrace();
+	}
 
 	CFrameWnd::OnClose();
 }
@@ -152,9 +368,11 @@ void UFRMainWindow::OnClose()
 
 void UFRMainWindow::OnLButtonDown(UINT nFlags, CPoint point)
 {
+	// Time the click as soon as it arrives, so its latency covers the whole way to the screen and speakers
+	long long clickTime = systemClock.Now();
 	CRect windowDimensions;
 	GetClientRect(windowDimensions);
-	gameLogic->Click(point.x, point.y, &windowDimensions);
+	gameLogic->Click(point.x, point.y, &windowDimensions, clickTime);
 
 	CFrameWnd::OnLButtonDown(nFlags, point);
 }
@@ -162,9 +380,23 @@ void UFRMainWindow::OnLButtonDown(UINT nFlags, CPoint point)
 
 void UFRMainWindow::OnMouseMove(UINT nFlags, CPoint point)
 {
-	// Update Mouse position
-	gameLogic->mouseX = point.x;
-	gameLogic->mouseY = point.y;
+	// Time the move as soon as it arrives and send it to the simulation
+	long long moveTime = systemClock.Now();
+	CRect windowDimensions;
+	GetClientRect(windowDimensions);
+	gameLogic->MouseMove(point.x, point.y, &windowDimensions, moveTime);
 	
 	CFrameWnd::OnMouseMove(nFlags, point);
 }
+
+
+void UFRMainWindow::OnKeyDown(UINT nChar, UINT nRepCnt, UINT nFlags)
+{
+	// Save the trace straight away, while whatever hitch made someone press the key is still in the rings
+	if (nChar == TRACE_KEY)
+	{
+		WriteTrace();
+	}
+
+	CFrameWnd::OnKeyDown(nChar, nRepCnt, nFlags);
+}
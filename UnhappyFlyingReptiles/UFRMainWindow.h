@@ -9,7 +9,11 @@ Description:
 #pragma once
 #include "afxwin.h"
 #include <gdiplus.h>
+#include <thread>
+#include <atomic>
 #include "UFRGame.h"
+#include "UFRClock.h"
+#include "UFRFramePacer.h"
 
 using namespace Gdiplus;
 
@@ -18,8 +22,11 @@ using namespace Gdiplus;
 Name: UFRMainWindow
 Inherit: public CFrameWnd
 Description:
-	This class is designed to handle the window and game timer logic for the
+	This class is designed to handle the window and game thread logic for the
 	Unhappy Flying Reptiles game.
+	The game state is calculated on a simulation thread and drawn on a render thread,
+	so the UI thread only handles window messages.
+	F9 saves a trace of what every thread has been doing to the trace file.
 */
 class UFRMainWindow : public CFrameWnd
 {
@@ -27,20 +34,33 @@ private:
 	ULONG_PTR gdiplusToken;
 	GdiplusStartupInput gdiplusStartupInput;
 	UFRGame* gameLogic;
-	int gameLoopTimerID;
-	int redrawTimerID;
+
+	std::atomic<bool> running; // Cleared to stop the game threads
+	std::thread simulationThread;
+	std::thread renderThread;
+	UFRSystemClock systemClock; // Shared by the pacers of both threads and used to time clicks
+	CString tracePath;
+	bool traceOnClose; // Whether the trace is also saved when the window closes
+	UFRInputRecording inputRecording; // The input of the game, when it is recorded
+
+	void SimulationLoop();
+	void RenderLoop();
+	void ReportPacer(const TCHAR* name, UFRFramePacer* pacer);
+	double GetTimeSinceProcessStart();
+	void StopThreads();
+	void WriteTrace();
 
 protected:
 	afx_msg void OnPaint();
 	DECLARE_MESSAGE_MAP();
 
 public:
-	UFRMainWindow();
+	UFRMainWindow(const TCHAR* traceFile, bool forbidAllocations, const TCHAR* recordFile);
 	~UFRMainWindow();
 	afx_msg BOOL OnEraseBkgnd(CDC* pDC);
-	afx_msg void OnTimer(UINT_PTR nIDEvent);
 	afx_msg void OnClose();
 	afx_msg void OnLButtonDown(UINT nFlags, CPoint point);
 	afx_msg void OnMouseMove(UINT nFlags, CPoint point);
+	afx_msg void OnKeyDown(UINT nChar, UINT nRepCnt, UINT nFlags);
 };
 
@@ -0,0 +1,608 @@
+/*
+File:		UFRMixer.cpp
+Project:	Unhappy Flying Reptiles
+Author(s):	Jorge Ramirez
+Description:
+	This file contains the method definitions for the UFRMixer class.
+*/
+
+#include "UFRMixer.h"
+#include "UFRWaveFile.h"
+#include "UFRTrace.h"
+#include <string.h>
+
+#if defined(_M_IX86) || defined(_M_X64) || defined(__SSE__)
+#include <xmmintrin.h>
+#define MIXER_SSE
+#endif
+
+#define SSE_FLOATS 4
+
+
+/*
+Name:	UFRMixer()
+Params:
+	UFRAudioOutput* audioOutput - Where the mixed blocks go. It is opened here and must outlive the mixer.
+	UFRClock* clock - The clock input times are taken from, or NULL to not measure latency. It must outlive the mixer.
+Description:
+	Constructor for the UFRMixer class. No sound plays until Start or Render is called.
+*/
+UFRMixer::UFRMixer(UFRAudioOutput* audioOutput, UFRClock* clock)
+{
+	output = audioOutput;
+	outputOpen = output->Open(MIXER_SAMPLE_RATE, MIXER_CHANNELS);
+	running = false;
+
+	block.resize(MIXER_BLOCK_FRAMES * MIXER_CHANNELS);
+	voiceCount = 0;
+	pendingFrames = 0;
+
+	latencyClock = clock;
+	blockInputCount = 0;
+	lastInput = 0;
+
+	blocksMixed = 0;
+	voiceBlocksMixed = 0;
+	droppedVoices = 0;
+	stolenVoices = 0;
+	mergedVoices = 0;
+}
+
+
+
+/*
+Name:	~UFRMixer()
+Params: void
+Description:
+	Destructor for the UFRMixer class. The audio thread is stopped and the output is closed.
+*/
+UFRMixer::~UFRMixer()
+{
+	Stop();
+	output->Close();
+
+	for (int queue = 0; queue < queues.size(); queue++)
+	{
+		delete queues[queue];
+	}
+}
+
+
+
+/*
+Name:	AddSound()
+Params:
+	const float* samples - Interleaved samples at MIXER_SAMPLE_RATE. They are played where they are,
+		so they must stay valid for as long as the mixer.
+	int frameCount - The number of frames.
+	int channels - 1 or 2.
+	int priority - How much the sound matters when voices run out. Higher is more important.
+Return: int - The number of the sound, or -1 if it cannot be played.
+Description:
+	This method adds a sound that is already in the format of the mixer, such as one from the asset pack.
+	Sounds must all be added before the audio thread is started.
+*/
+int UFRMixer::AddSound(const float* samples, int frameCount, int channels, int priority)
+{
+	Sound sound;
+
+	if (samples == NULL || frameCount <= 0 || channels < 1 || channels > MIXER_CHANNELS)
+	{
+		return -1;
+	}
+
+	sound.samples = samples;
+	sound.frameCount = frameCount;
+	sound.channels = channels;
+	sound.priority = priority;
+	sounds.push_back(sound);
+
+	return (int)sounds.size() - 1;
+}
+
+
+
+/*
+Name:	LoadSound()
+Params:
+	const wchar_t* path - A WAV file.
+	int priority - How much the sound matters when voices run out. Higher is more important.
+Return: int - The number of the sound, or -1 if the file cannot be played.
+Description:
+	This method decodes a WAV file and resamples it to the mixer rate, so nothing is converted while mixing.
+	Sounds must all be loaded before the audio thread is started.
+*/
+int UFRMixer::LoadSound(const wchar_t* path, int priority)
+{
+	UFRWaveFile wave;
+
+	if (!wave.Load(path) || wave.GetChannels() > MIXER_CHANNELS)
+	{
+		return -1;
+	}
+	wave.Resample(MIXER_SAMPLE_RATE);
+
+	ownedSamples.push_back(wave.GetSamples());
+	if (ownedSamples.back().empty())
+	{
+		ownedSamples.pop_back();
+		return -1;
+	}
+
+	return AddSound(&ownedSamples.back()[0], wave.GetFrameCount(), wave.GetChannels(), priority);
+}
+
+
+
+/*
+Name:	CreateQueue()
+Params: void
+Return: UFRSoundQueue* - A queue for one thread to start and stop sounds with. It belongs to the mixer.
+Description:
+	This method adds a sound queue for a thread that triggers sounds. Queues must all be created before
+	the audio thread is started.
+*/
+UFRSoundQueue* UFRMixer::CreateQueue()
+{
+	queues.push_back(new UFRSoundQueue());
+	return queues.back();
+}
+
+
+
+/*
+Name:	GetDroppedCommands()
+Params: void
+Return: unsigned int - The number of commands that did not fit in their queue.
+Description:
+	This method adds up the commands dropped by every sound queue.
+*/
+unsigned int UFRMixer::GetDroppedCommands()
+{
+	unsigned int dropped = 0;
+
+	for (int queue = 0; queue < queues.size(); queue++)
+	{
+		dropped += queues[queue]->GetDroppedCommands();
+	}
+
+	return dropped;
+}
+
+
+
+/*
+Name:	Start()
+Params: void
+Return: void
+Description:
+	This method starts the audio thread for a real time output. The output paces the thread by blocking in Write.
+	Other outputs are fed by Render instead, so nothing is started for them.
+*/
+void UFRMixer::Start()
+{
+	if (running || !outputOpen || !output->IsRealTime())
+	{
+		return;
+	}
+
+	running = true;
+	mixThread = std::thread(&UFRMixer::MixLoop, this);
+}
+
+
+
+/*
+Name:	Stop()
+Params: void
+Return: void
+Description:
+	This method stops the audio thread once it has handed its current block to the output.
+*/
+void UFRMixer::Stop()
+{
+	running = false;
+	if (mixThread.joinable())
+	{
+		mixThread.join();
+	}
+}
+
+
+
+/*
+Name:	Render()
+Params: int frameCount - The number of frames of sound to produce.
+Return: void
+Description:
+	This method mixes sound for an output that is not real time, such as one game tick of a headless run.
+	Only whole blocks are mixed, and the rest is carried over to the next call so no time is lost.
+*/
+void UFRMixer::Render(int frameCount)
+{
+	if (!outputOpen)
+	{
+		return;
+	}
+
+	pendingFrames += frameCount;
+	while (pendingFrames >= MIXER_BLOCK_FRAMES)
+	{
+		MixBlock();
+		pendingFrames -= MIXER_BLOCK_FRAMES;
+	}
+}
+
+
+
+/*
+Name:	MixLoop()
+Params: void
+Return: void
+Description:
+	This method runs on the audio thread. It mixes blocks until the mixer stops or the output fails.
+*/
+void UFRMixer::MixLoop()
+{
+	UFRTrace::NameThread("Mixer");
+	while (running)
+	{
+		MixBlock();
+	}
+}
+
+
+
+/*
+Name:	MixBlock()
+Params: void
+Return: void
+Description:
+	This method runs the queued commands, adds every playing voice into the next block, clips it
+	and sends it to the output. Voices that reach the end of their sound are freed.
+*/
+void UFRMixer::MixBlock()
+{
+	float* mix = &block[0];
+	UFRTraceZone mixZone("MixBlock");
+
+	memset(mix, 0, block.size() * sizeof(float));
+	RunCommands();
+
+	for (int voice = 0; voice < voiceCount;)
+	{
+		Voice& playing = voices[voice];
+		const Sound& sound = sounds[playing.sound];
+		int frameCount = sound.frameCount - playing.position;
+
+		if (frameCount > MIXER_BLOCK_FRAMES)
+		{
+			frameCount = MIXER_BLOCK_FRAMES;
+		}
+
+		if (sound.channels == 1)
+		{
+			MixMono(mix, sound.samples + playing.position, frameCount, playing.volume);
+		}
+		else
+		{
+			MixStereo(mix, sound.samples + playing.position * MIXER_CHANNELS, frameCount, playing.volume);
+		}
+		playing.position += frameCount;
+		voiceBlocksMixed++;
+
+		// Free a finished voice by moving the last one into its place
+		if (playing.position >= sound.frameCount)
+		{
+			voices[voice] = voices[voiceCount - 1];
+			voiceCount--;
+		}
+		else
+		{
+			voice++;
+		}
+	}
+
+	Clip(mix, MIXER_BLOCK_FRAMES * MIXER_CHANNELS);
+	blocksMixed++;
+
+	// A real time output blocks here until the device has room
+	mixZone.Next("WriteSound");
+	if (!output->Write(mix, MIXER_BLOCK_FRAMES))
+	{
+		running = false;
+	}
+
+	RecordLatency();
+}
+
+
+
+/*
+Name:	RunCommands()
+Params: void
+Return: void
+Description:
+	This method takes every command off every sound queue and starts or stops voices.
+*/
+void UFRMixer::RunCommands()
+{
+	UFRSoundCommand command;
+
+	for (int queue = 0; queue < queues.size(); queue++)
+	{
+		while (queues[queue]->Pop(&command))
+		{
+			if (command.sound < 0 || command.sound >= sounds.size())
+			{
+				continue;
+			}
+
+			if (command.type == SOUND_COMMAND_PLAY)
+			{
+				// Inputs are only measured when their sound is actually going to be heard
+				if (StartVoice(command.sound, command.volume) && command.inputTime != 0 &&
+					blockInputCount < MIXER_COMMAND_CAPACITY)
+				{
+					blockInputs[blockInputCount] = command.inputTime;
+					blockInputCount++;
+				}
+			}
+			else if (command.type == SOUND_COMMAND_STOP)
+			{
+				StopVoices(command.sound);
+			}
+		}
+	}
+}
+
+
+
+/*
+Name:	StartVoice()
+Params:
+	int sound - The number of the sound.
+	float volume - The gain, where 1 plays the sound as it was recorded.
+Return: bool - Whether the sound is going to be heard, false if it was dropped.
+Description:
+	This method starts a new voice playing a sound from its beginning.
+	If the same sound started less than MIXER_MERGE_FRAMES ago, that voice is made louder instead.
+	When every voice is busy the new sound steals the least important voice, unless that voice matters more.
+*/
+bool UFRMixer::StartVoice(int sound, float volume)
+{
+	int voice;
+
+	for (voice = 0; voice < voiceCount; voice++)
+	{
+		if (voices[voice].sound == sound && voices[voice].position < MIXER_MERGE_FRAMES)
+		{
+			voices[voice].volume += volume;
+			if (voices[voice].volume > MIXER_MAX_VOLUME)
+			{
+				voices[voice].volume = MIXER_MAX_VOLUME;
+			}
+			mergedVoices++;
+			return true;
+		}
+	}
+
+	if (voiceCount < MIXER_VOICE_COUNT)
+	{
+		voice = voiceCount;
+		voiceCount++;
+	}
+	else
+	{
+		voice = FindVictim();
+		if (sounds[voices[voice].sound].priority > sounds[sound].priority)
+		{
+			droppedVoices++;
+			return false;
+		}
+		stolenVoices++;
+	}
+
+	voices[voice].sound = sound;
+	voices[voice].position = 0;
+	voices[voice].volume = volume;
+	return true;
+}
+
+
+
+/*
+Name:	RecordLatency()
+Params: void
+Return: void
+Description:
+	This method measures how long ago each input whose sound starts in the block that was just sent
+	to the output happened. An input that started several sounds is only measured once.
+*/
+void UFRMixer::RecordLatency()
+{
+	long long now;
+
+	if (blockInputCount == 0)
+	{
+		return;
+	}
+
+	if (latencyClock != NULL)
+	{
+		now = latencyClock->Now();
+		for (int input = 0; input < blockInputCount; input++)
+		{
+			if (blockInputs[input] != lastInput)
+			{
+				soundLatency.Record(now - blockInputs[input]);
+				lastInput = blockInputs[input];
+			}
+		}
+	}
+
+	blockInputCount = 0;
+}
+
+
+
+/*
+Name:	StopVoices()
+Params: int sound - The number of the sound.
+Return: void
+Description:
+	This method frees every voice playing a sound.
+*/
+void UFRMixer::StopVoices(int sound)
+{
+	for (int voice = 0; voice < voiceCount;)
+	{
+		if (voices[voice].sound == sound)
+		{
+			voices[voice] = voices[voiceCount - 1];
+			voiceCount--;
+		}
+		else
+		{
+			voice++;
+		}
+	}
+}
+
+
+
+/*
+Name:	FindVictim()
+Params: void
+Return: int - The voice to give up when a new sound needs one.
+Description:
+	This method picks the voice that matters least: the lowest priority, then the quietest,
+	then the one that has played the most of its sound.
+*/
+int UFRMixer::FindVictim()
+{
+	int victim = 0;
+
+	for (int voice = 1; voice < voiceCount; voice++)
+	{
+		int priority = sounds[voices[voice].sound].priority;
+		int victimPriority = sounds[voices[victim].sound].priority;
+
+		if (priority < victimPriority ||
+			(priority == victimPriority && voices[voice].volume < voices[victim].volume) ||
+			(priority == victimPriority && voices[voice].volume == voices[victim].volume && voices[voice].position > voices[victim].position))
+		{
+			victim = voice;
+		}
+	}
+
+	return victim;
+}
+
+
+
+/*
+Name:	MixMono()
+Params:
+	float* mix - The stereo block to add to.
+	const float* samples - Mono samples.
+	int frameCount - The number of frames to add.
+	float volume - The gain of the voice.
+Return: void
+Description:
+	This method adds a mono voice to both channels of the block, four frames at a time.
+*/
+void UFRMixer::MixMono(float* mix, const float* samples, int frameCount, float volume)
+{
+	int frame = 0;
+
+#ifdef MIXER_SSE
+	__m128 gain = _mm_set1_ps(volume);
+	for (; frame + SSE_FLOATS <= frameCount; frame += SSE_FLOATS)
+	{
+		__m128 mono = _mm_mul_ps(_mm_loadu_ps(samples + frame), gain);
+		float* out = mix + frame * MIXER_CHANNELS;
+
+		// Each mono sample goes to the left and right sample of its frame
+		_mm_storeu_ps(out, _mm_add_ps(_mm_loadu_ps(out), _mm_unpacklo_ps(mono, mono)));
+		_mm_storeu_ps(out + SSE_FLOATS, _mm_add_ps(_mm_loadu_ps(out + SSE_FLOATS), _mm_unpackhi_ps(mono, mono)));
+	}
+#endif
+
+	for (; frame < frameCount; frame++)
+	{
+		float sample = samples[frame] * volume;
+		mix[frame * MIXER_CHANNELS] += sample;
+		mix[frame * MIXER_CHANNELS + 1] += sample;
+	}
+}
+
+
+
+/*
+Name:	MixStereo()
+Params:
+	float* mix - The stereo block to add to.
+	const float* samples - Interleaved stereo samples.
+	int frameCount - The number of frames to add.
+	float volume - The gain of the voice.
+Return: void
+Description:
+	This method adds a stereo voice to the block, four samples at a time.
+*/
+void UFRMixer::MixStereo(float* mix, const float* samples, int frameCount, float volume)
+{
+	int sampleCount = frameCount * MIXER_CHANNELS;
+	int sample = 0;
+
+#ifdef MIXER_SSE
+	__m128 gain = _mm_set1_ps(volume);
+	for (; sample + SSE_FLOATS <= sampleCount; sample += SSE_FLOATS)
+	{
+		_mm_storeu_ps(mix + sample, _mm_add_ps(_mm_loadu_ps(mix + sample), _mm_mul_ps(_mm_loadu_ps(samples + sample), gain)));
+	}
+#endif
+
+	for (; sample < sampleCount; sample++)
+	{
+		mix[sample] += samples[sample] * volume;
+	}
+}
+
+
+
+/*
+Name:	Clip()
+Params:
+	float* mix - The finished block.
+	int sampleCount - The number of samples in the block.
+Return: void
+Description:
+	This method limits every sample to the range from -1 to 1, so loud overlapping voices clip instead of wrapping
+	when the output converts them to integers.
+*/
+void UFRMixer::Clip(float* mix, int sampleCount)
+{
+	int sample = 0;
+
+#ifdef MIXER_SSE
+	__m128 lowest = _mm_set1_ps(-1.0f);
+	__m128 highest = _mm_set1_ps(1.0f);
+	for (; sample + SSE_FLOATS <= sampleCount; sample += SSE_FLOATS)
+	{
+		_mm_storeu_ps(mix + sample, _mm_min_ps(_mm_max_ps(_mm_loadu_ps(mix + sample), lowest), highest));
+	}
+#endif
+
+	for (; sample < sampleCount; sample++)
+	{
+		if (mix[sample] < -1.0f)
+		{
+			mix[sample] = -1.0f;
+		}
+		else if (mix[sample] > 1.0f)
+		{
+			mix[sample] = 1.0f;
+		}
+	}
+}
@@ -0,0 +1,182 @@
+/*
+File:		UFRMixer.h
+Project:	Unhappy Flying Reptiles
+Author(s):	Jorge Ramirez
+Description:
+	This file contains the class definition for the UFRMixer class.
+*/
+
+#pragma once
+#include <vector>
+#include <list>
+#include <thread>
+#include <atomic>
+#include "UFRAudioOutput.h"
+#include "UFRSpscQueue.h"
+#include "UFRClock.h"
+#include "UFRLatencyStats.h"
+
+#define MIXER_SAMPLE_RATE 48000
+#define MIXER_CHANNELS 2
+#define MIXER_BLOCK_FRAMES 256 // About 5 ms at the mixer rate
+#define MIXER_VOICE_COUNT 16
+#define MIXER_COMMAND_CAPACITY 64 // Commands one thread can queue between two blocks
+#define MIXER_MERGE_FRAMES 2400 // Triggers of a sound within one 50 ms game tick play as one voice
+#define MIXER_MAX_VOLUME 2.0f // The loudest merged triggers can make a voice
+
+#define SOUND_COMMAND_PLAY 0
+#define SOUND_COMMAND_STOP 1
+
+
+/*
+Name: UFRSoundCommand
+Description:
+	A request from the game to the mixer to start or stop a sound.
+*/
+struct UFRSoundCommand
+{
+	int type;
+	int sound;
+	float volume;
+	long long inputTime; // The clock time of the input that caused the command, or 0 if it was not an input
+};
+
+
+/*
+Name: UFRSoundQueue
+Description:
+	This class is designed to let one game thread trigger sounds without ever taking a lock or allocating.
+	Commands go into a fixed lock free ring that the mixer drains before every block.
+	Each thread that triggers sounds needs its own queue. A command that does not fit is dropped and counted.
+*/
+class UFRSoundQueue
+{
+private:
+	UFRSpscQueue<UFRSoundCommand, MIXER_COMMAND_CAPACITY> commands;
+	std::atomic<unsigned int> droppedCommands;
+
+	UFRSoundQueue(const UFRSoundQueue&);
+	UFRSoundQueue& operator=(const UFRSoundQueue&);
+
+public:
+	UFRSoundQueue() : droppedCommands(0) {}
+
+	// Producer thread
+	void Play(int sound, float volume) { Send(SOUND_COMMAND_PLAY, sound, volume, 0); }
+	void Play(int sound, float volume, long long inputTime) { Send(SOUND_COMMAND_PLAY, sound, volume, inputTime); }
+	void Stop(int sound) { Send(SOUND_COMMAND_STOP, sound, 0, 0); }
+	void Send(int type, int sound, float volume, long long inputTime)
+	{
+		UFRSoundCommand command;
+		command.type = type;
+		command.sound = sound;
+		command.volume = volume;
+		command.inputTime = inputTime;
+		if (!commands.Push(command))
+		{
+			droppedCommands.fetch_add(1, std::memory_order_relaxed);
+		}
+	}
+
+	// Mixer
+	bool Pop(UFRSoundCommand* command) { return commands.Pop(command); }
+	unsigned int GetDroppedCommands() { return droppedCommands.load(std::memory_order_relaxed); }
+};
+
+
+/*
+Name: UFRMixer
+Description:
+	This class is designed to play the game sounds without a sound library.
+	Every sound is decoded up front to float samples at MIXER_SAMPLE_RATE, mono or stereo, and playing voices are
+	added together in blocks of MIXER_BLOCK_FRAMES stereo frames using SSE where the processor has it.
+	Finished blocks go to an output. A real time output is fed by the audio thread started with Start,
+	any other output is fed a given number of frames at a time by Render, on the thread that calls it.
+	The game starts and stops sounds through sound queues, which are drained by whichever thread mixes,
+	so the voices are only ever touched by that one thread.
+	There is a fixed pool of MIXER_VOICE_COUNT voices, so mixing costs the same however many sounds are triggered.
+	A sound triggered again while it has only just started makes its voice louder instead of taking another.
+	When every voice is busy, a new sound takes the voice of the least important one playing,
+	or is dropped if every playing sound matters more.
+	Given a clock, the mixer measures how long after an input its sound was handed to the output,
+	for the first block that contains it.
+	Nothing here depends on MFC, so the mixer also runs headless on other systems.
+*/
+class UFRMixer
+{
+private:
+	struct Sound
+	{
+		const float* samples;
+		int frameCount;
+		int channels;
+		int priority; // Higher priority sounds take voices from lower ones
+	};
+
+	struct Voice
+	{
+		int sound;
+		int position; // The next frame to play
+		float volume;
+	};
+
+	std::vector<Sound> sounds;
+	std::list<std::vector<float> > ownedSamples; // Sounds decoded by the mixer itself
+	std::vector<float> block;
+	std::vector<UFRSoundQueue*> queues;
+
+	UFRAudioOutput* output;
+	bool outputOpen;
+	std::thread mixThread;
+	std::atomic<bool> running;
+
+	Voice voices[MIXER_VOICE_COUNT]; // Only touched by the thread that mixes
+	int voiceCount;
+
+	UFRClock* latencyClock; // NULL when latency is not measured
+	UFRLatencyStats soundLatency;
+	long long blockInputs[MIXER_COMMAND_CAPACITY]; // Inputs whose sounds start in the block being mixed
+	int blockInputCount;
+	long long lastInput; // The last input measured, so an input that plays several sounds counts once
+	int pendingFrames; // Frames asked for by Render that do not fill a whole block yet
+
+	unsigned long long blocksMixed;
+	unsigned long long voiceBlocksMixed;
+	unsigned int droppedVoices;
+	unsigned int stolenVoices;
+	unsigned int mergedVoices;
+
+	void MixBlock();
+	void RunCommands();
+	bool StartVoice(int sound, float volume);
+	void RecordLatency();
+	void StopVoices(int sound);
+	int FindVictim();
+	void MixLoop();
+	static void MixMono(float* mix, const float* samples, int frameCount, float volume);
+	static void MixStereo(float* mix, const float* samples, int frameCount, float volume);
+	static void Clip(float* mix, int sampleCount);
+
+	UFRMixer(const UFRMixer&);
+	UFRMixer& operator=(const UFRMixer&);
+
+public:
+	UFRMixer(UFRAudioOutput* audioOutput, UFRClock* clock);
+	~UFRMixer();
+
+	int AddSound(const float* samples, int frameCount, int channels, int priority);
+	int LoadSound(const wchar_t* path, int priority);
+
+	UFRSoundQueue* CreateQueue();
+	void Start();
+	void Stop();
+	void Render(int frameCount);
+
+	unsigned long long GetBlocksMixed() { return blocksMixed; }
+	unsigned long long GetVoiceBlocksMixed() { return voiceBlocksMixed; }
+	unsigned int GetDroppedVoices() { return droppedVoices; }
+	unsigned int GetStolenVoices() { return stolenVoices; }
+	unsigned int GetMergedVoices() { return mergedVoices; }
+	unsigned int GetDroppedCommands();
+	UFRLatencyStats* GetSoundLatency() { return &soundLatency; }
+};
@@ -0,0 +1,250 @@
+/*
+File:		UFRPackCooker.cpp
+Project:	Unhappy Flying Reptiles
+Author(s):	Jorge Ramirez
+Description:
+	This file contains the method definitions for the UFRPackCooker class.
+*/
+
+#include "UFRPackCooker.h"
+#include "UFRWaveFile.h"
+#include <string.h>
+#include <string>
+
+#define BYTES_PER_PIXEL 4
+
+
+/*
+Name:	UFRPackCooker()
+Params: void
+Description:
+	Constructor for the UFRPackCooker class.
+*/
+UFRPackCooker::UFRPackCooker()
+{
+	packFile = NULL;
+}
+
+
+
+/*
+Name:	Cook()
+Params:
+	const wchar_t* path - The pack file to write.
+	UFRGame* game - A game loaded from the source files, with its loading finished.
+Return: bool - Whether every asset was written.
+Description:
+	This method writes the header, every asset and then the index, and finally fills in the header
+	with where the index is.
+*/
+bool UFRPackCooker::Cook(const wchar_t* path, UFRGame* game)
+{
+	UFRPackHeader header;
+	std::vector<std::string> soundFiles;
+	bool cooked;
+
+	entries.clear();
+	packFile = _wfopen(path, TEXT("wb"));
+	if (packFile == NULL)
+	{
+		return false;
+	}
+
+	memset(&header, 0, sizeof(header));
+	memcpy(header.magic, PACK_MAGIC, sizeof(header.magic));
+	header.version = PACK_VERSION;
+	cooked = fwrite(&header, sizeof(header), 1, packFile) == 1;
+
+	cooked = cooked && CookImage(PACK_BACKDROP, game->GetBackdrop());
+	cooked = cooked && CookAtlas(PACK_ATLAS, game->GetAtlas());
+
+	UFRGame::ListSoundFiles(soundFiles);
+	for (int sound = 0; sound < soundFiles.size() && cooked; sound++)
+	{
+		cooked = CookSound(soundFiles[sound].c_str());
+	}
+
+	// The index goes last, once every offset is known
+	cooked = cooked && Align();
+	if (cooked)
+	{
+		header.entryCount = (int)entries.size();
+		header.indexOffset = (unsigned long long)ftell(packFile);
+		cooked = fwrite(&entries[0], sizeof(UFRPackEntry), entries.size(), packFile) == entries.size();
+	}
+	cooked = cooked && fseek(packFile, 0, SEEK_SET) == 0 && fwrite(&header, sizeof(header), 1, packFile) == 1;
+
+	cooked = fclose(packFile) == 0 && cooked;
+	packFile = NULL;
+
+	return cooked;
+}
+
+
+
+/*
+Name:	BeginEntry()
+Params:
+	const char* name - The name the asset is looked up by.
+	int type - One of the PACK_ENTRY types.
+	UFRPackEntry* entry - Set up for the asset, with its offset.
+Return: bool - Whether the padding before the asset was written.
+Description:
+	This method starts a new asset on the next page of the pack.
+*/
+bool UFRPackCooker::BeginEntry(const char* name, int type, UFRPackEntry* entry)
+{
+	memset(entry, 0, sizeof(UFRPackEntry));
+	strncpy(entry->name, name, PACK_NAME_LENGTH - 1);
+	entry->type = type;
+
+	if (!Align())
+	{
+		return false;
+	}
+
+	entry->offset = (unsigned long long)ftell(packFile);
+	return true;
+}
+
+
+
+/*
+Name:	EndEntry()
+Params: UFRPackEntry* entry - The asset that has been written.
+Return: bool - Whether the asset has any data.
+Description:
+	This method records the size of the asset just written and adds it to the index.
+*/
+bool UFRPackCooker::EndEntry(UFRPackEntry* entry)
+{
+	entry->size = (unsigned long long)ftell(packFile) - entry->offset;
+	if (entry->size == 0)
+	{
+		return false;
+	}
+
+	entries.push_back(*entry);
+	return true;
+}
+
+
+
+/*
+Name:	Align()
+Params: void
+Return: bool - Whether the padding was written.
+Description:
+	This method pads the pack with zeros up to the next multiple of PACK_ALIGNMENT.
+*/
+bool UFRPackCooker::Align()
+{
+	static const char padding[PACK_ALIGNMENT] = { 0 };
+	long remainder = ftell(packFile) % PACK_ALIGNMENT;
+
+	if (remainder == 0)
+	{
+		return true;
+	}
+
+	return fwrite(padding, 1, PACK_ALIGNMENT - remainder, packFile) == PACK_ALIGNMENT - remainder;
+}
+
+
+
+/*
+Name:	CookImage()
+Params:
+	const char* name - The name the image is looked up by.
+	Bitmap* image - The image to store.
+Return: bool - Whether the image was written.
+Description:
+	This method stores the pixels of an image as premultiplied ARGB, the format GDI+ draws fastest.
+*/
+bool UFRPackCooker::CookImage(const char* name, Bitmap* image)
+{
+	UFRPackEntry entry;
+	BitmapData pixels;
+	bool cooked;
+
+	if (image == NULL || !BeginEntry(name, PACK_ENTRY_IMAGE, &entry))
+	{
+		return false;
+	}
+
+	entry.width = image->GetWidth();
+	entry.height = image->GetHeight();
+
+	Rect imageRect(0, 0, entry.width, entry.height);
+	image->LockBits(&imageRect, ImageLockModeRead, PixelFormat32bppPARGB, &pixels);
+	cooked = true;
+	for (int row = 0; row < entry.height && cooked; row++)
+	{
+		cooked = fwrite((BYTE*)pixels.Scan0 + row * pixels.Stride, BYTES_PER_PIXEL, entry.width, packFile) == entry.width;
+	}
+	image->UnlockBits(&pixels);
+
+	return cooked && EndEntry(&entry);
+}
+
+
+
+/*
+Name:	CookAtlas()
+Params:
+	const char* name - The name the atlas is looked up by.
+	UFRSpriteAtlas* atlas - The atlas to store.
+Return: bool - Whether the atlas was written.
+Description:
+	This method stores a sprite atlas the same way it is baked to its own file.
+*/
+bool UFRPackCooker::CookAtlas(const char* name, UFRSpriteAtlas* atlas)
+{
+	UFRPackEntry entry;
+
+	if (!BeginEntry(name, PACK_ENTRY_ATLAS, &entry) || !atlas->Write(packFile))
+	{
+		return false;
+	}
+
+	return EndEntry(&entry);
+}
+
+
+
+/*
+Name:	CookSound()
+Params: const char* file - The WAV file of the sound, which is also the name it is looked up by.
+Return: bool - Whether the sound was read and written.
+Description:
+	This method stores a sound as interleaved float samples resampled to PACK_SAMPLE_RATE,
+	so the mixer plays it without converting it.
+*/
+bool UFRPackCooker::CookSound(const char* file)
+{
+	UFRPackEntry entry;
+	UFRWaveFile wave;
+	std::string narrowFile(file);
+	std::wstring wideFile(narrowFile.begin(), narrowFile.end());
+
+	if (!wave.Load(wideFile.c_str()))
+	{
+		TRACE(TEXT("Cook: could not read %S\n"), file);
+		return false;
+	}
+	wave.Resample(PACK_SAMPLE_RATE);
+
+	if (!BeginEntry(file, PACK_ENTRY_SOUND, &entry))
+	{
+		return false;
+	}
+	entry.channels = wave.GetChannels();
+	entry.sampleRate = wave.GetSampleRate();
+
+	if (fwrite(&wave.GetSamples()[0], sizeof(float), wave.GetSamples().size(), packFile) != wave.GetSamples().size())
+	{
+		return false;
+	}
+
+	return EndEntry(&entry);
+}
@@ -0,0 +1,49 @@
+/*
+File:		UFRPackCooker.h
+Project:	Unhappy Flying Reptiles
+Author(s):	Jorge Ramirez
+Description:
+	This file contains the class definition for the UFRPackCooker class.
+*/
+
+#pragma once
+#include "afxwin.h"
+#include <gdiplus.h>
+#include <stdio.h>
+#include <vector>
+#include "UFRAssetPack.h"
+#include "UFRGame.h"
+
+using namespace Gdiplus;
+
+
+/*
+Name: UFRPackCooker
+Description:
+	This class is designed to write the asset pack for the /cook build step.
+	Every asset is stored in the form the game uses it: the composited backdrop as PARGB pixels,
+	the packed sprite atlas, and the sounds as float samples at the rate of the mixer.
+	Each entry starts on its own page so it can be used where it is mapped.
+*/
+class UFRPackCooker
+{
+private:
+	FILE* packFile;
+	std::vector<UFRPackEntry> entries;
+
+	bool BeginEntry(const char* name, int type, UFRPackEntry* entry);
+	bool EndEntry(UFRPackEntry* entry);
+	bool Align();
+	bool CookImage(const char* name, Bitmap* image);
+	bool CookAtlas(const char* name, UFRSpriteAtlas* atlas);
+	bool CookSound(const char* file);
+
+	UFRPackCooker(const UFRPackCooker&);
+	UFRPackCooker& operator=(const UFRPackCooker&);
+
+public:
+	UFRPackCooker();
+
+	bool Cook(const wchar_t* path, UFRGame* game);
+	int GetEntryCount() { return (int)entries.size(); }
+};
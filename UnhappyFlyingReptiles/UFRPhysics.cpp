@@ -0,0 +1,356 @@
+/*
+File:		UFRPhysics.cpp
+Project:	Unhappy Flying Reptiles
+Author(s):	Jorge Ramirez
+Description:
+	This file contains the method definitions for the UFRPhysics class.
+*/
+
+#include "UFRPhysics.h"
+#include <stdlib.h>
+
+#define MOVING_COMPONENTS (COMPONENT_TRANSFORM | COMPONENT_VELOCITY | COMPONENT_BODY)
+
+typedef std::vector<int, UFRArenaAllocator<int> > ArenaInts; // Working space that only lasts for one call
+
+
+/*
+Name:	Move()
+Params:
+	UFRWorld* world - The entities to move.
+	unsigned int with - COMPONENT_ bits the entities must have as well as a transform, a velocity and a body.
+	unsigned int without - COMPONENT_ bits the entities must not have.
+Return: void
+Description:
+	This method calculates the changes in offset and velocity of every matching body after one interval of time.
+	Bodies that land stop falling on the ground. Bodies with friction slow down on the ground,
+	and in the air as well if their friction says so.
+*/
+void UFRPhysics::Move(UFRWorld* world, unsigned int with, unsigned int without)
+{
+	UFRArchetype* table;
+	bool hasFriction;
+
+	for (int archetype = 0; archetype < world->GetArchetypeCount(); archetype++)
+	{
+		table = world->GetArchetype(archetype);
+		if (!table->Matches(with | MOVING_COMPONENTS, without))
+		{
+			continue;
+		}
+
+		hasFriction = (table->components & COMPONENT_FRICTION) != 0;
+		for (int row = 0; row < table->GetSize(); row++)
+		{
+			UFRTransform& transform = table->transforms[row];
+			UFRVelocity& velocity = table->velocities[row];
+			UFRBody& body = table->bodies[row];
+
+			// Calculate movement
+			transform.left += velocity.x;
+			transform.bottom += velocity.y;
+
+			// Bodies can't ever be below 0 height
+			if (transform.bottom < 0)
+			{
+				transform.bottom = 0;
+			}
+
+			// Stop the vertical movement of a body that lands on the ground
+			if (transform.bottom == 0 && body.lands)
+			{
+				velocity.y = 0;
+			}
+
+			// Horizontal friction
+			if (hasFriction && (transform.bottom == 0 || table->frictions[row].inAir))
+			{
+				int friction = table->frictions[row].amount;
+
+				if (friction > abs(velocity.x))
+				{
+					// If friction would stop the velocity, set the velocity to 0
+					velocity.x = 0;
+				}
+				else if (velocity.x > 0)
+				{
+					velocity.x -= friction;
+				}
+				else if (velocity.x < 0)
+				{
+					velocity.x += friction;
+				}
+			}
+
+			// Apply gravity to vertical velocity if the body is off the ground
+			if (transform.bottom != 0)
+			{
+				velocity.y -= body.gravity;
+			}
+		}
+	}
+}
+
+
+
+/*
+Name:	DetectCollision()
+Params:
+	UFRWorld* world - The world the bodies are in.
+	int first - The entity of one body.
+	int second - The entity of the other body.
+Return: bool - Whether the bodies collided.
+Description:
+	This method calls the HandleCollision method if it detects that the two bodies have collided.
+	The collision is detected by checking the relative position of the bodies and comparing it to their size.
+*/
+bool UFRPhysics::DetectCollision(UFRWorld* world, int first, int second)
+{
+	UFRTransform& firstTransform = world->GetTransform(first);
+	UFRTransform& secondTransform = world->GetTransform(second);
+	UFRBody& firstBody = world->GetBody(first);
+	UFRBody& secondBody = world->GetBody(second);
+	int firstHalfWidth = firstBody.width / 2;
+	int firstHalfHeight = firstBody.height / 2;
+	int secondHalfWidth = secondBody.width / 2;
+	int secondHalfHeight = secondBody.height / 2;
+	int deltaXCenters = (firstTransform.left + firstHalfWidth) - (secondTransform.left + secondHalfWidth);
+	int deltaYCenters = (firstTransform.bottom + firstHalfHeight) - (secondTransform.bottom + secondHalfHeight);
+
+	// If the distance between the centers of the two bodies is smaller in magnitude than the distances from the center
+	// of each body to their corresponding edges added together, the bodies are in collision
+	if (abs(deltaXCenters) <= firstHalfWidth + secondHalfWidth &&
+		abs(deltaYCenters) <= firstHalfHeight + secondHalfHeight)
+	{
+		HandleCollision(world, first, second);
+		return true;
+	}
+
+	return false;
+}
+
+
+
+/*
+Name:	HandleCollision()
+Params:
+	UFRWorld* world - The world the bodies are in.
+	int first - The entity of one body.
+	int second - The entity of the other body.
+Return: void
+Description:
+	This method assumes that the two bodies have collided.
+	The relative positions of the bodies are calculated as well as their velocities and direction of impact.
+	The first body is moved out of the second, except when it is below it, then the second is moved onto it.
+	Each body moving towards the other gives up part of its force, which goes to the other body.
+*/
+void UFRPhysics::HandleCollision(UFRWorld* world, int first, int second)
+{
+	UFRTransform& firstTransform = world->GetTransform(first);
+	UFRTransform& secondTransform = world->GetTransform(second);
+	UFRVelocity& firstVelocity = world->GetVelocity(first);
+	UFRVelocity& secondVelocity = world->GetVelocity(second);
+	UFRBody& firstBody = world->GetBody(first);
+	UFRBody& secondBody = world->GetBody(second);
+	int forceOfFirst = 0;
+	int forceOfSecond = 0;
+	int deltaXCenters = (firstTransform.left + firstBody.width / 2) - (secondTransform.left + secondBody.width / 2);
+	int deltaYCenters = (firstTransform.bottom + firstBody.height / 2) - (secondTransform.bottom + secondBody.height / 2);
+
+	if (abs(deltaXCenters) >= abs(deltaYCenters)) // Collision happened from the side
+	{
+		if (deltaXCenters > 0) // The first body is to the right and the second is to the left
+		{
+			firstTransform.left = secondTransform.left + secondBody.width;
+
+			// Only a body moving towards the other gives up force
+			if (firstVelocity.x < 0)
+			{
+				forceOfFirst = CalcForce(firstVelocity.x, &firstBody);
+			}
+			if (secondVelocity.x > 0)
+			{
+				forceOfSecond = CalcForce(secondVelocity.x, &secondBody);
+			}
+		}
+		else // The first body is to the left and the second is to the right
+		{
+			firstTransform.left = secondTransform.left - firstBody.width;
+
+			if (firstVelocity.x > 0)
+			{
+				forceOfFirst = CalcForce(firstVelocity.x, &firstBody);
+			}
+			if (secondVelocity.x < 0)
+			{
+				forceOfSecond = CalcForce(secondVelocity.x, &secondBody);
+			}
+		}
+
+		// Each body gives up its force to the other
+		ApplyForce(&firstVelocity.x, -forceOfFirst, firstBody.weight);
+		ApplyForce(&secondVelocity.x, forceOfFirst, secondBody.weight);
+		ApplyForce(&secondVelocity.x, -forceOfSecond, secondBody.weight);
+		ApplyForce(&firstVelocity.x, forceOfSecond, firstBody.weight);
+	}
+	else // The collision happened from the top or bottom
+	{
+		if (deltaYCenters > 0) // The first body is above the second
+		{
+			firstTransform.bottom = secondTransform.bottom + secondBody.height;
+
+			if (firstVelocity.y < 0)
+			{
+				forceOfFirst = CalcForce(firstVelocity.y, &firstBody);
+			}
+			if (secondVelocity.y > 0)
+			{
+				forceOfSecond = CalcForce(secondVelocity.y, &secondBody);
+			}
+		}
+		else // The first body is below the second
+		{
+			secondTransform.bottom = firstTransform.bottom + firstBody.height;
+
+			if (firstVelocity.y > 0)
+			{
+				forceOfFirst = CalcForce(firstVelocity.y, &firstBody);
+			}
+			if (secondVelocity.y < 0)
+			{
+				forceOfSecond = CalcForce(secondVelocity.y, &secondBody);
+			}
+		}
+
+		ApplyForce(&firstVelocity.y, -forceOfFirst, firstBody.weight);
+		ApplyForce(&secondVelocity.y, forceOfFirst, secondBody.weight);
+		ApplyForce(&secondVelocity.y, -forceOfSecond, secondBody.weight);
+		ApplyForce(&firstVelocity.y, forceOfSecond, firstBody.weight);
+	}
+}
+
+
+
+/*
+Name:	ApplyForce()
+Params:
+	int* velocity - The horizontal or vertical velocity of a body.
+	int force - The amount and directionality of force to be applied, along the velocity.
+	int weight - The weight of the body.
+Return: void
+Description:
+	This method converts a force applied to a body into velocity based on the weight of the body.
+*/
+void UFRPhysics::ApplyForce(int* velocity, int force, int weight)
+{
+	*velocity += force / weight;
+}
+
+
+
+/*
+Name:	CalcForce()
+Params:
+	int velocity - The horizontal or vertical velocity of a body.
+	UFRBody* body - The body.
+Return: int - The amount of force to give.
+Description:
+	This method calculates the amount of force that a body can give up on impact.
+	The calculation is based on the velocity, the weight of the body and the percentage of its force
+	the body gives up on impact.
+*/
+int UFRPhysics::CalcForce(int velocity, UFRBody* body)
+{
+	return (int)((velocity * body->weight) * (1 - body->forceGiven));
+}
+
+
+
+/*
+Name:	FindIslands()
+Params:
+	const std::vector<UFRBodyPair>& pairs - The pairs of bodies that can touch, by their number in the broadphase.
+	int bodyCount - The number of bodies in the broadphase.
+	std::vector<int>& islandPairs - Set to the pair numbers grouped by island, in their order within each island.
+	std::vector<int>& islandStarts - Set to where each island starts in islandPairs, with one more entry for the end.
+	UFRFrameArena* arena - The arena of the calling thread for the working space, or NULL to use the heap.
+Return: int - The number of islands.
+Description:
+	This method groups the pairs into islands of bodies that are joined through pairs, with a union find.
+	No body is in two islands, so islands can be resolved at the same time and in any order,
+	and each gives the same result as resolving every pair in order on one thread.
+*/
+int UFRPhysics::FindIslands(const std::vector<UFRBodyPair>& pairs, int bodyCount, std::vector<int>& islandPairs, std::vector<int>& islandStarts, UFRFrameArena* arena)
+{
+	UFRArenaAllocator<int> allocator(arena);
+	ArenaInts parents(bodyCount, 0, allocator);
+	ArenaInts islandOfRoot(bodyCount, -1, allocator);
+	ArenaInts islandOfPair(pairs.size(), 0, allocator);
+	int islandCount = 0;
+	int first;
+	int second;
+
+	for (int body = 0; body < bodyCount; body++)
+	{
+		parents[body] = body;
+	}
+
+	// Join the bodies of every pair, halving the paths on the way up
+	for (int pair = 0; pair < pairs.size(); pair++)
+	{
+		first = pairs[pair].first;
+		second = pairs[pair].second;
+		while (parents[first] != first)
+		{
+			parents[first] = parents[parents[first]];
+			first = parents[first];
+		}
+		while (parents[second] != second)
+		{
+			parents[second] = parents[parents[second]];
+			second = parents[second];
+		}
+		if (first != second)
+		{
+			parents[second] = first;
+		}
+	}
+
+	// Number the islands in the order their first pair comes
+	for (int pair = 0; pair < pairs.size(); pair++)
+	{
+		first = pairs[pair].first;
+		while (parents[first] != first)
+		{
+			first = parents[first];
+		}
+		if (islandOfRoot[first] == -1)
+		{
+			islandOfRoot[first] = islandCount++;
+		}
+		islandOfPair[pair] = islandOfRoot[first];
+	}
+
+	// Sort the pairs by island, keeping their order within it
+	islandStarts.assign(islandCount + 1, 0);
+	for (int pair = 0; pair < pairs.size(); pair++)
+	{
+		islandStarts[islandOfPair[pair] + 1]++;
+	}
+	for (int island = 0; island < islandCount; island++)
+	{
+		islandStarts[island + 1] += islandStarts[island];
+	}
+	islandPairs.resize(pairs.size());
+	for (int pair = 0; pair < pairs.size(); pair++)
+	{
+		islandPairs[islandStarts[islandOfPair[pair]]++] = pair;
+	}
+	for (int island = islandCount; island > 0; island--)
+	{
+		islandStarts[island] = islandStarts[island - 1];
+	}
+	islandStarts[0] = 0;
+
+	return islandCount;
+}
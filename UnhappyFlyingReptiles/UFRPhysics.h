@@ -0,0 +1,36 @@
+/*
+File:		UFRPhysics.h
+Project:	Unhappy Flying Reptiles
+Author(s):	Jorge Ramirez
+Description:
+	This file contains the class definition for the UFRPhysics class.
+*/
+
+#pragma once
+#include <vector>
+#include "UFRWorld.h"
+#include "UFRBroadphase.h"
+#include "UFRFrameArena.h"
+
+
+/*
+Name: UFRPhysics
+Description:
+	This class is designed to move every body and resolve the collisions between them, whatever else they are.
+	Bodies move by their velocity, stay above the ground, slow down by their friction and fall by their gravity.
+	Colliding bodies are pushed apart and trade the part of their force they give up on impact, in proportion to their weights.
+	Bodies that can touch are split into islands that share no body, so each island can be resolved on its own thread.
+	Nothing here depends on MFC.
+*/
+class UFRPhysics
+{
+private:
+	static void ApplyForce(int* velocity, int force, int weight);
+	static int CalcForce(int velocity, UFRBody* body);
+
+public:
+	static void Move(UFRWorld* world, unsigned int with, unsigned int without);
+	static bool DetectCollision(UFRWorld* world, int first, int second);
+	static void HandleCollision(UFRWorld* world, int first, int second);
+	static int FindIslands(const std::vector<UFRBodyPair>& pairs, int bodyCount, std::vector<int>& islandPairs, std::vector<int>& islandStarts, UFRFrameArena* arena);
+};
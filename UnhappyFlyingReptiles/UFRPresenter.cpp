@@ -0,0 +1,328 @@
+/*
+File:		UFRPresenter.cpp
+Project:	Unhappy Flying Reptiles
+Author(s):	Jorge Ramirez
+Description:
+	This file contains the method definitions for the UFRPresenter class.
+*/
+
+#include "UFRPresenter.h"
+#include "UFRAllocations.h"
+
+#define BYTES_PER_PIXEL 4
+#define MAX_INTEGER_SCALE 4
+#define MIN_INTEGER_SCALE 2
+#define MAX_LETTERBOX_RATIO 0.1 // The largest share of each window axis that may be left as border in integer mode
+#define MICROSECONDS_PER_SECOND 1000000.0
+
+
+/*
+Name:	UFRPresenter()
+Params:
+	int width - The width of the images that will be presented.
+	int height - The height of the images that will be presented.
+	UFRJobSystem* jobs - The job system that scales the image. It is not owned by the presenter.
+Description:
+	Constructor for the UFRPresenter class.
+	The DIB headers are set up here; the layout is calculated on the first present.
+*/
+UFRPresenter::UFRPresenter(int width, int height, UFRJobSystem* jobs) : scaler(width, height, jobs)
+{
+	imageWidth = width;
+	imageHeight = height;
+
+	windowWidth = 0;
+	windowHeight = 0;
+	presentMode = PRESENT_MODE_COPY;
+	integerScale = 1;
+	destLeft = 0;
+	destTop = 0;
+	destWidth = width;
+	destHeight = height;
+
+	// Top-down 32 bit DIB matching the game image
+	ZeroMemory(&imageInfo, sizeof(imageInfo));
+	imageInfo.bmiHeader.biSize = sizeof(BITMAPINFOHEADER);
+	imageInfo.bmiHeader.biWidth = imageWidth;
+	imageInfo.bmiHeader.biHeight = -imageHeight;
+	imageInfo.bmiHeader.biPlanes = 1;
+	imageInfo.bmiHeader.biBitCount = BYTES_PER_PIXEL * 8;
+	imageInfo.bmiHeader.biCompression = BI_RGB;
+	scaledInfo = imageInfo;
+
+	QueryPerformanceFrequency(&counterFrequency);
+	for (int mode = 0; mode < PRESENT_MODE_COUNT; mode++)
+	{
+		presentTicks[mode] = 0;
+		presentCount[mode] = 0;
+	}
+}
+
+
+
+/*
+Name:	CalcLayout()
+Params:
+	int width - The width of the window client area.
+	int height - The height of the window client area.
+	int* mode - Receives the present mode for the window size.
+	int* scale - Receives the integer scale, 1 if the mode is not integer.
+	int* left - Receives the left of the presented image in the window.
+	int* top - Receives the top of the presented image in the window.
+	int* scaledWidth - Receives the width of the presented image.
+	int* scaledHeight - Receives the height of the presented image.
+Return: void
+Description:
+	This method picks the present mode for a window size and where the image is placed in the window.
+	It does not change the presenter, so it can be called from any thread.
+*/
+void UFRPresenter::CalcLayout(int width, int height, int* mode, int* scale, int* left, int* top, int* scaledWidth, int* scaledHeight) const
+{
+	if (width == imageWidth && height == imageHeight)
+	{
+		*mode = PRESENT_MODE_COPY;
+		*scale = 1;
+		*scaledWidth = imageWidth;
+		*scaledHeight = imageHeight;
+	}
+	else
+	{
+		// Find the largest integer scale that fits and does not leave too much of the window as border
+		*scale = 1;
+		for (int candidate = MAX_INTEGER_SCALE; candidate >= MIN_INTEGER_SCALE && *scale == 1; candidate--)
+		{
+			int borderX = width - imageWidth * candidate;
+			int borderY = height - imageHeight * candidate;
+
+			if (borderX >= 0 && borderY >= 0 &&
+				borderX <= width * MAX_LETTERBOX_RATIO && borderY <= height * MAX_LETTERBOX_RATIO)
+			{
+				*scale = candidate;
+			}
+		}
+
+		if (*scale > 1)
+		{
+			*mode = PRESENT_MODE_INTEGER;
+			*scaledWidth = imageWidth * *scale;
+			*scaledHeight = imageHeight * *scale;
+		}
+		else
+		{
+			*mode = PRESENT_MODE_STRETCH;
+			*scaledWidth = width;
+			*scaledHeight = height;
+		}
+	}
+
+	// Center the image in the window
+	*left = (width - *scaledWidth) / 2;
+	*top = (height - *scaledHeight) / 2;
+}
+
+
+
+/*
+Name:	UpdateLayout()
+Params:
+	int newWindowWidth - The width of the window client area.
+	int newWindowHeight - The height of the window client area.
+Return: void
+Description:
+	This method updates the layout for a window size and rebuilds the scaler tables.
+	Nothing is done if the window size has not changed since the last call.
+	Resizing is not steady play, so the tables may grow even while the render thread forbids allocations.
+*/
+void UFRPresenter::UpdateLayout(int newWindowWidth, int newWindowHeight)
+{
+	bool allocationsForbidden = UFRAllocations::IsForbidden();
+
+	if (newWindowWidth == windowWidth && newWindowHeight == windowHeight)
+	{
+		return;
+	}
+
+	UFRAllocations::Forbid(false);
+
+	windowWidth = newWindowWidth;
+	windowHeight = newWindowHeight;
+	CalcLayout(windowWidth, windowHeight, &presentMode, &integerScale, &destLeft, &destTop, &destWidth, &destHeight);
+
+	if (presentMode != PRESENT_MODE_COPY)
+	{
+		scaler.SetSize(destWidth, destHeight, integerScale);
+	}
+	scaledInfo.bmiHeader.biWidth = destWidth;
+	scaledInfo.bmiHeader.biHeight = -destHeight;
+
+	UFRAllocations::Forbid(allocationsForbidden);
+}
+
+
+
+/*
+Name:	FillLetterbox()
+Params:
+	HDC hdc - The device context of the window.
+Return: void
+Description:
+	This method paints the parts of the window around the presented image black.
+*/
+void UFRPresenter::FillLetterbox(HDC hdc)
+{
+	HBRUSH brush = (HBRUSH)GetStockObject(BLACK_BRUSH);
+	RECT border;
+
+	// Top and bottom
+	border.left = 0;
+	border.right = windowWidth;
+	border.top = 0;
+	border.bottom = destTop;
+	FillRect(hdc, &border, brush);
+	border.top = destTop + destHeight;
+	border.bottom = windowHeight;
+	FillRect(hdc, &border, brush);
+
+	// Left and right
+	border.top = destTop;
+	border.bottom = destTop + destHeight;
+	border.left = 0;
+	border.right = destLeft;
+	FillRect(hdc, &border, brush);
+	border.left = destLeft + destWidth;
+	border.right = windowWidth;
+	FillRect(hdc, &border, brush);
+}
+
+
+
+/*
+Name:	Present()
+Params:
+	Graphics* canvas - The Graphics object of the window.
+	Bitmap* image - The finished game image. It must be the size given to the constructor.
+	CRect* dimensions - The dimensions of the window.
+Return: void
+Description:
+	This method copies the game image onto the window with the present mode that suits the window size.
+	The time taken is added to the cost of that mode.
+*/
+void UFRPresenter::Present(Graphics* canvas, Bitmap* image, CRect* dimensions)
+{
+	LARGE_INTEGER startTime;
+	LARGE_INTEGER endTime;
+	Rect imageDimensions(0, 0, imageWidth, imageHeight);
+	BitmapData imageData;
+	HDC hdc;
+
+	QueryPerformanceCounter(&startTime);
+
+	UpdateLayout(dimensions->Width(), dimensions->Height());
+
+	if (windowWidth <= 0 || windowHeight <= 0)
+	{
+		return;
+	}
+
+	image->LockBits(&imageDimensions, ImageLockModeRead, PixelFormat32bppARGB, &imageData);
+	hdc = canvas->GetHDC();
+
+	if (presentMode == PRESENT_MODE_COPY)
+	{
+		SetDIBitsToDevice(hdc, 0, 0, imageWidth, imageHeight, 0, 0, 0, imageHeight,
+			imageData.Scan0, &imageInfo, DIB_RGB_COLORS);
+	}
+	else
+	{
+		scaler.Scale((const unsigned int*)imageData.Scan0, imageData.Stride);
+
+		SetDIBitsToDevice(hdc, destLeft, destTop, destWidth, destHeight, 0, 0, 0, destHeight,
+			scaler.GetPixels(), &scaledInfo, DIB_RGB_COLORS);
+		FillLetterbox(hdc);
+	}
+
+	canvas->ReleaseHDC(hdc);
+	image->UnlockBits(&imageData);
+
+	QueryPerformanceCounter(&endTime);
+	presentTicks[presentMode] += endTime.QuadPart - startTime.QuadPart;
+	presentCount[presentMode]++;
+}
+
+
+
+/*
+Name:	WindowToImage()
+Params:
+	int windowX - The x coordinate in the window.
+	int windowY - The y coordinate in the window.
+	CRect* dimensions - The dimensions of the window.
+	int* imageX - Receives the x coordinate in the game image.
+	int* imageY - Receives the y coordinate in the game image.
+Return: void
+Description:
+	This method converts a window position to a game image position, taking the borders of the
+	integer mode into account. It does not change the presenter, so it can be called from any thread.
+*/
+void UFRPresenter::WindowToImage(int windowX, int windowY, CRect* dimensions, int* imageX, int* imageY) const
+{
+	int mode;
+	int scale;
+	int left;
+	int top;
+	int scaledWidth;
+	int scaledHeight;
+
+	CalcLayout(dimensions->Width(), dimensions->Height(), &mode, &scale, &left, &top, &scaledWidth, &scaledHeight);
+
+	if (scaledWidth <= 0 || scaledHeight <= 0)
+	{
+		*imageX = 0;
+		*imageY = 0;
+		return;
+	}
+
+	*imageX = (windowX - left) * (imageWidth / (float)scaledWidth);
+	*imageY = (windowY - top) * (imageHeight / (float)scaledHeight);
+}
+
+
+
+/*
+Name:	GetAveragePresentTime()
+Params: int mode - The present mode.
+Return: double - The average time in microseconds that a present took in that mode.
+Description:
+	This method returns the average cost of a present mode, or 0 if it has not been used.
+*/
+double UFRPresenter::GetAveragePresentTime(int mode)
+{
+	if (presentCount[mode] == 0)
+	{
+		return 0;
+	}
+
+	return (presentTicks[mode] * MICROSECONDS_PER_SECOND) / counterFrequency.QuadPart / presentCount[mode];
+}
+
+
+
+/*
+Name:	ReportCosts()
+Params: void
+Return: void
+Description:
+	This method writes the number of presents and the average cost of each present mode to the debug output,
+	and how much of its frame arena the presenter needed.
+*/
+void UFRPresenter::ReportCosts()
+{
+	const TCHAR* modeNames[PRESENT_MODE_COUNT] = { TEXT("copy"), TEXT("integer"), TEXT("stretch") };
+
+	for (int mode = 0; mode < PRESENT_MODE_COUNT; mode++)
+	{
+		TRACE(TEXT("Present %s: %u frames, %.1f us average\n"), modeNames[mode], presentCount[mode], GetAveragePresentTime(mode));
+	}
+	TRACE(TEXT("Present arena: %u of %u bytes used at most, %u blocks from the heap\n"),
+		(unsigned int)scaler.GetArena()->GetHighWater(), (unsigned int)scaler.GetArena()->GetCapacity(), scaler.GetArena()->GetOverflowCount());
+}
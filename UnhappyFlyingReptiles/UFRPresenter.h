@@ -0,0 +1,73 @@
+/*
+File:		UFRPresenter.h
+Project:	Unhappy Flying Reptiles
+Author(s):	Jorge Ramirez
+Description:
+	This file contains the class definition for the UFRPresenter class.
+*/
+
+#pragma once
+#include "afxwin.h"
+#include <gdiplus.h>
+#include <vector>
+#include "UFRImageScaler.h"
+
+using namespace Gdiplus;
+
+#define PRESENT_MODE_COPY 0
+#define PRESENT_MODE_INTEGER 1
+#define PRESENT_MODE_STRETCH 2
+#define PRESENT_MODE_COUNT 3
+
+
+/*
+Name: UFRPresenter
+Description:
+	This class is designed to copy the finished game image onto the window.
+	A window of the same size as the image gets a plain copy, a window that fits a 2x, 3x or 4x
+	image gets nearest neighbour pixel replication with black borders, and any other size goes through
+	a scaler whose lookup tables are only rebuilt when the window is resized.
+	The scaling is done by a UFRImageScaler, in bands of rows that run in parallel on the job system,
+	so presenting does not allocate once the window keeps its size.
+*/
+class UFRPresenter
+{
+private:
+	int imageWidth;
+	int imageHeight;
+
+	// Layout for the current window size
+	int windowWidth;
+	int windowHeight;
+	int presentMode;
+	int integerScale;
+	int destLeft;
+	int destTop;
+	int destWidth;
+	int destHeight;
+
+	UFRImageScaler scaler; // Scales the image for the integer and stretch modes
+
+	BITMAPINFO imageInfo;
+	BITMAPINFO scaledInfo;
+
+	// Cost of each present path
+	LARGE_INTEGER counterFrequency;
+	LONGLONG presentTicks[PRESENT_MODE_COUNT];
+	unsigned int presentCount[PRESENT_MODE_COUNT];
+
+	void CalcLayout(int width, int height, int* mode, int* scale, int* left, int* top, int* scaledWidth, int* scaledHeight) const;
+	void UpdateLayout(int newWindowWidth, int newWindowHeight);
+	void FillLetterbox(HDC hdc);
+
+public:
+	UFRPresenter(int width, int height, UFRJobSystem* jobs);
+
+	void Present(Graphics* canvas, Bitmap* image, CRect* dimensions);
+	void WindowToImage(int windowX, int windowY, CRect* dimensions, int* imageX, int* imageY) const;
+
+	int GetPresentMode() { return presentMode; }
+	unsigned int GetPresentCount(int mode) { return presentCount[mode]; }
+	double GetAveragePresentTime(int mode);
+	void ReportCosts();
+};
@@ -0,0 +1,403 @@
+/*
+File:		UFRReptiles.cpp
+Project:	Unhappy Flying Reptiles
+Author(s):	Jorge Ramirez
+Description:
+	This file contains the method definitions for the UFRReptiles class.
+*/
+
+#include "UFRReptiles.h"
+#include <stdlib.h>
+
+#define DEFAULT_FRICTION 1
+#define DEFAULT_GRAVITY 1
+#define WEIGHT 20
+#define FORCE_GIVEN 0.6
+
+#define MAX_TICKS_BETWEEN_FLAPS 10
+#define MIN_TICKS_BETWEEN_FLAPS 5
+#define MAX_FLAP_STRENGTH 12
+#define MIN_FLAP_STRENGTH 6
+#define MAX_TICKS_BETWEEN_XVEL 20
+#define MIN_TICKS_BETWEEN_XVEL 10
+#define MAX_RAND_X_SPEED 16
+#define MIN_RAND_X_SPEED 8
+#define DEFAULT_MAX_FLIGHT_THRESHOLD 300
+#define DEFAULT_MIN_FLIGHT_THRESHOLD 120
+
+#define ROTATION_DEGREES 360
+#define DEATH_SPIN_DEGREES 5
+
+#define REPTILE_SCALE 0.1
+#define REPTILE_FLYING_SPRITE_COUNT 8
+#define SPRITES_FILEPATH TEXT("ReptileSprites\\")
+#define REPTILE_SPRITE_EXT TEXT(".png")
+#define REPTILE_DEAD_SPRITE_PREFIX TEXT("RD")
+#define REPTILE_FLYING_SPRITE_PREFIX TEXT("RF")
+
+#define FLYING_COMPONENTS (COMPONENT_TRANSFORM | COMPONENT_VELOCITY | COMPONENT_SPRITE | COMPONENT_FLIGHT_AI)
+#define SPINNING_COMPONENTS (COMPONENT_TRANSFORM | COMPONENT_VELOCITY | COMPONENT_SPRITE | COMPONENT_FALL_SPIN)
+
+
+/*
+Name:	Create()
+Params:
+	UFRWorld* world - The world to add the reptile to.
+	UFRSpriteAtlas* atlas - The atlas to add the reptile sprites to.
+	int leftOffset - The initial offset from the left for the reptile.
+	int bottomOffset - The initial offset from the bottom for the reptile.
+	int horizontalVelocity - The initial horizontal velocity for the reptile.
+	int verticalVelocity - The initial vertical velocity for the reptile.
+Return: int - The entity of the reptile.
+Description:
+	This method adds a flying reptile to the world.
+	The size of the reptile is the size of its first flying sprite.
+*/
+int UFRReptiles::Create(UFRWorld* world, UFRSpriteAtlas* atlas, int leftOffset, int bottomOffset, int horizontalVelocity, int verticalVelocity)
+{
+	wchar_t buff[256] = { '\0' };
+	int entity = world->CreateEntity(REPTILE_COMPONENTS);
+	UFRTransform& transform = world->GetTransform(entity);
+	UFRVelocity& velocity = world->GetVelocity(entity);
+	UFRBody& body = world->GetBody(entity);
+	UFRSprite& sprite = world->GetSprite(entity);
+	UFRFlightAI& flight = world->GetFlightAI(entity);
+
+	transform.left = leftOffset;
+	transform.bottom = bottomOffset;
+	velocity.x = horizontalVelocity;
+	velocity.y = verticalVelocity;
+
+	flight.minHeight = DEFAULT_MIN_FLIGHT_THRESHOLD;
+	flight.maxHeight = DEFAULT_MAX_FLIGHT_THRESHOLD;
+	flight.minSpeed = MIN_RAND_X_SPEED;
+	flight.maxSpeed = MAX_RAND_X_SPEED;
+	flight.ticksToNextFlap = CalcTicksToNextFlap();
+	flight.ticksToNextSpeed = CalcTicksToNextSpeed();
+
+	// Add reptile sprites to the atlas, already scaled
+	for (int frame = 0; frame < REPTILE_FLYING_SPRITE_COUNT; frame++)
+	{
+		swprintf(buff, TEXT("%s%s%d%s"), SPRITES_FILEPATH, REPTILE_FLYING_SPRITE_PREFIX, frame, REPTILE_SPRITE_EXT);
+		flight.frames[frame] = atlas->Add(buff, REPTILE_SCALE);
+	}
+	flight.frameCount = REPTILE_FLYING_SPRITE_COUNT;
+	flight.frame = 0;
+	swprintf(buff, TEXT("%s%s%s"), SPRITES_FILEPATH, REPTILE_DEAD_SPRITE_PREFIX, REPTILE_SPRITE_EXT);
+	flight.fallSprite = atlas->Add(buff, REPTILE_SCALE);
+
+	// The sprite is mirrored when it is drawn, so the shared bitmaps are never modified
+	sprite.sprite = flight.frames[flight.frame];
+	sprite.mirrored = velocity.x < 0;
+
+	body.width = atlas->GetWidth(sprite.sprite);
+	body.height = atlas->GetHeight(sprite.sprite);
+	body.weight = WEIGHT;
+	body.forceGiven = FORCE_GIVEN;
+	body.gravity = DEFAULT_GRAVITY;
+	body.lands = true;
+	body.pixelExact = true;
+
+	// Make room for every reptile to be knocked down, so moving one to its falling archetype never allocates during play
+	world->Reserve(REPTILE_COMPONENTS | COMPONENT_FALL_SPIN | COMPONENT_FRICTION, world->GetEntityArchetype(entity)->GetSize());
+
+	return entity;
+}
+
+
+
+/*
+Name:	ListSpriteFiles()
+Params: std::vector<UFRSpriteRequest>& sprites - The list to add the sprite files to.
+Return: void
+Description:
+	This method lists every sprite file a reptile uses with the scale it is drawn at,
+	so they can be decoded and reduced before any reptile is created.
+*/
+void UFRReptiles::ListSpriteFiles(std::vector<UFRSpriteRequest>& sprites)
+{
+	wchar_t buff[256] = { '\0' };
+
+	for (int sprite = 0; sprite < REPTILE_FLYING_SPRITE_COUNT; sprite++)
+	{
+		swprintf(buff, TEXT("%s%s%d%s"), SPRITES_FILEPATH, REPTILE_FLYING_SPRITE_PREFIX, sprite, REPTILE_SPRITE_EXT);
+		sprites.push_back(UFRSpriteRequest(buff, REPTILE_SCALE));
+	}
+	swprintf(buff, TEXT("%s%s%s"), SPRITES_FILEPATH, REPTILE_DEAD_SPRITE_PREFIX, REPTILE_SPRITE_EXT);
+	sprites.push_back(UFRSpriteRequest(buff, REPTILE_SCALE));
+}
+
+
+
+/*
+Name:	Fly()
+Params: UFRWorld* world - The entities to fly.
+Return: void
+Description:
+	This method runs the flight AI of every entity that has one and has not been knocked down, after it has moved.
+	An entity on the ground or below its lowest height always flaps, otherwise it flaps when its time comes
+	as long as it is below its highest height. From time to time it picks a new random speed.
+	It then shows its next flying frame, facing the way it flies.
+*/
+void UFRReptiles::Fly(UFRWorld* world)
+{
+	UFRArchetype* table;
+
+	for (int archetype = 0; archetype < world->GetArchetypeCount(); archetype++)
+	{
+		table = world->GetArchetype(archetype);
+		if (!table->Matches(FLYING_COMPONENTS, COMPONENT_FALL_SPIN))
+		{
+			continue;
+		}
+
+		for (int row = 0; row < table->GetSize(); row++)
+		{
+			UFRTransform& transform = table->transforms[row];
+			UFRVelocity& velocity = table->velocities[row];
+			UFRSprite& sprite = table->sprites[row];
+			UFRFlightAI& flight = table->flights[row];
+
+			// Flap off the ground and set ticks until next flap
+			if (transform.bottom == 0)
+			{
+				FlapWings(&velocity);
+				flight.ticksToNextFlap = CalcTicksToNextFlap();
+			}
+
+			// If it is time for the next flap, or the entity is below the lowest height, and it is below the highest height, flap.
+			// Else, continue counting down to next flap.
+			if ((flight.ticksToNextFlap <= 0 || transform.bottom < flight.minHeight) && transform.bottom < flight.maxHeight)
+			{
+				FlapWings(&velocity);
+				flight.ticksToNextFlap = CalcTicksToNextFlap();
+			}
+			else
+			{
+				flight.ticksToNextFlap--;
+			}
+
+			// If it's time to change speed, change it.
+			// Else, continue counting down to next change.
+			if (flight.ticksToNextSpeed <= 0)
+			{
+				SetRandomSpeed(&flight, &velocity);
+				flight.ticksToNextSpeed = CalcTicksToNextSpeed();
+			}
+			else
+			{
+				flight.ticksToNextSpeed--;
+			}
+
+			// Show the next flying frame, facing the way it flies
+			flight.frame++;
+			if (flight.frame == flight.frameCount)
+			{
+				flight.frame = 0;
+			}
+			sprite.sprite = flight.frames[flight.frame];
+			sprite.mirrored = velocity.x < 0;
+		}
+	}
+}
+
+
+
+/*
+Name:	Spin()
+Params: UFRWorld* world - The entities to spin.
+Return: void
+Description:
+	This method turns every knocked down entity clockwise while it moves right and counter clockwise while it moves left,
+	and shows its fallen sprite. It runs before the entities move, so the spin follows the velocity they were hit with.
+	The fallen sprite keeps facing the way the entity was last flying.
+*/
+void UFRReptiles::Spin(UFRWorld* world)
+{
+	UFRArchetype* table;
+
+	for (int archetype = 0; archetype < world->GetArchetypeCount(); archetype++)
+	{
+		table = world->GetArchetype(archetype);
+		if (!table->Matches(SPINNING_COMPONENTS, 0))
+		{
+			continue;
+		}
+
+		for (int row = 0; row < table->GetSize(); row++)
+		{
+			UFRTransform& transform = table->transforms[row];
+			UFRFallSpin& spin = table->spins[row];
+
+			if (table->velocities[row].x > 0)
+			{
+				transform.rotation = (transform.rotation + spin.degrees) % ROTATION_DEGREES;
+			}
+			else if (table->velocities[row].x < 0)
+			{
+				transform.rotation = (transform.rotation - spin.degrees) % ROTATION_DEGREES;
+			}
+
+			table->sprites[row].sprite = spin.sprite;
+		}
+	}
+}
+
+
+
+/*
+Name:	KnockDown()
+Params:
+	UFRWorld* world - The world the entity is in.
+	int entity - An entity with a flight AI.
+Return: void
+Description:
+	This method knocks an entity out of the air. Its flight AI stops, it spins as it falls and it slides to a stop on the ground.
+	Knocking down an entity that is already down changes nothing.
+*/
+void UFRReptiles::KnockDown(UFRWorld* world, int entity)
+{
+	int fallSprite;
+
+	if (world->HasComponents(entity, COMPONENT_FALL_SPIN))
+	{
+		return;
+	}
+
+	fallSprite = world->GetFlightAI(entity).fallSprite;
+	world->AddComponents(entity, COMPONENT_FALL_SPIN | COMPONENT_FRICTION);
+
+	UFRFallSpin& spin = world->GetFallSpin(entity);
+	spin.degrees = DEATH_SPIN_DEGREES;
+	spin.sprite = fallSprite;
+
+	UFRFriction& friction = world->GetFriction(entity);
+	friction.amount = DEFAULT_FRICTION;
+	friction.inAir = false;
+}
+
+
+
+/*
+Name:	Revive()
+Params:
+	UFRWorld* world - The world the entity is in.
+	int entity - An entity with a flight AI.
+	int leftOffset - The new offset from the left.
+	int bottomOffset - The new offset from the bottom.
+	int horizontalVelocity - The new horizontal velocity.
+	int verticalVelocity - The new vertical velocity.
+Return: void
+Description:
+	This method puts a knocked down entity back in the air, upright, and restarts its flight AI.
+*/
+void UFRReptiles::Revive(UFRWorld* world, int entity, int leftOffset, int bottomOffset, int horizontalVelocity, int verticalVelocity)
+{
+	world->RemoveComponents(entity, COMPONENT_FALL_SPIN | COMPONENT_FRICTION);
+
+	UFRTransform& transform = world->GetTransform(entity);
+	transform.left = leftOffset;
+	transform.bottom = bottomOffset;
+	transform.rotation = 0;
+
+	UFRVelocity& velocity = world->GetVelocity(entity);
+	velocity.x = horizontalVelocity;
+	velocity.y = verticalVelocity;
+}
+
+
+
+/*
+Name:	SpeedUp()
+Params:
+	UFRFlightAI* flight - The flight AI to change.
+	double factor - How many times faster to fly.
+Return: void
+Description:
+	This method multiplies the fastest and the slowest speeds the flight AI picks from,
+	as long as the slowest stays below the fastest.
+*/
+void UFRReptiles::SpeedUp(UFRFlightAI* flight, double factor)
+{
+	int speed = (int)(flight->maxSpeed * factor);
+
+	if (speed > flight->minSpeed)
+	{
+		flight->maxSpeed = speed;
+	}
+
+	speed = (int)(flight->minSpeed * factor);
+	if (speed < flight->maxSpeed)
+	{
+		flight->minSpeed = speed;
+	}
+}
+
+
+
+/*
+Name:	SetRandomSpeed()
+Params:
+	UFRFlightAI* flight - The flight AI that picks the speed.
+	UFRVelocity* velocity - The velocity to change.
+Return: void
+Description:
+	This method selects a random horizontal velocity, left or right, between the slowest and the fastest speeds of the flight AI.
+*/
+void UFRReptiles::SetRandomSpeed(UFRFlightAI* flight, UFRVelocity* velocity)
+{
+	// Get random value between -NumberOfAllowedSpeeds and (NumberOfAllowedSpeeds - 1)
+	int velBuff = (rand() % ((flight->maxSpeed - flight->minSpeed) * 2)) - flight->minSpeed;
+
+	// Adjust based on going left or right
+	if (velBuff >= 0)
+	{
+		velocity->x = velBuff + flight->minSpeed;
+	}
+	else
+	{
+		velocity->x = velBuff - (flight->minSpeed - 1);
+	}
+}
+
+
+
+/*
+Name:	FlapWings()
+Params: UFRVelocity* velocity - The velocity to flap up.
+Return: void
+Description:
+	This method adds a random flap strength within a range to the vertical velocity.
+*/
+void UFRReptiles::FlapWings(UFRVelocity* velocity)
+{
+	velocity->y += (rand() % (MAX_FLAP_STRENGTH - MIN_FLAP_STRENGTH)) + MIN_FLAP_STRENGTH;
+}
+
+
+
+/*
+Name:	CalcTicksToNextFlap()
+Params: None
+Return: int - The ticks until the next flap.
+Description:
+	This method generates a random number of ticks within a range until the wings flap again.
+*/
+int UFRReptiles::CalcTicksToNextFlap()
+{
+	return (rand() % (MAX_TICKS_BETWEEN_FLAPS - MIN_TICKS_BETWEEN_FLAPS)) + MIN_TICKS_BETWEEN_FLAPS;
+}
+
+
+
+/*
+Name:	CalcTicksToNextSpeed()
+Params: None
+Return: int - The ticks until the next change of speed.
+Description:
+	This method generates a random number of ticks within a range until a new speed is picked.
+*/
+int UFRReptiles::CalcTicksToNextSpeed()
+{
+	return (rand() % (MAX_TICKS_BETWEEN_XVEL - MIN_TICKS_BETWEEN_XVEL)) + MIN_TICKS_BETWEEN_XVEL;
+}
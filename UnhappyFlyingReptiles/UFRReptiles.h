@@ -0,0 +1,43 @@
+/*
+File:		UFRReptiles.h
+Project:	Unhappy Flying Reptiles
+Author(s):	Jorge Ramirez
+Description:
+	This file contains the class definition for the UFRReptiles class.
+*/
+
+#pragma once
+#include <vector>
+#include "UFRWorld.h"
+#include "UFRSpriteAtlas.h"
+
+#define REPTILE_COMPONENTS (COMPONENT_TRANSFORM | COMPONENT_VELOCITY | COMPONENT_BODY | COMPONENT_SPRITE | COMPONENT_FLIGHT_AI)
+
+
+/*
+Name: UFRReptiles
+Description:
+	This class is designed to create flying reptiles and run the systems that only they need.
+	A reptile is a body with a flight AI. Knocking it down adds a fall spin and ground friction,
+	which pause the flight AI until it is revived.
+	The flight and the spin systems go over every entity with those components, not only reptiles.
+*/
+class UFRReptiles
+{
+private:
+	static void FlapWings(UFRVelocity* velocity);
+	static int CalcTicksToNextFlap();
+	static int CalcTicksToNextSpeed();
+
+public:
+	static int Create(UFRWorld* world, UFRSpriteAtlas* atlas, int leftOffset, int bottomOffset, int horizontalVelocity, int verticalVelocity);
+	static void ListSpriteFiles(std::vector<UFRSpriteRequest>& sprites);
+
+	static void Fly(UFRWorld* world);
+	static void Spin(UFRWorld* world);
+
+	static void KnockDown(UFRWorld* world, int entity);
+	static void Revive(UFRWorld* world, int entity, int leftOffset, int bottomOffset, int horizontalVelocity, int verticalVelocity);
+	static void SpeedUp(UFRFlightAI* flight, double factor);
+	static void SetRandomSpeed(UFRFlightAI* flight, UFRVelocity* velocity);
+};
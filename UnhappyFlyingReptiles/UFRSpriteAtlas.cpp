@@ -0,0 +1,573 @@
+/*
+File:		UFRSpriteAtlas.cpp
+Project:	Unhappy Flying Reptiles
+Author(s):	Jorge Ramirez
+Description:
+	This file contains the method definitions for the UFRSpriteAtlas class.
+*/
+
+#include "UFRSpriteAtlas.h"
+#include <stdio.h>
+#include <string.h>
+#include <algorithm>
+
+#define ATLAS_MIN_WIDTH 512
+#define ATLAS_PADDING 1
+#define ATLAS_MAGIC "UFRA"
+#define ATLAS_VERSION 1
+#define BYTES_PER_PIXEL 4
+
+/*
+Name:	UFRSpriteAtlas()
+Params: void
+Description:
+	Constructor for the UFRSpriteAtlas class. The atlas starts empty.
+*/
+UFRSpriteAtlas::UFRSpriteAtlas()
+{
+	image = NULL;
+	needsBuild = false;
+}
+
+
+
+/*
+Name:	~UFRSpriteAtlas()
+Params: void
+Description:
+	Destructor for the UFRSpriteAtlas class.
+	The atlas image is freed, and any sources that were never built are released with the entries.
+*/
+UFRSpriteAtlas::~UFRSpriteAtlas()
+{
+	delete image;
+}
+
+
+
+/*
+Name:	Add()
+Params:
+	const wchar_t* path - The image file of the sprite.
+	double scale - The scale the sprite is drawn at.
+Return: int - The number of the sprite in the atlas.
+Description:
+	This method adds a sprite to the atlas, or finds it if the same file at the same scale is already there.
+	The source of a new sprite comes from the sprite manager already reduced to its scale, so a file added at
+	several scales is decoded once and its full size pixels are not kept. It is only copied into the atlas by
+	the next Build, but its size is known straight away.
+*/
+int UFRSpriteAtlas::Add(const wchar_t* path, double scale)
+{
+	Entry entry;
+	int sprite;
+
+	// Sprites are keyed by their file name, which is always plain ASCII
+	memset(entry.name, 0, sizeof(entry.name));
+	for (int character = 0; character < ATLAS_NAME_LENGTH - 1 && path[character] != 0; character++)
+	{
+		entry.name[character] = (char)path[character];
+	}
+
+	sprite = Find(entry.name, scale);
+	if (sprite >= 0)
+	{
+		return sprite;
+	}
+
+	entry.scale = scale;
+	entry.source = UFRSpriteManager::GetInstance()->AcquireScaled(path, scale);
+	entry.rect = Rect(0, 0, entry.source->GetWidth(), entry.source->GetHeight());
+	entries.push_back(entry);
+	needsBuild = true;
+
+	return (int)entries.size() - 1;
+}
+
+
+
+/*
+Name:	Find()
+Params:
+	const char* name - The source file of the sprite.
+	double scale - The scale of the sprite.
+Return: int - The number of the sprite, or -1 if it is not in the atlas.
+Description:
+	This method looks up a sprite by its source file and scale.
+*/
+int UFRSpriteAtlas::Find(const char* name, double scale)
+{
+	for (int sprite = 0; sprite < entries.size(); sprite++)
+	{
+		if (entries[sprite].scale == scale && strcmp(entries[sprite].name, name) == 0)
+		{
+			return sprite;
+		}
+	}
+
+	return -1;
+}
+
+
+
+/*
+Name:	Pack()
+Params:
+	std::vector<Rect>& packed - Set to the new rectangle of every sprite.
+	int* atlasWidth - Set to the width of the atlas.
+	int* atlasHeight - Set to the height of the atlas.
+Return: void
+Description:
+	This method places the sprites on shelves from the tallest down, starting a new shelf
+	whenever the next sprite does not fit on the current one.
+*/
+void UFRSpriteAtlas::Pack(std::vector<Rect>& packed, int* atlasWidth, int* atlasHeight)
+{
+	std::vector<int> order(entries.size());
+	int shelfX = ATLAS_PADDING;
+	int shelfY = ATLAS_PADDING;
+	int shelfHeight = 0;
+
+	*atlasWidth = ATLAS_MIN_WIDTH;
+	for (int sprite = 0; sprite < entries.size(); sprite++)
+	{
+		order[sprite] = sprite;
+		if (entries[sprite].rect.Width + 2 * ATLAS_PADDING > *atlasWidth)
+		{
+			*atlasWidth = entries[sprite].rect.Width + 2 * ATLAS_PADDING;
+		}
+	}
+
+	std::sort(order.begin(), order.end(), [this](int first, int second)
+	{
+		return entries[first].rect.Height > entries[second].rect.Height;
+	});
+
+	packed.resize(entries.size());
+	for (int position = 0; position < order.size(); position++)
+	{
+		const Rect& rect = entries[order[position]].rect;
+
+		if (shelfX + rect.Width + ATLAS_PADDING > *atlasWidth)
+		{
+			shelfY += shelfHeight + ATLAS_PADDING;
+			shelfX = ATLAS_PADDING;
+			shelfHeight = 0;
+		}
+
+		packed[order[position]] = Rect(shelfX, shelfY, rect.Width, rect.Height);
+		shelfX += rect.Width + ATLAS_PADDING;
+		if (rect.Height > shelfHeight)
+		{
+			shelfHeight = rect.Height;
+		}
+	}
+
+	*atlasHeight = shelfY + shelfHeight + ATLAS_PADDING;
+}
+
+
+
+/*
+Name:	Build()
+Params: void
+Return: void
+Description:
+	This method packs every sprite into a new atlas image.
+	New sprites are copied from their reduced sources, which are then released,
+	and sprites that were already in the atlas are copied across as they are.
+*/
+void UFRSpriteAtlas::Build()
+{
+	std::vector<Rect> packed;
+	int atlasWidth;
+	int atlasHeight;
+	Bitmap* newImage;
+	Graphics* atlasCanvas;
+
+	if (!needsBuild)
+	{
+		return;
+	}
+
+	Pack(packed, &atlasWidth, &atlasHeight);
+
+	newImage = new Bitmap(atlasWidth, atlasHeight, PixelFormat32bppPARGB);
+	atlasCanvas = Graphics::FromImage(newImage);
+	atlasCanvas->Clear(Color(0, 0, 0, 0));
+	atlasCanvas->SetCompositingMode(CompositingModeSourceCopy);
+
+	for (int sprite = 0; sprite < entries.size(); sprite++)
+	{
+		Entry& entry = entries[sprite];
+
+		if (entry.source)
+		{
+			atlasCanvas->DrawImage(entry.source.get(), packed[sprite], 0, 0,
+				entry.rect.Width, entry.rect.Height, UnitPixel);
+			entry.source.reset();
+		}
+		else
+		{
+			atlasCanvas->DrawImage(image, packed[sprite], entry.rect.X, entry.rect.Y,
+				entry.rect.Width, entry.rect.Height, UnitPixel);
+		}
+
+		entry.rect = packed[sprite];
+	}
+
+	delete atlasCanvas;
+	delete image;
+	image = newImage;
+	needsBuild = false;
+}
+
+
+
+/*
+Name:	Load()
+Params: const wchar_t* path - The baked atlas file.
+Return: bool - Whether the file was a valid atlas.
+Description:
+	This method replaces the atlas with one baked by Save.
+	It should be called before any sprites are added, so they are found in the file instead of being decoded.
+	The file must be long enough for its header before anything is allocated, and every sprite must lie inside the image.
+*/
+bool UFRSpriteAtlas::Load(const wchar_t* path)
+{
+	FILE* atlasFile = _wfopen(path, TEXT("rb"));
+	UFRAtlasFileHeader header;
+	std::vector<UFRAtlasFileEntry> fileEntries;
+	Bitmap* newImage;
+	BitmapData pixels;
+	long long fileSize;
+	bool loaded = true;
+
+	if (atlasFile == NULL)
+	{
+		return false;
+	}
+
+	_fseeki64(atlasFile, 0, SEEK_END);
+	fileSize = _ftelli64(atlasFile);
+	_fseeki64(atlasFile, 0, SEEK_SET);
+
+	if (fread(&header, sizeof(header), 1, atlasFile) != 1 || !IsValidHeader(header) ||
+		(unsigned long long)fileSize < GetFileSize(header))
+	{
+		fclose(atlasFile);
+		return false;
+	}
+
+	fileEntries.resize(header.entryCount);
+	if (fread(&fileEntries[0], sizeof(UFRAtlasFileEntry), header.entryCount, atlasFile) != header.entryCount ||
+		!AreValidEntries(header, &fileEntries[0]))
+	{
+		fclose(atlasFile);
+		return false;
+	}
+
+	// Read the pixels straight into the new atlas
+	newImage = new Bitmap(header.width, header.height, PixelFormat32bppPARGB);
+	Rect imageRect(0, 0, header.width, header.height);
+	if (newImage->GetLastStatus() != Ok ||
+		newImage->LockBits(&imageRect, ImageLockModeWrite, PixelFormat32bppPARGB, &pixels) != Ok)
+	{
+		delete newImage;
+		fclose(atlasFile);
+		return false;
+	}
+	for (int row = 0; row < header.height && loaded; row++)
+	{
+		loaded = fread((BYTE*)pixels.Scan0 + row * pixels.Stride, BYTES_PER_PIXEL, header.width, atlasFile) == header.width;
+	}
+	newImage->UnlockBits(&pixels);
+	fclose(atlasFile);
+
+	if (!loaded)
+	{
+		delete newImage;
+		return false;
+	}
+
+	SetEntries(header, &fileEntries[0]);
+	delete image;
+	image = newImage;
+	needsBuild = false;
+
+	return true;
+}
+
+
+
+/*
+Name:	LoadView()
+Params:
+	BYTE* data - A baked atlas in memory, such as an entry of the asset pack.
+	unsigned long long size - The size of the baked atlas in bytes.
+Return: bool - Whether the memory holds a valid atlas.
+Description:
+	This method replaces the atlas with one baked by Save, using the pixels where they are instead of copying them.
+	The memory must stay valid for as long as the atlas is used.
+*/
+bool UFRSpriteAtlas::LoadView(BYTE* data, unsigned long long size)
+{
+	const UFRAtlasFileHeader* header = (const UFRAtlasFileHeader*)data;
+	unsigned long long tableSize;
+
+	if (size < sizeof(UFRAtlasFileHeader) || !IsValidHeader(*header))
+	{
+		return false;
+	}
+
+	tableSize = sizeof(UFRAtlasFileHeader) + (unsigned long long)header->entryCount * sizeof(UFRAtlasFileEntry);
+	if (size < GetFileSize(*header) || !AreValidEntries(*header, (const UFRAtlasFileEntry*)(data + sizeof(UFRAtlasFileHeader))))
+	{
+		return false;
+	}
+
+	SetEntries(*header, (const UFRAtlasFileEntry*)(data + sizeof(UFRAtlasFileHeader)));
+	delete image;
+	image = new Bitmap(header->width, header->height, header->width * BYTES_PER_PIXEL, PixelFormat32bppPARGB, data + tableSize);
+	needsBuild = false;
+
+	return true;
+}
+
+
+
+/*
+Name:	IsValidHeader()
+Params: const UFRAtlasFileHeader& header - The header of a baked atlas.
+Return: bool - Whether the header is one this version can read.
+Description:
+	This method checks the header of a baked atlas.
+*/
+bool UFRSpriteAtlas::IsValidHeader(const UFRAtlasFileHeader& header)
+{
+	return memcmp(header.magic, ATLAS_MAGIC, sizeof(header.magic)) == 0 && header.version == ATLAS_VERSION &&
+		header.entryCount > 0 && header.width > 0 && header.height > 0;
+}
+
+
+
+/*
+Name:	GetFileSize()
+Params: const UFRAtlasFileHeader& header - The valid header of a baked atlas.
+Return: unsigned long long - The size in bytes of the header, the sprite records and the pixels it describes.
+Description:
+	This method works out how long a baked atlas has to be, without overflowing for any header that passes IsValidHeader.
+*/
+unsigned long long UFRSpriteAtlas::GetFileSize(const UFRAtlasFileHeader& header)
+{
+	return sizeof(UFRAtlasFileHeader) + (unsigned long long)header.entryCount * sizeof(UFRAtlasFileEntry) +
+		(unsigned long long)header.width * header.height * BYTES_PER_PIXEL;
+}
+
+
+
+/*
+Name:	AreValidEntries()
+Params:
+	const UFRAtlasFileHeader& header - The valid header of a baked atlas.
+	const UFRAtlasFileEntry* fileEntries - The sprite records of the baked atlas.
+Return: bool - Whether every sprite lies inside the atlas image.
+Description:
+	This method checks the sprite records of a baked atlas, so a stale or damaged file cannot make BuildMasks or Draw
+	read outside the image. One bad record rejects the whole atlas.
+*/
+bool UFRSpriteAtlas::AreValidEntries(const UFRAtlasFileHeader& header, const UFRAtlasFileEntry* fileEntries)
+{
+	for (int sprite = 0; sprite < header.entryCount; sprite++)
+	{
+		const UFRAtlasFileEntry& entry = fileEntries[sprite];
+
+		if (entry.x < 0 || entry.y < 0 || entry.width <= 0 || entry.height <= 0 ||
+			(long long)entry.x + entry.width > header.width || (long long)entry.y + entry.height > header.height)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+
+
+/*
+Name:	SetEntries()
+Params:
+	const UFRAtlasFileHeader& header - The header of a baked atlas.
+	const UFRAtlasFileEntry* fileEntries - The sprite records of the baked atlas.
+Return: void
+Description:
+	This method replaces the sprites of the atlas with the records of a baked atlas.
+*/
+void UFRSpriteAtlas::SetEntries(const UFRAtlasFileHeader& header, const UFRAtlasFileEntry* fileEntries)
+{
+	entries.clear();
+	entries.resize(header.entryCount);
+	for (int sprite = 0; sprite < header.entryCount; sprite++)
+	{
+		memcpy(entries[sprite].name, fileEntries[sprite].name, ATLAS_NAME_LENGTH);
+		entries[sprite].name[ATLAS_NAME_LENGTH - 1] = '\0';
+		entries[sprite].scale = fileEntries[sprite].scale;
+		entries[sprite].rect = Rect(fileEntries[sprite].x, fileEntries[sprite].y, fileEntries[sprite].width, fileEntries[sprite].height);
+	}
+}
+
+
+
+/*
+Name:	Save()
+Params: const wchar_t* path - The file to bake the atlas to.
+Return: bool - Whether the whole atlas was written.
+Description:
+	This method builds the atlas if it has new sprites and writes it to a file for Load.
+*/
+bool UFRSpriteAtlas::Save(const wchar_t* path)
+{
+	FILE* atlasFile;
+	bool saved;
+
+	Build();
+	if (image == NULL)
+	{
+		return false;
+	}
+
+	atlasFile = _wfopen(path, TEXT("wb"));
+	if (atlasFile == NULL)
+	{
+		return false;
+	}
+
+	saved = Write(atlasFile);
+	return fclose(atlasFile) == 0 && saved;
+}
+
+
+
+/*
+Name:	Write()
+Params: FILE* output - The file to write the atlas to, at its current position.
+Return: bool - Whether the whole atlas was written.
+Description:
+	This method writes the header, the sprite records and the pixels of a built atlas.
+*/
+bool UFRSpriteAtlas::Write(FILE* output)
+{
+	UFRAtlasFileHeader header;
+	BitmapData pixels;
+	bool saved;
+
+	Build();
+	if (image == NULL)
+	{
+		return false;
+	}
+
+	memcpy(header.magic, ATLAS_MAGIC, sizeof(header.magic));
+	header.version = ATLAS_VERSION;
+	header.entryCount = (int)entries.size();
+	header.width = image->GetWidth();
+	header.height = image->GetHeight();
+	saved = fwrite(&header, sizeof(header), 1, output) == 1;
+
+	for (int sprite = 0; sprite < entries.size() && saved; sprite++)
+	{
+		UFRAtlasFileEntry fileEntry;
+		memcpy(fileEntry.name, entries[sprite].name, ATLAS_NAME_LENGTH);
+		fileEntry.scale = entries[sprite].scale;
+		fileEntry.x = entries[sprite].rect.X;
+		fileEntry.y = entries[sprite].rect.Y;
+		fileEntry.width = entries[sprite].rect.Width;
+		fileEntry.height = entries[sprite].rect.Height;
+		saved = fwrite(&fileEntry, sizeof(fileEntry), 1, output) == 1;
+	}
+
+	Rect imageRect(0, 0, header.width, header.height);
+	image->LockBits(&imageRect, ImageLockModeRead, PixelFormat32bppPARGB, &pixels);
+	for (int row = 0; row < header.height && saved; row++)
+	{
+		saved = fwrite((BYTE*)pixels.Scan0 + row * pixels.Stride, BYTES_PER_PIXEL, header.width, output) == header.width;
+	}
+	image->UnlockBits(&pixels);
+
+	return saved;
+}
+
+
+
+/*
+Name:	BuildMasks()
+Params: void
+Return: void
+Description:
+	This method makes the collision masks of every sprite from the alpha of the atlas,
+	one as the sprite is stored and one flipped left to right for when it is drawn mirrored.
+	It is called once the atlas is built, and the masks are never changed after that.
+*/
+void UFRSpriteAtlas::BuildMasks()
+{
+	BitmapData pixels;
+
+	masks.assign(entries.size() * 2, UFRCollisionMask());
+	if (image == NULL)
+	{
+		return;
+	}
+
+	Rect imageRect(0, 0, image->GetWidth(), image->GetHeight());
+	image->LockBits(&imageRect, ImageLockModeRead, PixelFormat32bppPARGB, &pixels);
+	for (int sprite = 0; sprite < entries.size(); sprite++)
+	{
+		const Rect& rect = entries[sprite].rect;
+		const BYTE* topLeft = (BYTE*)pixels.Scan0 + rect.Y * pixels.Stride + rect.X * BYTES_PER_PIXEL;
+
+		masks[sprite * 2].Build(topLeft, pixels.Stride, rect.Width, rect.Height, false);
+		masks[sprite * 2 + 1].Build(topLeft, pixels.Stride, rect.Width, rect.Height, true);
+	}
+	image->UnlockBits(&pixels);
+}
+
+
+
+/*
+Name:	Draw()
+Params:
+	Graphics* canvas - The Graphics object to draw the sprite onto.
+	int sprite - The number of the sprite.
+	REAL x - The left of the sprite on the canvas.
+	REAL y - The top of the sprite on the canvas.
+Return: void
+Description:
+	This method draws a sprite at the size it was added at.
+*/
+void UFRSpriteAtlas::Draw(Graphics* canvas, int sprite, REAL x, REAL y)
+{
+	Draw(canvas, sprite, x, y, (REAL)entries[sprite].rect.Width, (REAL)entries[sprite].rect.Height);
+}
+
+
+
+/*
+Name:	Draw()
+Params:
+	Graphics* canvas - The Graphics object to draw the sprite onto.
+	int sprite - The number of the sprite.
+	REAL x - The left of the sprite on the canvas.
+	REAL y - The top of the sprite on the canvas.
+	REAL width - The width to draw the sprite at.
+	REAL height - The height to draw the sprite at.
+Return: void
+Description:
+	This method draws a sprite from its rectangle of the atlas.
+*/
+void UFRSpriteAtlas::Draw(Graphics* canvas, int sprite, REAL x, REAL y, REAL width, REAL height)
+{
+	const Rect& rect = entries[sprite].rect;
+
+	canvas->DrawImage(image, RectF(x, y, width, height), (REAL)rect.X, (REAL)rect.Y,
+		(REAL)rect.Width, (REAL)rect.Height, UnitPixel);
+}
@@ -0,0 +1,101 @@
+/*
+File:		UFRSpriteAtlas.h
+Project:	Unhappy Flying Reptiles
+Author(s):	Jorge Ramirez
+Description:
+	This file contains the class definition for the UFRSpriteAtlas class.
+*/
+
+#pragma once
+#include "afxwin.h"
+#include <gdiplus.h>
+#include <stdio.h>
+#include <vector>
+#include <memory>
+#include "UFRSpriteManager.h"
+#include "UFRCollisionMask.h"
+
+using namespace Gdiplus;
+
+#define ATLAS_FILE TEXT(".\\Sprites.atlas")
+#define ATLAS_NAME_LENGTH 64
+
+// The layout of a baked atlas file: a header, one record per sprite, then the PARGB pixels row by row
+struct UFRAtlasFileHeader
+{
+	char magic[4];
+	int version;
+	int entryCount;
+	int width;
+	int height;
+};
+
+struct UFRAtlasFileEntry
+{
+	char name[ATLAS_NAME_LENGTH];
+	double scale;
+	int x;
+	int y;
+	int width;
+	int height;
+};
+
+
+/*
+Name: UFRSpriteAtlas
+Description:
+	This class is designed to keep every game sprite in one image.
+	Each sprite is added with the scale it is drawn at, so it is stored already scaled and is drawn 1:1
+	from its rectangle in the atlas. Sprites are packed into shelves sorted by height, with a transparent
+	pixel between them so filtering never picks up a neighbour.
+	A finished atlas can be saved to a file by the /bakeatlas build step and loaded at startup,
+	or used in place from the cooked asset pack, in which case sprites already in it are not decoded at all.
+	Once the atlas is complete, collision masks can be made from the alpha of every sprite, facing either way.
+*/
+class UFRSpriteAtlas
+{
+private:
+	struct Entry
+	{
+		char name[ATLAS_NAME_LENGTH]; // The source file of the sprite
+		double scale;
+		Rect rect; // Where the scaled sprite is in the atlas
+		std::shared_ptr<Bitmap> source; // The reduced source until the atlas is built, empty for sprites already in the atlas
+	};
+
+	std::vector<Entry> entries;
+	std::vector<UFRCollisionMask> masks; // Two per sprite, as it is and mirrored
+	Bitmap* image;
+	bool needsBuild;
+
+	int Find(const char* name, double scale);
+	static bool IsValidHeader(const UFRAtlasFileHeader& header);
+	static unsigned long long GetFileSize(const UFRAtlasFileHeader& header);
+	static bool AreValidEntries(const UFRAtlasFileHeader& header, const UFRAtlasFileEntry* fileEntries);
+	void SetEntries(const UFRAtlasFileHeader& header, const UFRAtlasFileEntry* fileEntries);
+	void Pack(std::vector<Rect>& packed, int* atlasWidth, int* atlasHeight);
+
+	UFRSpriteAtlas(const UFRSpriteAtlas&);
+	UFRSpriteAtlas& operator=(const UFRSpriteAtlas&);
+
+public:
+	UFRSpriteAtlas();
+	~UFRSpriteAtlas();
+
+	int Add(const wchar_t* path, double scale);
+	void Build();
+	bool Load(const wchar_t* path);
+	bool LoadView(BYTE* data, unsigned long long size);
+	bool Save(const wchar_t* path);
+	bool Write(FILE* output);
+	void BuildMasks();
+
+	int GetWidth(int sprite) { return entries[sprite].rect.Width; }
+	int GetHeight(int sprite) { return entries[sprite].rect.Height; }
+	int GetSpriteCount() { return (int)entries.size(); }
+	Bitmap* GetImage() { return image; }
+	const UFRCollisionMask& GetMask(int sprite, bool mirrored) { return masks[sprite * 2 + (mirrored ? 1 : 0)]; }
+
+	void Draw(Graphics* canvas, int sprite, REAL x, REAL y);
+	void Draw(Graphics* canvas, int sprite, REAL x, REAL y, REAL width, REAL height);
+};
@@ -0,0 +1,178 @@
+/*
+File:		UFRSpriteManager.cpp
+Project:	Unhappy Flying Reptiles
+Author(s):	Jorge Ramirez
+Description:
+	This file contains the method definitions for the UFRSpriteManager class.
+*/
+
+#include "UFRSpriteManager.h"
+#include <stdio.h>
+
+#define BYTES_PER_PIXEL 4
+#define BYTES_PER_KILOBYTE 1024
+
+// Created before the game starts any threads
+UFRSpriteManager UFRSpriteManager::instance;
+
+
+/*
+Name:	UFRSpriteManager()
+Params: void
+Description:
+	Constructor for the UFRSpriteManager class. Use GetInstance to reach the manager.
+*/
+UFRSpriteManager::UFRSpriteManager()
+{
+	decodeCount = 0;
+	shareCount = 0;
+	reduceCount = 0;
+	reducedBytes = 0;
+}
+
+
+
+/*
+Name:	Acquire()
+Params: const wchar_t* path - The image file of the sprite.
+Return: std::shared_ptr<Bitmap> - A handle to the decoded sprite.
+Description:
+	This method returns a handle to a sprite, decoding the file only if no handle to it is still held.
+	The decode happens outside the lock so different files decode in parallel. If two threads decode the
+	same file at once, the first to finish is kept and the other copy is thrown away.
+*/
+std::shared_ptr<Bitmap> UFRSpriteManager::Acquire(const wchar_t* path)
+{
+	std::shared_ptr<Bitmap> sprite;
+
+	{
+		std::lock_guard<std::mutex> guard(lock);
+		sprite = sprites[path].lock();
+		if (sprite)
+		{
+			shareCount++;
+			return sprite;
+		}
+	}
+
+	std::shared_ptr<Bitmap> decoded(new Bitmap(path));
+
+	std::lock_guard<std::mutex> guard(lock);
+	std::weak_ptr<Bitmap>& cached = sprites[path];
+	sprite = cached.lock();
+	if (sprite)
+	{
+		shareCount++;
+		return sprite;
+	}
+
+	cached = decoded;
+	decodeCount++;
+
+	return decoded;
+}
+
+
+
+/*
+Name:	AcquireScaled()
+Params:
+	const wchar_t* path - The image file of the sprite.
+	double scale - The scale the sprite is drawn at.
+Return: std::shared_ptr<Bitmap> - A handle to the sprite reduced to the scale.
+Description:
+	This method returns a handle to a sprite already scaled to the size it is drawn at.
+	The full size decode is only held while the reduced copy is made, unless someone else holds it too.
+	Like Acquire, the work happens outside the lock.
+*/
+std::shared_ptr<Bitmap> UFRSpriteManager::AcquireScaled(const wchar_t* path, double scale)
+{
+	std::shared_ptr<Bitmap> sprite;
+	wchar_t key[MAX_PATH + 32];
+
+	if (scale == 1.0)
+	{
+		return Acquire(path);
+	}
+
+	// Reduced sprites are kept under their file name and scale
+	swprintf(key, TEXT("%s@%g"), path, scale);
+
+	{
+		std::lock_guard<std::mutex> guard(lock);
+		sprite = sprites[key].lock();
+		if (sprite)
+		{
+			shareCount++;
+			return sprite;
+		}
+	}
+
+	std::shared_ptr<Bitmap> decoded = Acquire(path);
+	int width = decoded->GetWidth();
+	int height = decoded->GetHeight();
+	std::shared_ptr<Bitmap> reduced(Scale(decoded.get(), (int)(width * scale), (int)(height * scale)));
+	decoded.reset();
+
+	std::lock_guard<std::mutex> guard(lock);
+	std::weak_ptr<Bitmap>& cached = sprites[key];
+	sprite = cached.lock();
+	if (sprite)
+	{
+		shareCount++;
+		return sprite;
+	}
+
+	cached = reduced;
+	reduceCount++;
+	reducedBytes += ((unsigned long long)width * height - (unsigned long long)reduced->GetWidth() * reduced->GetHeight()) * BYTES_PER_PIXEL;
+
+	return reduced;
+}
+
+
+
+/*
+Name:	Scale()
+Params:
+	Bitmap* source - The full size sprite.
+	int width - The width to scale to.
+	int height - The height to scale to.
+Return: Bitmap* - A new premultiplied ARGB copy of the sprite at the given size.
+Description:
+	This method scales a sprite down with bicubic filtering. The source is mirrored at its edges while filtering,
+	so the border of the sprite does not fade into transparency.
+*/
+Bitmap* UFRSpriteManager::Scale(Bitmap* source, int width, int height)
+{
+	Bitmap* scaled = new Bitmap(width, height, PixelFormat32bppPARGB);
+	Graphics* scaledCanvas = Graphics::FromImage(scaled);
+	ImageAttributes edgeAttributes;
+
+	scaledCanvas->SetCompositingMode(CompositingModeSourceCopy);
+	scaledCanvas->SetInterpolationMode(InterpolationModeHighQualityBicubic);
+	scaledCanvas->SetPixelOffsetMode(PixelOffsetModeHalf);
+	edgeAttributes.SetWrapMode(WrapModeTileFlipXY);
+
+	scaledCanvas->DrawImage(source, Rect(0, 0, width, height), 0, 0, source->GetWidth(), source->GetHeight(), UnitPixel, &edgeAttributes);
+	delete scaledCanvas;
+
+	return scaled;
+}
+
+
+
+/*
+Name:	Report()
+Params: void
+Return: void
+Description:
+	This method writes how many sprite requests were decoded, how many shared an earlier decode
+	and how much memory reducing sprites saved to the debug output.
+*/
+void UFRSpriteManager::Report()
+{
+	std::lock_guard<std::mutex> guard(lock);
+	TRACE(TEXT("Sprites: %u decoded, %u shared, %u reduced saving %u KB\n"), decodeCount, shareCount, reduceCount,
+		(unsigned int)(reducedBytes / BYTES_PER_KILOBYTE));
+}
@@ -0,0 +1,76 @@
+/*
+File:		UFRSpriteManager.h
+Project:	Unhappy Flying Reptiles
+Author(s):	Jorge Ramirez
+Description:
+	This file contains the class definition for the UFRSpriteManager class.
+*/
+
+#pragma once
+#include "afxwin.h"
+#include <gdiplus.h>
+#include <map>
+#include <string>
+#include <memory>
+#include <mutex>
+
+using namespace Gdiplus;
+
+
+/*
+Name: UFRSpriteRequest
+Description:
+	A sprite file and the scale it is drawn at, so it can be decoded and reduced before it is needed.
+*/
+struct UFRSpriteRequest
+{
+	std::wstring path;
+	double scale;
+
+	UFRSpriteRequest(const std::wstring& spritePath, double spriteScale)
+	{
+		path = spritePath;
+		scale = spriteScale;
+	}
+};
+
+
+/*
+Name: UFRSpriteManager
+Description:
+	This class is designed to decode every sprite file only once.
+	Sprites are handed out as shared handles. A file is decoded the first time it is asked for, every later
+	request gets a handle to the same pixels, and the pixels are freed when the last handle is released.
+	The manager only remembers released sprites weakly, so it never keeps pixels alive by itself.
+	A sprite can also be asked for at the scale it is drawn at. It is then reduced as soon as it is decoded
+	and only the reduced copy is kept, so the full size pixels are freed as soon as nothing else holds them.
+	There is one manager for the whole game, and it can be used from any thread.
+*/
+class UFRSpriteManager
+{
+private:
+	static UFRSpriteManager instance;
+
+	std::map<std::wstring, std::weak_ptr<Bitmap> > sprites;
+	std::mutex lock;
+
+	unsigned int decodeCount;
+	unsigned int shareCount; // Requests answered without decoding
+	unsigned int reduceCount;
+	unsigned long long reducedBytes; // Full size pixels replaced by reduced copies
+
+	UFRSpriteManager();
+	UFRSpriteManager(const UFRSpriteManager&);
+	UFRSpriteManager& operator=(const UFRSpriteManager&);
+
+public:
+	static UFRSpriteManager* GetInstance() { return &instance; }
+
+	std::shared_ptr<Bitmap> Acquire(const wchar_t* path);
+	std::shared_ptr<Bitmap> AcquireScaled(const wchar_t* path, double scale);
+	static Bitmap* Scale(Bitmap* source, int width, int height);
+
+	unsigned int GetDecodeCount() { return decodeCount; }
+	unsigned int GetShareCount() { return shareCount; }
+	void Report();
+};
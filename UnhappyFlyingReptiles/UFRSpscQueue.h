@@ -0,0 +1,68 @@
+/*
+File:		UFRSpscQueue.h
+Project:	Unhappy Flying Reptiles
+Author(s):	Jorge Ramirez
+Description:
+	This file contains the class definition for the UFRSpscQueue class template.
+*/
+
+#pragma once
+#include <atomic>
+
+#define SPSC_QUEUE_PADDING 64 // Bytes between the two indices so they sit on different cache lines
+
+
+/*
+Name: UFRSpscQueue
+Description:
+	This class template is designed to pass values of T from one producer thread to one consumer thread
+	without locks. It is a fixed ring of Capacity items, which must be a power of two, so nothing is allocated
+	after it is created. The producer only writes the tail and the consumer only writes the head, and each
+	publishes its index with release ordering after touching the item, so neither side ever waits on the other.
+	Pushing to a full queue fails instead of waiting.
+*/
+template <typename T, unsigned int Capacity>
+class UFRSpscQueue
+{
+private:
+	T items[Capacity];
+	std::atomic<unsigned int> head; // The next item to pop, written by the consumer
+	char padding[SPSC_QUEUE_PADDING];
+	std::atomic<unsigned int> tail; // The next item to push, written by the producer
+
+	UFRSpscQueue(const UFRSpscQueue&);
+	UFRSpscQueue& operator=(const UFRSpscQueue&);
+
+public:
+	UFRSpscQueue() : head(0), tail(0) {}
+
+	// Producer thread
+	bool Push(const T& item)
+	{
+		unsigned int position = tail.load(std::memory_order_relaxed);
+
+		if (position - head.load(std::memory_order_acquire) == Capacity)
+		{
+			return false;
+		}
+
+		items[position & (Capacity - 1)] = item;
+		tail.store(position + 1, std::memory_order_release);
+		return true;
+	}
+
+	// Consumer thread
+	bool Pop(T* item)
+	{
+		unsigned int position = head.load(std::memory_order_relaxed);
+
+		if (position == tail.load(std::memory_order_acquire))
+		{
+			return false;
+		}
+
+		*item = items[position & (Capacity - 1)];
+		head.store(position + 1, std::memory_order_release);
+		return true;
+	}
+};
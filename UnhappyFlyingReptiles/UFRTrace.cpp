@@ -0,0 +1,208 @@
+/*
+File:		UFRTrace.cpp
+Project:	Unhappy Flying Reptiles
+Author(s):	Jorge Ramirez
+Description:
+	This file contains the method definitions for the UFRTrace class.
+*/
+
+#include "UFRTrace.h"
+#include "UFRClock.h"
+#include "UFRWaveFile.h"
+#include <stdio.h>
+#include <mutex>
+#include <vector>
+
+#ifdef _WIN32
+#define TRACE_THREAD_LOCAL __declspec(thread)
+#else
+#define TRACE_THREAD_LOCAL __thread
+#endif
+
+#define TRACE_RING_MASK (TRACE_RING_CAPACITY - 1)
+#define TRACE_PROCESS_ID 1
+
+static TRACE_THREAD_LOCAL UFRTraceRing* threadRing = NULL; // The ring of the calling thread, or NULL before its first zone
+static std::mutex ringsLock; // Guards rings and the start of the trace
+static std::vector<UFRTraceRing*> rings; // Kept for the life of the process, so a thread's zones outlive it
+static long long startTicks; // The trace ticks and the clock time when the first ring was made,
+static long long startTime; // which Write measures the tick rate from
+
+
+/*
+Name:	Record()
+Params:
+	const char* name - The name of the zone, a string literal.
+	long long start - When the zone started, from Now.
+	long long end - When the zone ended, from Now.
+Return: void
+Description:
+	This method adds a zone to the ring of the calling thread, overwriting its oldest zone when the ring is full.
+	Only the first zone of a thread takes a lock, to create its ring.
+*/
+void UFRTrace::Record(const char* name, long long start, long long end)
+{
+	UFRTraceRing* ring = threadRing;
+	unsigned int index;
+
+	if (ring == NULL)
+	{
+		ring = CreateRing();
+	}
+
+	index = ring->written.load(std::memory_order_relaxed);
+	UFRTraceEvent& event = ring->events[index & TRACE_RING_MASK];
+	event.name = name;
+	event.start = start;
+	event.end = end;
+	ring->written.store(index + 1, std::memory_order_release);
+}
+
+
+
+/*
+Name:	NameThread()
+Params: const char* name - The name the calling thread is shown with, a string literal.
+Return: void
+Description:
+	This method names the calling thread in the trace. Threads that are not named are numbered.
+*/
+void UFRTrace::NameThread(const char* name)
+{
+	UFRTraceRing* ring = threadRing;
+
+	if (ring == NULL)
+	{
+		ring = CreateRing();
+	}
+	ring->name = name;
+}
+
+
+
+/*
+Name:	CreateRing()
+Params: void
+Return: UFRTraceRing* - The new ring of the calling thread.
+Description:
+	This method gives the calling thread its ring and adds it to the rings Write saves.
+	The first ring starts the trace.
+*/
+UFRTraceRing* UFRTrace::CreateRing()
+{
+	UFRTraceRing* ring = new UFRTraceRing();
+	UFRSystemClock clock;
+
+	ring->written.store(0);
+	ring->name = NULL;
+
+	{
+		std::lock_guard<std::mutex> guard(ringsLock);
+		if (rings.empty())
+		{
+			startTicks = Now();
+			startTime = clock.Now();
+		}
+		rings.push_back(ring);
+		ring->threadId = (int)rings.size();
+	}
+
+	threadRing = ring;
+	return ring;
+}
+
+
+
+/*
+Name:	Write()
+Params: const wchar_t* path - The JSON file to save the trace to.
+Return: bool - Whether the whole trace was written.
+Description:
+	This method saves the zones in every ring as Chrome trace events, in microseconds from the start of the trace.
+	The tick rate is measured against the system clock over the whole trace so far.
+	Each ring is copied before it is written out, and the zones its thread overwrote during the copy are dropped.
+*/
+bool UFRTrace::Write(const wchar_t* path)
+{
+	std::vector<UFRTraceRing*> threads;
+	std::vector<UFRTraceEvent> events;
+	UFRSystemClock clock;
+	FILE* traceFile;
+	long long traceTicks;
+	long long traceTime;
+	double ticksPerMicrosecond = 1;
+	unsigned int end;
+	unsigned int first;
+	unsigned int after;
+	unsigned int dropped;
+	bool firstEvent = true;
+	bool ok;
+
+	{
+		std::lock_guard<std::mutex> guard(ringsLock);
+		threads = rings;
+		traceTicks = Now() - startTicks;
+		traceTime = clock.Now() - startTime;
+	}
+	if (traceTime > 0 && traceTicks > 0)
+	{
+		ticksPerMicrosecond = (double)traceTicks / traceTime;
+	}
+
+	traceFile = UFRWaveFile::OpenFile(path, L"wb");
+	if (traceFile == NULL)
+	{
+		return false;
+	}
+
+	fprintf(traceFile, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[");
+	for (int thread = 0; thread < threads.size(); thread++)
+	{
+		UFRTraceRing* ring = threads[thread];
+
+		// Copy what the ring holds
+		end = ring->written.load(std::memory_order_acquire);
+		first = end > TRACE_RING_CAPACITY ? end - TRACE_RING_CAPACITY : 0;
+		events.clear();
+		for (unsigned int index = first; index != end; index++)
+		{
+			events.push_back(ring->events[index & TRACE_RING_MASK]);
+		}
+
+		// The zone being recorded now may already be half way over the oldest copied one
+		after = ring->written.load(std::memory_order_acquire);
+		dropped = after + 1 - first > TRACE_RING_CAPACITY ? after + 1 - first - TRACE_RING_CAPACITY : 0;
+		if (dropped > events.size())
+		{
+			dropped = (unsigned int)events.size();
+		}
+
+		fprintf(traceFile, "%s\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%d,\"tid\":%d,\"args\":{\"name\":\"",
+			firstEvent ? "" : ",", TRACE_PROCESS_ID, ring->threadId);
+		if (ring->name != NULL)
+		{
+			fprintf(traceFile, "%s\"}}", ring->name);
+		}
+		else
+		{
+			fprintf(traceFile, "Thread %d\"}}", ring->threadId);
+		}
+		firstEvent = false;
+
+		for (unsigned int event = dropped; event < events.size(); event++)
+		{
+			fprintf(traceFile, ",\n{\"name\":\"%s\",\"ph\":\"X\",\"pid\":%d,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f}",
+				events[event].name, TRACE_PROCESS_ID, ring->threadId,
+				(events[event].start - startTicks) / ticksPerMicrosecond, (events[event].end - events[event].start) / ticksPerMicrosecond);
+		}
+	}
+	fprintf(traceFile, "\n]}\n");
+
+	ok = !ferror(traceFile);
+	if (fclose(traceFile) != 0)
+	{
+		ok = false;
+	}
+
+	return ok;
+}
@@ -0,0 +1,108 @@
+/*
+File:		UFRTrace.h
+Project:	Unhappy Flying Reptiles
+Author(s):	Jorge Ramirez
+Description:
+	This file contains the class definitions for the UFRTrace and UFRTraceZone classes.
+*/
+
+#pragma once
+#include <atomic>
+
+#ifdef _WIN32
+#include <intrin.h>
+#elif defined(__i386__) || defined(__x86_64__)
+#include <x86intrin.h>
+#else
+#include <chrono>
+#endif
+
+#define TRACE_RING_CAPACITY 8192 // Zones each thread keeps, a power of two. The oldest are overwritten.
+
+
+/*
+Name: UFRTraceEvent
+Description:
+	One zone a thread went through, timed in trace ticks.
+*/
+struct UFRTraceEvent
+{
+	const char* name;
+	long long start;
+	long long end;
+};
+
+
+/*
+Name: UFRTraceRing
+Description:
+	The zones of one thread. Only that thread writes, so recording takes no lock.
+*/
+struct UFRTraceRing
+{
+	UFRTraceEvent events[TRACE_RING_CAPACITY];
+	std::atomic<unsigned int> written; // Every zone ever recorded. The ring holds the last TRACE_RING_CAPACITY.
+	const char* name;
+	int threadId;
+};
+
+
+/*
+Name: UFRTrace
+Description:
+	This class is designed to record where every thread of the game spends its time, cheaply enough to leave on.
+	Zones go into a ring per thread, created the first time the thread records one,
+	and are timed by the time stamp counter of the processor, which is read in a few nanoseconds.
+	Write converts them to microseconds and saves them as Chrome trace event JSON, for chrome://tracing or Perfetto.
+	Write may run while other threads record. Zones overwritten while it copies a ring are dropped.
+	Zone names must be string literals, only the pointer is kept.
+	Nothing here depends on MFC.
+*/
+class UFRTrace
+{
+private:
+	static UFRTraceRing* CreateRing();
+
+public:
+	static long long Now()
+	{
+#if defined(_WIN32) || defined(__i386__) || defined(__x86_64__)
+		return (long long)__rdtsc();
+#else
+		return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+	}
+
+	static void Record(const char* name, long long start, long long end);
+	static void NameThread(const char* name);
+	static bool Write(const wchar_t* path);
+};
+
+
+/*
+Name: UFRTraceZone
+Description:
+	This class is designed to record a zone from where it is made to the end of its scope.
+	Next ends the zone and starts another straight after it, to time the phases of a function one after another.
+*/
+class UFRTraceZone
+{
+private:
+	const char* name;
+	long long start;
+
+	UFRTraceZone(const UFRTraceZone&);
+	UFRTraceZone& operator=(const UFRTraceZone&);
+
+public:
+	UFRTraceZone(const char* zoneName) { name = zoneName; start = UFRTrace::Now(); }
+	~UFRTraceZone() { UFRTrace::Record(name, start, UFRTrace::Now()); }
+
+	void Next(const char* zoneName)
+	{
+		long long now = UFRTrace::Now();
+		UFRTrace::Record(name, start, now);
+		name = zoneName;
+		start = now;
+	}
+};
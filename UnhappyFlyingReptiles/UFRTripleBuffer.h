@@ -0,0 +1,59 @@
+/*
+File:		UFRTripleBuffer.h
+Project:	Unhappy Flying Reptiles
+Author(s):	Jorge Ramirez
+Description:
+	This file contains the class definition for the UFRTripleBuffer class template.
+*/
+
+#pragma once
+#include <atomic>
+
+#define TRIPLE_BUFFER_INDEX_MASK 3
+#define TRIPLE_BUFFER_NEW_DATA 4
+
+
+/*
+Name: UFRTripleBuffer
+Description:
+	This class template is designed to pass the latest value of T from one writer thread to one reader thread
+	without locks. The writer fills its own buffer and publishes it, which swaps it with the shared middle buffer.
+	The reader swaps the middle buffer for its own only when something new was published, so it always sees the
+	latest complete value and neither side ever waits on the other.
+	The buffer handed back to the writer holds an old value, so the writer must fill every field before publishing.
+*/
+template <typename T>
+class UFRTripleBuffer
+{
+private:
+	T buffers[3];
+	std::atomic<int> middleIndex; // The shared buffer index, with TRIPLE_BUFFER_NEW_DATA set if it is unread
+	int writeIndex;
+	int readIndex;
+
+	UFRTripleBuffer(const UFRTripleBuffer&);
+	UFRTripleBuffer& operator=(const UFRTripleBuffer&);
+
+public:
+	UFRTripleBuffer() : middleIndex(1), writeIndex(0), readIndex(2) {}
+
+	// Writer thread
+	T& GetWriteBuffer() { return buffers[writeIndex]; }
+	void Publish()
+	{
+		writeIndex = middleIndex.exchange(writeIndex | TRIPLE_BUFFER_NEW_DATA, std::memory_order_acq_rel) & TRIPLE_BUFFER_INDEX_MASK;
+	}
+
+	// Reader thread
+	bool Update()
+	{
+		if ((middleIndex.load(std::memory_order_relaxed) & TRIPLE_BUFFER_NEW_DATA) == 0)
+		{
+			return false;
+		}
+
+		readIndex = middleIndex.exchange(readIndex, std::memory_order_acq_rel) & TRIPLE_BUFFER_INDEX_MASK;
+		return true;
+	}
+	const T& GetReadBuffer() { return buffers[readIndex]; }
+};
@@ -0,0 +1,220 @@
+/*
+File:		UFRWaveFile.cpp
+Project:	Unhappy Flying Reptiles
+Author(s):	Jorge Ramirez
+Description:
+	This file contains the method definitions for the UFRWaveFile class.
+*/
+
+#include "UFRWaveFile.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define WAVE_FORMAT_INTEGER_PCM 1
+#define WAVE_FORMAT_FLOAT_PCM 3
+#define WAVE_FORMAT_EXTENSIBLE_TAG 0xFFFE
+
+
+/*
+Name:	UFRWaveFile()
+Params: void
+Description:
+	Constructor for the UFRWaveFile class. The sound starts empty.
+*/
+UFRWaveFile::UFRWaveFile()
+{
+	channels = 0;
+	sampleRate = 0;
+}
+
+
+
+/*
+Name:	Load()
+Params: const wchar_t* path - The WAV file to read.
+Return: bool - Whether the file was a WAV file in a format that is understood.
+Description:
+	This method reads the format and data chunks of a WAV file and converts the samples to floating point.
+	Any other chunks are skipped.
+*/
+bool UFRWaveFile::Load(const wchar_t* path)
+{
+	FILE* waveFile = OpenFile(path, L"rb");
+	std::vector<unsigned char> contents;
+	unsigned char* chunk;
+	unsigned char* end;
+	int formatTag = 0;
+	int bitsPerSample = 0;
+	const unsigned char* data = NULL;
+	unsigned int dataSize = 0;
+
+	if (waveFile == NULL)
+	{
+		return false;
+	}
+
+	fseek(waveFile, 0, SEEK_END);
+	contents.resize(ftell(waveFile));
+	fseek(waveFile, 0, SEEK_SET);
+	if (contents.size() < 12 || fread(&contents[0], 1, contents.size(), waveFile) != contents.size())
+	{
+		fclose(waveFile);
+		return false;
+	}
+	fclose(waveFile);
+
+	if (memcmp(&contents[0], "RIFF", 4) != 0 || memcmp(&contents[8], "WAVE", 4) != 0)
+	{
+		return false;
+	}
+
+	// Walk the chunks, which are padded to an even size
+	chunk = &contents[12];
+	end = &contents[0] + contents.size();
+	while (chunk + 8 <= end)
+	{
+		unsigned int chunkSize = chunk[4] | (chunk[5] << 8) | (chunk[6] << 16) | ((unsigned int)chunk[7] << 24);
+		unsigned char* chunkData = chunk + 8;
+
+		if (chunkSize > (unsigned int)(end - chunkData))
+		{
+			chunkSize = (unsigned int)(end - chunkData);
+		}
+
+		if (memcmp(chunk, "fmt ", 4) == 0 && chunkSize >= 16)
+		{
+			formatTag = chunkData[0] | (chunkData[1] << 8);
+			channels = chunkData[2] | (chunkData[3] << 8);
+			sampleRate = chunkData[4] | (chunkData[5] << 8) | (chunkData[6] << 16) | (chunkData[7] << 24);
+			bitsPerSample = chunkData[14] | (chunkData[15] << 8);
+
+			// The real format of an extensible file is the first two bytes of its sub format
+			if (formatTag == WAVE_FORMAT_EXTENSIBLE_TAG && chunkSize >= 26)
+			{
+				formatTag = chunkData[24] | (chunkData[25] << 8);
+			}
+		}
+		else if (memcmp(chunk, "data", 4) == 0)
+		{
+			data = chunkData;
+			dataSize = chunkSize;
+		}
+
+		chunk = chunkData + chunkSize + (chunkSize & 1);
+	}
+
+	if (data == NULL || dataSize == 0 || channels <= 0 || sampleRate <= 0)
+	{
+		return false;
+	}
+
+	if (formatTag == WAVE_FORMAT_INTEGER_PCM && bitsPerSample == 8)
+	{
+		samples.resize(dataSize);
+		for (unsigned int sample = 0; sample < samples.size(); sample++)
+		{
+			samples[sample] = (data[sample] - 128) / 128.0f;
+		}
+	}
+	else if (formatTag == WAVE_FORMAT_INTEGER_PCM && bitsPerSample == 16)
+	{
+		samples.resize(dataSize / 2);
+		for (unsigned int sample = 0; sample < samples.size(); sample++)
+		{
+			samples[sample] = (short)(data[sample * 2] | (data[sample * 2 + 1] << 8)) / 32768.0f;
+		}
+	}
+	else if (formatTag == WAVE_FORMAT_INTEGER_PCM && bitsPerSample == 24)
+	{
+		samples.resize(dataSize / 3);
+		for (unsigned int sample = 0; sample < samples.size(); sample++)
+		{
+			int value = (data[sample * 3] << 8) | (data[sample * 3 + 1] << 16) | (data[sample * 3 + 2] << 24);
+			samples[sample] = (value >> 8) / 8388608.0f;
+		}
+	}
+	else if (formatTag == WAVE_FORMAT_FLOAT_PCM && bitsPerSample == 32)
+	{
+		samples.resize(dataSize / 4);
+		memcpy(&samples[0], data, samples.size() * 4);
+	}
+	else
+	{
+		return false;
+	}
+
+	// Drop a trailing partial frame
+	samples.resize(samples.size() - samples.size() % channels);
+	return true;
+}
+
+
+
+/*
+Name:	Resample()
+Params: int newSampleRate - The sample rate to convert to.
+Return: void
+Description:
+	This method converts the sound to another sample rate by linear interpolation between neighbouring frames.
+*/
+void UFRWaveFile::Resample(int newSampleRate)
+{
+	int frameCount = GetFrameCount();
+	int newFrameCount;
+	std::vector<float> resampled;
+
+	if (newSampleRate == sampleRate || frameCount == 0)
+	{
+		sampleRate = newSampleRate;
+		return;
+	}
+
+	newFrameCount = (int)((long long)frameCount * newSampleRate / sampleRate);
+	resampled.resize(newFrameCount * channels);
+
+	for (int frame = 0; frame < newFrameCount; frame++)
+	{
+		double position = (double)frame * sampleRate / newSampleRate;
+		int first = (int)position;
+		int second = first + 1 < frameCount ? first + 1 : first;
+		float weight = (float)(position - first);
+
+		for (int channel = 0; channel < channels; channel++)
+		{
+			float firstSample = samples[first * channels + channel];
+			float secondSample = samples[second * channels + channel];
+			resampled[frame * channels + channel] = firstSample + (secondSample - firstSample) * weight;
+		}
+	}
+
+	samples.swap(resampled);
+	sampleRate = newSampleRate;
+}
+
+
+
+/*
+Name:	OpenFile()
+Params:
+	const wchar_t* path - The file to open.
+	const wchar_t* mode - The mode as for fopen.
+Return: FILE* - The open file, or NULL if it could not be opened.
+Description:
+	This method opens a file by a wide path on Windows, and by the same path in the locale encoding elsewhere.
+*/
+FILE* UFRWaveFile::OpenFile(const wchar_t* path, const wchar_t* mode)
+{
+#ifdef _WIN32
+	return _wfopen(path, mode);
+#else
+	char narrowPath[1024];
+	char narrowMode[8];
+
+	if (wcstombs(narrowPath, path, sizeof(narrowPath)) == (size_t)-1 || wcstombs(narrowMode, mode, sizeof(narrowMode)) == (size_t)-1)
+	{
+		return NULL;
+	}
+	return fopen(narrowPath, narrowMode);
+#endif
+}
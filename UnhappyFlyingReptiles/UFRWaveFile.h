@@ -0,0 +1,40 @@
+/*
+File:		UFRWaveFile.h
+Project:	Unhappy Flying Reptiles
+Author(s):	Jorge Ramirez
+Description:
+	This file contains the class definition for the UFRWaveFile class.
+*/
+
+#pragma once
+#include <stdio.h>
+#include <vector>
+
+
+/*
+Name: UFRWaveFile
+Description:
+	This class is designed to read a WAV file into floating point samples and resample it to another rate.
+	8, 16 and 24 bit integer PCM and 32 bit float PCM are understood. Samples are kept interleaved, from -1 to 1.
+	Nothing here depends on MFC.
+*/
+class UFRWaveFile
+{
+private:
+	int channels;
+	int sampleRate;
+	std::vector<float> samples;
+
+public:
+	UFRWaveFile();
+
+	bool Load(const wchar_t* path);
+	void Resample(int newSampleRate);
+
+	int GetChannels() { return channels; }
+	int GetSampleRate() { return sampleRate; }
+	int GetFrameCount() { return channels > 0 ? (int)samples.size() / channels : 0; }
+	const std::vector<float>& GetSamples() { return samples; }
+
+	static FILE* OpenFile(const wchar_t* path, const wchar_t* mode);
+};
@@ -0,0 +1,167 @@
+/*
+File:		UFRWaveFileOutput.cpp
+Project:	Unhappy Flying Reptiles
+Author(s):	Jorge Ramirez
+Description:
+	This file contains the method definitions for the UFRWaveFileOutput class.
+*/
+
+#include "UFRWaveFileOutput.h"
+#include "UFRWaveFile.h"
+#include <string.h>
+
+#define WAVE_FORMAT_FLOAT_PCM 3
+#define WAVE_HEADER_SIZE 44
+#define WAVE_BITS_PER_SAMPLE 32
+
+
+/*
+Name:	UFRWaveFileOutput()
+Params: const wchar_t* filePath - The WAV file to write. It is created when the mixer opens the output.
+Description:
+	Constructor for the UFRWaveFileOutput class.
+*/
+UFRWaveFileOutput::UFRWaveFileOutput(const wchar_t* filePath)
+{
+	path = filePath;
+	waveFile = NULL;
+	framesWritten = 0;
+	channels = 0;
+	failed = false;
+}
+
+
+
+/*
+Name:	~UFRWaveFileOutput()
+Params: void
+Description:
+	Destructor for the UFRWaveFileOutput class. The file is finished if it is still open.
+*/
+UFRWaveFileOutput::~UFRWaveFileOutput()
+{
+	Close();
+}
+
+
+
+/*
+Name:	Open()
+Params:
+	int sampleRate - The rate of the samples that will be written.
+	int channelCount - The number of interleaved channels.
+Return: bool - Whether the file was created.
+Description:
+	This method creates the file and writes a header with the sizes left empty.
+*/
+bool UFRWaveFileOutput::Open(int sampleRate, int channelCount)
+{
+	Close();
+
+	channels = channelCount;
+	framesWritten = 0;
+	waveFile = UFRWaveFile::OpenFile(path.c_str(), L"wb");
+	failed = waveFile == NULL || !WriteHeader(sampleRate);
+
+	return !failed;
+}
+
+
+
+/*
+Name:	Write()
+Params:
+	const float* samples - Interleaved samples.
+	int frameCount - The number of frames, each with a sample for every channel.
+Return: bool - Whether the samples were written.
+Description:
+	This method appends samples to the file.
+*/
+bool UFRWaveFileOutput::Write(const float* samples, int frameCount)
+{
+	if (waveFile == NULL || failed)
+	{
+		return false;
+	}
+
+	if (fwrite(samples, sizeof(float) * channels, frameCount, waveFile) != (size_t)frameCount)
+	{
+		failed = true;
+		return false;
+	}
+
+	framesWritten += frameCount;
+	return true;
+}
+
+
+
+/*
+Name:	Close()
+Params: void
+Return: void
+Description:
+	This method fills in the sizes in the header and closes the file.
+*/
+void UFRWaveFileOutput::Close()
+{
+	unsigned int dataSize;
+	unsigned int riffSize;
+
+	if (waveFile == NULL)
+	{
+		return;
+	}
+
+	dataSize = (unsigned int)(framesWritten * sizeof(float) * channels);
+	riffSize = dataSize + WAVE_HEADER_SIZE - 8;
+
+	if (fseek(waveFile, 4, SEEK_SET) != 0 || fwrite(&riffSize, 4, 1, waveFile) != 1 ||
+		fseek(waveFile, WAVE_HEADER_SIZE - 4, SEEK_SET) != 0 || fwrite(&dataSize, 4, 1, waveFile) != 1)
+	{
+		failed = true;
+	}
+
+	if (fclose(waveFile) != 0)
+	{
+		failed = true;
+	}
+	waveFile = NULL;
+}
+
+
+
+/*
+Name:	WriteHeader()
+Params: int sampleRate - The rate of the samples that will be written.
+Return: bool - Whether the header was written.
+Description:
+	This method writes the RIFF header, the format chunk and the start of the data chunk.
+	Every field is little endian, as on every machine the game runs on.
+*/
+bool UFRWaveFileOutput::WriteHeader(int sampleRate)
+{
+	unsigned char header[WAVE_HEADER_SIZE];
+	unsigned short formatTag = WAVE_FORMAT_FLOAT_PCM;
+	unsigned short channelCount = (unsigned short)channels;
+	unsigned int bytesPerSecond = sampleRate * channels * sizeof(float);
+	unsigned short blockAlign = (unsigned short)(channels * sizeof(float));
+	unsigned short bitsPerSample = WAVE_BITS_PER_SAMPLE;
+	unsigned int formatSize = 16;
+	unsigned int emptySize = 0;
+
+	memcpy(header, "RIFF", 4);
+	memcpy(header + 4, &emptySize, 4);
+	memcpy(header + 8, "WAVEfmt ", 8);
+	memcpy(header + 16, &formatSize, 4);
+	memcpy(header + 20, &formatTag, 2);
+	memcpy(header + 22, &channelCount, 2);
+	memcpy(header + 24, &sampleRate, 4);
+	memcpy(header + 28, &bytesPerSecond, 4);
+	memcpy(header + 32, &blockAlign, 2);
+	memcpy(header + 34, &bitsPerSample, 2);
+	memcpy(header + 36, "data", 4);
+	memcpy(header + 40, &emptySize, 4);
+
+	return fwrite(header, sizeof(header), 1, waveFile) == 1;
+}
@@ -0,0 +1,48 @@
+/*
+File:		UFRWaveFileOutput.h
+Project:	Unhappy Flying Reptiles
+Author(s):	Jorge Ramirez
+Description:
+	This file contains the class definition for the UFRWaveFileOutput class.
+*/
+
+#pragma once
+#include <stdio.h>
+#include <string>
+#include "UFRAudioOutput.h"
+
+
+/*
+Name: UFRWaveFileOutput
+Inherit: public UFRAudioOutput
+Description:
+	This class is designed to write the mixed sound to a 32 bit float WAV file, so the sound of a headless
+	capture can be kept next to its frames. The sizes in the header are filled in when the file is closed.
+	Nothing here depends on MFC.
+*/
+class UFRWaveFileOutput : public UFRAudioOutput
+{
+private:
+	std::wstring path;
+	FILE* waveFile;
+	unsigned long long framesWritten;
+	int channels;
+	bool failed;
+
+	bool WriteHeader(int sampleRate);
+
+	UFRWaveFileOutput(const UFRWaveFileOutput&);
+	UFRWaveFileOutput& operator=(const UFRWaveFileOutput&);
+
+public:
+	UFRWaveFileOutput(const wchar_t* filePath);
+	~UFRWaveFileOutput();
+
+	bool Open(int sampleRate, int channelCount);
+	bool Write(const float* samples, int frameCount);
+	void Close();
+	bool IsRealTime() { return false; }
+
+	bool HasFailed() { return failed; }
+	unsigned long long GetFramesWritten() { return framesWritten; }
+};
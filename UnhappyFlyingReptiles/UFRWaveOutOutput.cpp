@@ -0,0 +1,184 @@
+/*
+File:		UFRWaveOutOutput.cpp
+Project:	Unhappy Flying Reptiles
+Author(s):	Jorge Ramirez
+Description:
+	This file contains the method definitions for the UFRWaveOutOutput class.
+*/
+
+#include "UFRWaveOutOutput.h"
+
+#pragma comment(lib, "winmm.lib")
+
+#define BITS_PER_SAMPLE 16
+#define SAMPLE_SCALE 32767.0f
+
+
+/*
+Name:	UFRWaveOutOutput()
+Params: void
+Description:
+	Constructor for the UFRWaveOutOutput class. The device is opened by Open.
+*/
+UFRWaveOutOutput::UFRWaveOutOutput()
+{
+	device = NULL;
+	bufferDone = NULL;
+	currentBuffer = 0;
+	currentFrames = 0;
+	channels = 0;
+}
+
+
+
+/*
+Name:	~UFRWaveOutOutput()
+Params: void
+Description:
+	Destructor for the UFRWaveOutOutput class. The device is closed if it is still open.
+*/
+UFRWaveOutOutput::~UFRWaveOutOutput()
+{
+	Close();
+}
+
+
+
+/*
+Name:	Open()
+Params:
+	int sampleRate - The rate of the samples that will be written.
+	int channelCount - The number of interleaved channels.
+Return: bool - Whether the device was opened.
+Description:
+	This method opens the default sound device and prepares the ring of buffers.
+*/
+bool UFRWaveOutOutput::Open(int sampleRate, int channelCount)
+{
+	WAVEFORMATEX format;
+
+	Close();
+
+	channels = channelCount;
+	format.wFormatTag = WAVE_FORMAT_PCM;
+	format.nChannels = (WORD)channels;
+	format.nSamplesPerSec = sampleRate;
+	format.wBitsPerSample = BITS_PER_SAMPLE;
+	format.nBlockAlign = (WORD)(channels * sizeof(short));
+	format.nAvgBytesPerSec = sampleRate * format.nBlockAlign;
+	format.cbSize = 0;
+
+	bufferDone = CreateEvent(NULL, FALSE, FALSE, NULL);
+	if (waveOutOpen(&device, WAVE_MAPPER, &format, (DWORD_PTR)bufferDone, 0, CALLBACK_EVENT) != MMSYSERR_NOERROR)
+	{
+		TRACE(TEXT("Sound: no output device\n"));
+		device = NULL;
+		Close();
+		return false;
+	}
+
+	for (int buffer = 0; buffer < WAVEOUT_BUFFER_COUNT; buffer++)
+	{
+		buffers[buffer].resize(WAVEOUT_BUFFER_FRAMES * channels);
+		memset(&headers[buffer], 0, sizeof(WAVEHDR));
+		headers[buffer].lpData = (LPSTR)&buffers[buffer][0];
+		headers[buffer].dwBufferLength = (DWORD)(buffers[buffer].size() * sizeof(short));
+		waveOutPrepareHeader(device, &headers[buffer], sizeof(WAVEHDR));
+
+		// Every buffer starts out free
+		headers[buffer].dwFlags |= WHDR_DONE;
+	}
+	currentBuffer = 0;
+	currentFrames = 0;
+
+	return true;
+}
+
+
+
+/*
+Name:	Write()
+Params:
+	const float* samples - Interleaved samples from -1 to 1.
+	int frameCount - The number of frames, each with a sample for every channel.
+Return: bool - Whether the samples were queued.
+Description:
+	This method converts samples into the current buffer and queues the buffer on the device once it is full.
+	Before filling a buffer it waits for the device to finish playing it.
+*/
+bool UFRWaveOutOutput::Write(const float* samples, int frameCount)
+{
+	if (device == NULL)
+	{
+		return false;
+	}
+
+	while (frameCount > 0)
+	{
+		WAVEHDR* header = &headers[currentBuffer];
+		int framesToCopy = WAVEOUT_BUFFER_FRAMES - currentFrames;
+
+		// The device sets the done flag from its own thread
+		while ((((volatile WAVEHDR*)header)->dwFlags & WHDR_DONE) == 0)
+		{
+			WaitForSingleObject(bufferDone, INFINITE);
+		}
+
+		if (framesToCopy > frameCount)
+		{
+			framesToCopy = frameCount;
+		}
+
+		short* out = &buffers[currentBuffer][currentFrames * channels];
+		for (int sample = 0; sample < framesToCopy * channels; sample++)
+		{
+			out[sample] = (short)(samples[sample] * SAMPLE_SCALE);
+		}
+
+		samples += framesToCopy * channels;
+		frameCount -= framesToCopy;
+		currentFrames += framesToCopy;
+
+		if (currentFrames == WAVEOUT_BUFFER_FRAMES)
+		{
+			header->dwFlags &= ~WHDR_DONE;
+			if (waveOutWrite(device, header, sizeof(WAVEHDR)) != MMSYSERR_NOERROR)
+			{
+				return false;
+			}
+			currentBuffer = (currentBuffer + 1) % WAVEOUT_BUFFER_COUNT;
+			currentFrames = 0;
+		}
+	}
+
+	return true;
+}
+
+
+
+/*
+Name:	Close()
+Params: void
+Return: void
+Description:
+	This method stops the device, returns every buffer and closes it.
+*/
+void UFRWaveOutOutput::Close()
+{
+	if (device != NULL)
+	{
+		waveOutReset(device);
+		for (int buffer = 0; buffer < WAVEOUT_BUFFER_COUNT; buffer++)
+		{
+			waveOutUnprepareHeader(device, &headers[buffer], sizeof(WAVEHDR));
+		}
+		waveOutClose(device);
+		device = NULL;
+	}
+
+	if (bufferDone != NULL)
+	{
+		CloseHandle(bufferDone);
+		bufferDone = NULL;
+	}
+}
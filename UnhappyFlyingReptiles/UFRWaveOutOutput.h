@@ -0,0 +1,49 @@
+/*
+File:		UFRWaveOutOutput.h
+Project:	Unhappy Flying Reptiles
+Author(s):	Jorge Ramirez
+Description:
+	This file contains the class definition for the UFRWaveOutOutput class.
+*/
+
+#pragma once
+#include "afxwin.h"
+#include <mmsystem.h>
+#include <vector>
+#include "UFRAudioOutput.h"
+
+#define WAVEOUT_BUFFER_COUNT 4
+#define WAVEOUT_BUFFER_FRAMES 1024 // About 21 ms at the mixer rate, so about 85 ms are queued in all
+
+
+/*
+Name: UFRWaveOutOutput
+Inherit: public UFRAudioOutput
+Description:
+	This class is designed to play the mixed sound on the default sound device through waveOut.
+	Blocks are converted to 16 bit samples and gathered into a ring of buffers that are queued on the device in turn.
+	Write waits for the device to finish with the next buffer, so it paces the mixer thread to the device.
+*/
+class UFRWaveOutOutput : public UFRAudioOutput
+{
+private:
+	HWAVEOUT device;
+	HANDLE bufferDone; // Signalled by the device whenever it finishes a buffer
+	WAVEHDR headers[WAVEOUT_BUFFER_COUNT];
+	std::vector<short> buffers[WAVEOUT_BUFFER_COUNT];
+	int currentBuffer;
+	int currentFrames; // The frames already in the current buffer
+	int channels;
+
+	UFRWaveOutOutput(const UFRWaveOutOutput&);
+	UFRWaveOutOutput& operator=(const UFRWaveOutOutput&);
+
+public:
+	UFRWaveOutOutput();
+	~UFRWaveOutOutput();
+
+	bool Open(int sampleRate, int channelCount);
+	bool Write(const float* samples, int frameCount);
+	void Close();
+	bool IsRealTime() { return true; }
+};
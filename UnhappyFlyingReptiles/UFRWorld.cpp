@@ -0,0 +1,486 @@
+/*
+File:		UFRWorld.cpp
+Project:	Unhappy Flying Reptiles
+Author(s):	Jorge Ramirez
+Description:
+	This file contains the method definitions for the UFRArchetype and UFRWorld classes.
+*/
+
+#include "UFRWorld.h"
+#include <string.h>
+
+
+/*
+Name:	AddRow()
+Params: int entity - The entity the row belongs to.
+Return: int - The new row.
+Description:
+	This method adds a row at the end of every table the archetype uses, with every component zeroed.
+*/
+int UFRArchetype::AddRow(int entity)
+{
+	UFRTransform transform;
+	UFRVelocity velocity;
+	UFRBody body;
+	UFRFriction friction;
+	UFRSprite sprite;
+	UFRFlightAI flight;
+	UFRFallSpin spin;
+
+	memset(&transform, 0, sizeof(transform));
+	memset(&velocity, 0, sizeof(velocity));
+	memset(&body, 0, sizeof(body));
+	memset(&friction, 0, sizeof(friction));
+	memset(&sprite, 0, sizeof(sprite));
+	memset(&flight, 0, sizeof(flight));
+	memset(&spin, 0, sizeof(spin));
+
+	entities.push_back(entity);
+	if (components & COMPONENT_TRANSFORM)
+	{
+		transforms.push_back(transform);
+	}
+	if (components & COMPONENT_VELOCITY)
+	{
+		velocities.push_back(velocity);
+	}
+	if (components & COMPONENT_BODY)
+	{
+		bodies.push_back(body);
+	}
+	if (components & COMPONENT_FRICTION)
+	{
+		frictions.push_back(friction);
+	}
+	if (components & COMPONENT_SPRITE)
+	{
+		sprites.push_back(sprite);
+	}
+	if (components & COMPONENT_FLIGHT_AI)
+	{
+		flights.push_back(flight);
+	}
+	if (components & COMPONENT_FALL_SPIN)
+	{
+		spins.push_back(spin);
+	}
+
+	return (int)entities.size() - 1;
+}
+
+
+
+/*
+Name:	AddRows()
+Params:
+	int firstEntity - The entity the first row belongs to. The rest belong to the entities numbered after it.
+	int count - The number of rows to add.
+Return: int - The first new row.
+Description:
+	This method adds rows at the end of every table the archetype uses, with every component zeroed.
+	Each table grows once, however many rows are added.
+*/
+int UFRArchetype::AddRows(int firstEntity, int count)
+{
+	UFRTransform transform;
+	UFRVelocity velocity;
+	UFRBody body;
+	UFRFriction friction;
+	UFRSprite sprite;
+	UFRFlightAI flight;
+	UFRFallSpin spin;
+	int firstRow = (int)entities.size();
+	int size = firstRow + count;
+
+	memset(&transform, 0, sizeof(transform));
+	memset(&velocity, 0, sizeof(velocity));
+	memset(&body, 0, sizeof(body));
+	memset(&friction, 0, sizeof(friction));
+	memset(&sprite, 0, sizeof(sprite));
+	memset(&flight, 0, sizeof(flight));
+	memset(&spin, 0, sizeof(spin));
+
+	entities.resize(size);
+	for (int row = firstRow; row < size; row++)
+	{
+		entities[row] = firstEntity + row - firstRow;
+	}
+	if (components & COMPONENT_TRANSFORM)
+	{
+		transforms.resize(size, transform);
+	}
+	if (components & COMPONENT_VELOCITY)
+	{
+		velocities.resize(size, velocity);
+	}
+	if (components & COMPONENT_BODY)
+	{
+		bodies.resize(size, body);
+	}
+	if (components & COMPONENT_FRICTION)
+	{
+		frictions.resize(size, friction);
+	}
+	if (components & COMPONENT_SPRITE)
+	{
+		sprites.resize(size, sprite);
+	}
+	if (components & COMPONENT_FLIGHT_AI)
+	{
+		flights.resize(size, flight);
+	}
+	if (components & COMPONENT_FALL_SPIN)
+	{
+		spins.resize(size, spin);
+	}
+
+	return firstRow;
+}
+
+
+
+/*
+Name:	Reserve()
+Params: int rows - The number of rows every table the archetype uses should have room for.
+Return: void
+Description:
+	This method makes room in the tables up front, so adding rows up to that number does not allocate.
+*/
+void UFRArchetype::Reserve(int rows)
+{
+	entities.reserve(rows);
+	if (components & COMPONENT_TRANSFORM)
+	{
+		transforms.reserve(rows);
+	}
+	if (components & COMPONENT_VELOCITY)
+	{
+		velocities.reserve(rows);
+	}
+	if (components & COMPONENT_BODY)
+	{
+		bodies.reserve(rows);
+	}
+	if (components & COMPONENT_FRICTION)
+	{
+		frictions.reserve(rows);
+	}
+	if (components & COMPONENT_SPRITE)
+	{
+		sprites.reserve(rows);
+	}
+	if (components & COMPONENT_FLIGHT_AI)
+	{
+		flights.reserve(rows);
+	}
+	if (components & COMPONENT_FALL_SPIN)
+	{
+		spins.reserve(rows);
+	}
+}
+
+
+
+/*
+Name:	CopyRow()
+Params:
+	int row - The row to copy.
+	UFRArchetype* destination - The archetype to copy the row to.
+	int destinationRow - The row to copy it over.
+Return: void
+Description:
+	This method copies the components that both archetypes have from a row of this archetype to a row of another.
+*/
+void UFRArchetype::CopyRow(int row, UFRArchetype* destination, int destinationRow)
+{
+	unsigned int shared = components & destination->components;
+
+	if (shared & COMPONENT_TRANSFORM)
+	{
+		destination->transforms[destinationRow] = transforms[row];
+	}
+	if (shared & COMPONENT_VELOCITY)
+	{
+		destination->velocities[destinationRow] = velocities[row];
+	}
+	if (shared & COMPONENT_BODY)
+	{
+		destination->bodies[destinationRow] = bodies[row];
+	}
+	if (shared & COMPONENT_FRICTION)
+	{
+		destination->frictions[destinationRow] = frictions[row];
+	}
+	if (shared & COMPONENT_SPRITE)
+	{
+		destination->sprites[destinationRow] = sprites[row];
+	}
+	if (shared & COMPONENT_FLIGHT_AI)
+	{
+		destination->flights[destinationRow] = flights[row];
+	}
+	if (shared & COMPONENT_FALL_SPIN)
+	{
+		destination->spins[destinationRow] = spins[row];
+	}
+}
+
+
+
+/*
+Name:	RemoveRow()
+Params: int row - The row to remove.
+Return: int - The entity whose row was moved into the removed one, or -1 if it was the last row.
+Description:
+	This method removes a row by moving the last row over it, so the tables stay packed.
+*/
+int UFRArchetype::RemoveRow(int row)
+{
+	int last = (int)entities.size() - 1;
+	int moved = -1;
+
+	if (row != last)
+	{
+		CopyRow(last, this, row);
+		entities[row] = entities[last];
+		moved = entities[row];
+	}
+
+	entities.pop_back();
+	if (components & COMPONENT_TRANSFORM)
+	{
+		transforms.pop_back();
+	}
+	if (components & COMPONENT_VELOCITY)
+	{
+		velocities.pop_back();
+	}
+	if (components & COMPONENT_BODY)
+	{
+		bodies.pop_back();
+	}
+	if (components & COMPONENT_FRICTION)
+	{
+		frictions.pop_back();
+	}
+	if (components & COMPONENT_SPRITE)
+	{
+		sprites.pop_back();
+	}
+	if (components & COMPONENT_FLIGHT_AI)
+	{
+		flights.pop_back();
+	}
+	if (components & COMPONENT_FALL_SPIN)
+	{
+		spins.pop_back();
+	}
+
+	return moved;
+}
+
+
+
+/*
+Name:	UFRWorld()
+Params: void
+Description:
+	Constructor for the UFRWorld class. The world starts with no entities.
+*/
+UFRWorld::UFRWorld()
+{
+}
+
+
+
+/*
+Name:	~UFRWorld()
+Params: void
+Description:
+	Destructor for the UFRWorld class. Every archetype table is freed.
+*/
+UFRWorld::~UFRWorld()
+{
+	for (int archetype = 0; archetype < archetypes.size(); archetype++)
+	{
+		delete archetypes[archetype];
+	}
+}
+
+
+
+/*
+Name:	FindArchetype()
+Params: unsigned int components - The COMPONENT_ bits of the archetype.
+Return: int - The number of the archetype.
+Description:
+	This method finds the archetype with exactly the given components, creating it the first time it is needed.
+	There are only ever a handful of archetypes, so they are searched in order.
+*/
+int UFRWorld::FindArchetype(unsigned int components)
+{
+	for (int archetype = 0; archetype < archetypes.size(); archetype++)
+	{
+		if (archetypes[archetype]->components == components)
+		{
+			return archetype;
+		}
+	}
+
+	archetypes.push_back(new UFRArchetype(components));
+	return (int)archetypes.size() - 1;
+}
+
+
+
+/*
+Name:	CreateEntity()
+Params: unsigned int components - The COMPONENT_ bits the entity starts with.
+Return: int - The new entity.
+Description:
+	This method adds an entity with zeroed components. Entities are numbered from 0 in the order they are created.
+*/
+int UFRWorld::CreateEntity(unsigned int components)
+{
+	Location location;
+	int entity = (int)locations.size();
+
+	location.archetype = FindArchetype(components);
+	location.row = archetypes[location.archetype]->AddRow(entity);
+	locations.push_back(location);
+
+	return entity;
+}
+
+
+
+/*
+Name:	CreateEntities()
+Params:
+	unsigned int components - The COMPONENT_ bits the entities start with.
+	int count - The number of entities to add.
+Return: int - The first new entity. The rest are numbered after it.
+Description:
+	This method adds many entities with the same zeroed components at once.
+	They take consecutive rows of one table, from GetRow of the first entity on, so they can be filled in one pass.
+*/
+int UFRWorld::CreateEntities(unsigned int components, int count)
+{
+	Location location;
+	int entity = (int)locations.size();
+	int firstRow;
+
+	location.archetype = FindArchetype(components);
+	firstRow = archetypes[location.archetype]->AddRows(entity, count);
+	locations.reserve(entity + count);
+	for (int added = 0; added < count; added++)
+	{
+		location.row = firstRow + added;
+		locations.push_back(location);
+	}
+
+	return entity;
+}
+
+
+
+/*
+Name:	Reserve()
+Params:
+	unsigned int components - The COMPONENT_ bits of an archetype.
+	int count - The number of entities the archetype should have room for.
+Return: void
+Description:
+	This method creates an archetype before any entity needs it and makes room in its tables,
+	so entities can be moved into it during play without allocating.
+*/
+void UFRWorld::Reserve(unsigned int components, int count)
+{
+	archetypes[FindArchetype(components)]->Reserve(count);
+}
+
+
+
+/*
+Name:	MoveEntity()
+Params:
+	int entity - The entity to move.
+	unsigned int components - The COMPONENT_ bits the entity has from now on.
+Return: void
+Description:
+	This method moves an entity to the table of the archetype with the given components.
+	Components both archetypes have keep their values, new ones start zeroed.
+	References returned by the Get methods are no longer valid afterwards.
+*/
+void UFRWorld::MoveEntity(int entity, unsigned int components)
+{
+	Location from = locations[entity];
+	Location to;
+	int moved;
+
+	if (archetypes[from.archetype]->components == components)
+	{
+		return;
+	}
+
+	to.archetype = FindArchetype(components);
+	to.row = archetypes[to.archetype]->AddRow(entity);
+	archetypes[from.archetype]->CopyRow(from.row, archetypes[to.archetype], to.row);
+	locations[entity] = to;
+
+	// The last row of the old table fills the gap
+	moved = archetypes[from.archetype]->RemoveRow(from.row);
+	if (moved != -1)
+	{
+		locations[moved].row = from.row;
+	}
+}
+
+
+
+/*
+Name:	AddComponents()
+Params:
+	int entity - The entity to add to.
+	unsigned int components - The COMPONENT_ bits to add. Components the entity already has keep their values.
+Return: void
+Description:
+	This method gives an entity more components, moving it to the table of its new archetype.
+*/
+void UFRWorld::AddComponents(int entity, unsigned int components)
+{
+	MoveEntity(entity, archetypes[locations[entity].archetype]->components | components);
+}
+
+
+
+/*
+Name:	RemoveComponents()
+Params:
+	int entity - The entity to remove from.
+	unsigned int components - The COMPONENT_ bits to remove.
+Return: void
+Description:
+	This method takes components away from an entity, moving it to the table of its new archetype.
+*/
+void UFRWorld::RemoveComponents(int entity, unsigned int components)
+{
+	MoveEntity(entity, archetypes[locations[entity].archetype]->components & ~components);
+}
+
+
+
+/*
+Name:	HasComponents()
+Params:
+	int entity - The entity to check.
+	unsigned int components - The COMPONENT_ bits to check for.
+Return: bool - Whether the entity has every one of the components.
+Description:
+	This method checks what an entity is made of.
+*/
+bool UFRWorld::HasComponents(int entity, unsigned int components)
+{
+	return (archetypes[locations[entity].archetype]->components & components) == components;
+}
+
@@ -0,0 +1,99 @@
+/*
+File:		UFRWorld.h
+Project:	Unhappy Flying Reptiles
+Author(s):	Jorge Ramirez
+Description:
+	This file contains the class definitions for the UFRArchetype and UFRWorld classes.
+*/
+
+#pragma once
+#include <vector>
+#include "UFRComponents.h"
+
+
+/*
+Name: UFRArchetype
+Description:
+	This class is designed to hold every entity with one set of components, as packed tables.
+	Row i of each table belongs to entities[i], and only the tables for the components of the archetype are used.
+	Systems walk the tables from start to end, so the data they touch is read in order.
+*/
+class UFRArchetype
+{
+public:
+	unsigned int components;
+	std::vector<int> entities;
+	std::vector<UFRTransform> transforms;
+	std::vector<UFRVelocity> velocities;
+	std::vector<UFRBody> bodies;
+	std::vector<UFRFriction> frictions;
+	std::vector<UFRSprite> sprites;
+	std::vector<UFRFlightAI> flights;
+	std::vector<UFRFallSpin> spins;
+
+	UFRArchetype(unsigned int archetypeComponents) { components = archetypeComponents; }
+
+	int GetSize() { return (int)entities.size(); }
+	bool Matches(unsigned int with, unsigned int without) { return (components & with) == with && (components & without) == 0; }
+
+	int AddRow(int entity);
+	int AddRows(int firstEntity, int count);
+	void Reserve(int rows);
+	void CopyRow(int row, UFRArchetype* destination, int destinationRow);
+	int RemoveRow(int row);
+};
+
+
+/*
+Name: UFRWorld
+Description:
+	This class is designed to keep every entity of the game in archetype tables.
+	Entities are numbered in the order they are created, which is also the order they are drawn in.
+	Adding or removing components moves an entity to the table of its new archetype,
+	so a system never has to check what an entity has, only which archetypes match it.
+*/
+class UFRWorld
+{
+private:
+	struct Location
+	{
+		int archetype;
+		int row;
+	};
+
+	std::vector<UFRArchetype*> archetypes;
+	std::vector<Location> locations; // Where each entity is
+
+	int FindArchetype(unsigned int components);
+	void MoveEntity(int entity, unsigned int components);
+
+	UFRWorld(const UFRWorld&);
+	UFRWorld& operator=(const UFRWorld&);
+
+public:
+	UFRWorld();
+	~UFRWorld();
+
+	int CreateEntity(unsigned int components);
+	int CreateEntities(unsigned int components, int count);
+	void Reserve(unsigned int components, int count);
+	int GetEntityCount() { return (int)locations.size(); }
+	void AddComponents(int entity, unsigned int components);
+	void RemoveComponents(int entity, unsigned int components);
+	bool HasComponents(int entity, unsigned int components);
+
+	int GetArchetypeCount() { return (int)archetypes.size(); }
+	UFRArchetype* GetArchetype(int archetype) { return archetypes[archetype]; }
+	UFRArchetype* GetEntityArchetype(int entity) { return archetypes[locations[entity].archetype]; }
+	int GetRow(int entity) { return locations[entity].row; }
+
+	// One component of one entity, which must have it. Systems that go over every entity walk the tables instead.
+	// A reference is only valid until components are next added to or removed from any entity.
+	UFRTransform& GetTransform(int entity) { return archetypes[locations[entity].archetype]->transforms[locations[entity].row]; }
+	UFRVelocity& GetVelocity(int entity) { return archetypes[locations[entity].archetype]->velocities[locations[entity].row]; }
+	UFRBody& GetBody(int entity) { return archetypes[locations[entity].archetype]->bodies[locations[entity].row]; }
+	UFRFriction& GetFriction(int entity) { return archetypes[locations[entity].archetype]->frictions[locations[entity].row]; }
+	UFRSprite& GetSprite(int entity) { return archetypes[locations[entity].archetype]->sprites[locations[entity].row]; }
+	UFRFlightAI& GetFlightAI(int entity) { return archetypes[locations[entity].archetype]->flights[locations[entity].row]; }
+	UFRFallSpin& GetFallSpin(int entity) { return archetypes[locations[entity].archetype]->spins[locations[entity].row]; }
+};